@@ -31,6 +31,9 @@ K_MSGQ_DEFINE(tcp_to_ble_queue, sizeof(struct bridge_msg),
 
 static bool bridge_running;
 
+/* Raised by bridge_stop() so the worker leaves k_poll() */
+static struct k_poll_signal bridge_stop_signal;
+
 K_THREAD_STACK_DEFINE(bridge_stack, BRIDGE_THREAD_STACK_SIZE);
 static struct k_thread bridge_thread;
 
@@ -79,14 +82,26 @@ static void bridge_thread_fn(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+	struct k_poll_event events[3];
+
+	k_poll_event_init(&events[0], K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &ble_to_tcp_queue);
+	k_poll_event_init(&events[1], K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &tcp_to_ble_queue);
+	k_poll_event_init(&events[2], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &bridge_stop_signal);
+
 	LOG_INF("Bridge thread started");
 
 	while (bridge_running) {
 		process_ble_to_tcp();
 		process_tcp_to_ble();
 
-		/* Small sleep to avoid busy-waiting */
-		k_sleep(K_MSEC(10));
+		/* Sleep until either queue has data or bridge_stop() */
+		k_poll(events, ARRAY_SIZE(events), K_FOREVER);
+		for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+			events[i].state = K_POLL_STATE_NOT_READY;
+		}
 	}
 
 	LOG_INF("Bridge thread exiting");
@@ -97,6 +112,7 @@ int bridge_init(void)
 	/* Clear any stale messages */
 	k_msgq_purge(&ble_to_tcp_queue);
 	k_msgq_purge(&tcp_to_ble_queue);
+	k_poll_signal_init(&bridge_stop_signal);
 
 	LOG_INF("Bridge module initialized");
 	return 0;
@@ -110,6 +126,7 @@ void bridge_start(void)
 	}
 
 	bridge_running = true;
+	k_poll_signal_reset(&bridge_stop_signal);
 
 	k_thread_create(&bridge_thread, bridge_stack,
 			K_THREAD_STACK_SIZEOF(bridge_stack),
@@ -124,6 +141,7 @@ void bridge_start(void)
 void bridge_stop(void)
 {
 	bridge_running = false;
+	k_poll_signal_raise(&bridge_stop_signal, 0);
 	LOG_INF("Bridge stopped");
 }
 
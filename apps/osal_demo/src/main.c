@@ -8,9 +8,8 @@ LOG_MODULE_REGISTER(osal_demo, LOG_LEVEL_INF);
 static eai_osal_queue_t queue;
 static uint8_t __aligned(4) queue_buf[8 * sizeof(uint32_t)];
 
-static eai_osal_mutex_t stats_mtx;
-static volatile uint32_t produced;
-static volatile uint32_t consumed;
+static eai_osal_atomic_t produced;
+static eai_osal_atomic_t consumed;
 
 static eai_osal_event_t done_event;
 #define EVT_PRODUCER_DONE BIT(0)
@@ -27,14 +26,13 @@ static void producer_entry(void *arg)
 	for (uint32_t i = 1; i <= 10; i++) {
 		eai_osal_queue_send(&queue, &i, EAI_OSAL_WAIT_FOREVER);
 
-		eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
-		produced++;
-		eai_osal_mutex_unlock(&stats_mtx);
+		eai_osal_atomic_fetch_add(&produced, 1, EAI_OSAL_ATOMIC_RELAXED);
 
 		eai_osal_thread_sleep(100);
 	}
 
-	LOG_INF("Producer done (%u sent)", produced);
+	LOG_INF("Producer done (%ld sent)",
+		(long)eai_osal_atomic_load(&produced, EAI_OSAL_ATOMIC_RELAXED));
 	eai_osal_event_set(&done_event, EVT_PRODUCER_DONE);
 }
 
@@ -51,9 +49,8 @@ static void consumer_entry(void *arg)
 		eai_osal_status_t ret = eai_osal_queue_recv(&queue, &val, 500);
 
 		if (ret == EAI_OSAL_OK) {
-			eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
-			consumed++;
-			eai_osal_mutex_unlock(&stats_mtx);
+			eai_osal_atomic_fetch_add(&consumed, 1,
+						  EAI_OSAL_ATOMIC_RELAXED);
 		} else {
 			/* Timeout — check if producer is done */
 			uint32_t actual;
@@ -66,18 +63,19 @@ static void consumer_entry(void *arg)
 		}
 	}
 
-	LOG_INF("Consumer done (%u received)", consumed);
+	LOG_INF("Consumer done (%ld received)",
+		(long)eai_osal_atomic_load(&consumed, EAI_OSAL_ATOMIC_RELAXED));
 	eai_osal_event_set(&done_event, EVT_CONSUMER_DONE);
 }
 
 /* Heartbeat timer — fires every 500ms */
 static eai_osal_timer_t heartbeat;
-static volatile uint32_t heartbeat_count;
+static eai_osal_atomic_t heartbeat_count;
 
 static void heartbeat_cb(void *arg)
 {
 	ARG_UNUSED(arg);
-	heartbeat_count++;
+	eai_osal_atomic_fetch_add(&heartbeat_count, 1, EAI_OSAL_ATOMIC_RELAXED);
 }
 
 int main(void)
@@ -88,7 +86,6 @@ int main(void)
 
 	/* Init primitives */
 	eai_osal_queue_create(&queue, sizeof(uint32_t), 8, queue_buf);
-	eai_osal_mutex_create(&stats_mtx);
 	eai_osal_event_create(&done_event);
 	eai_osal_timer_create(&heartbeat, heartbeat_cb, NULL);
 
@@ -100,6 +97,13 @@ int main(void)
 	LOG_INF("Critical section: OK");
 	eai_osal_critical_exit(key);
 
+	/* Spinlock test */
+	static eai_osal_spinlock_t spin = EAI_OSAL_SPINLOCK_INITIALIZER;
+	eai_osal_spinlock_key_t spin_key = eai_osal_spin_lock(&spin);
+
+	LOG_INF("Spinlock: OK");
+	eai_osal_spin_unlock(&spin, spin_key);
+
 	/* Semaphore test */
 	eai_osal_sem_t sem;
 
@@ -134,15 +138,17 @@ int main(void)
 	uint32_t elapsed = eai_osal_time_get_ms() - t_start;
 
 	LOG_INF("=== Results ===");
-	LOG_INF("Produced: %u, Consumed: %u", produced, consumed);
-	LOG_INF("Heartbeats: %u", heartbeat_count);
+	LOG_INF("Produced: %ld, Consumed: %ld",
+		(long)eai_osal_atomic_load(&produced, EAI_OSAL_ATOMIC_RELAXED),
+		(long)eai_osal_atomic_load(&consumed, EAI_OSAL_ATOMIC_RELAXED));
+	LOG_INF("Heartbeats: %ld",
+		(long)eai_osal_atomic_load(&heartbeat_count, EAI_OSAL_ATOMIC_RELAXED));
 	LOG_INF("Elapsed: %u ms", elapsed);
 	LOG_INF("ALL OSAL PRIMITIVES OK");
 
 	/* Cleanup */
 	eai_osal_timer_destroy(&heartbeat);
 	eai_osal_event_destroy(&done_event);
-	eai_osal_mutex_destroy(&stats_mtx);
 	eai_osal_queue_destroy(&queue);
 
 	return 0;
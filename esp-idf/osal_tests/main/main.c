@@ -1,8 +1,9 @@
 /*
  * OSAL FreeRTOS backend tests — ported from Zephyr ztest to Unity.
  *
- * 44 tests across 9 suites: mutex, semaphore, thread, queue, timer,
- * event, critical, time, work.
+ * 62 tests across 15 suites: mutex, semaphore, thread, queue, timer,
+ * event, critical, time, work, poll, mempool, arena, rwlock, seqlock,
+ * atomic/spinlock.
  */
 
 #include "unity.h"
@@ -151,7 +152,7 @@ static void test_sem_give_at_limit(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Thread tests (4)
+ * Thread tests (5)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static volatile int thread_counter;
@@ -196,6 +197,14 @@ static void test_thread_yield(void)
 	eai_osal_thread_yield(); /* should not hang */
 }
 
+static void test_thread_set_affinity(void)
+{
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_thread_set_affinity(NULL, 0));
+	/* ESP-IDF pins tasks only at creation */
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_thread_set_affinity(NULL, 0x1));
+}
+
 static SemaphoreHandle_t prio_gate;
 
 static void prio_thread_entry_gated(void *arg)
@@ -240,7 +249,7 @@ static void test_thread_priority(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Queue tests (5)
+ * Queue tests (8)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static uint8_t __attribute__((aligned(4))) queue_buf_4[4 * sizeof(int)];
@@ -319,8 +328,82 @@ static void test_queue_empty_timeout(void)
 	eai_osal_queue_destroy(&queue);
 }
 
+static void test_queue_reserve_commit(void)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+	int msg;
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_commit(&queue));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	/* Only one reservation at a time */
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	*(int *)slot = 77;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(77, msg);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_peek_release(void)
+{
+	eai_osal_queue_t queue;
+	void *msg;
+	int vals[] = {5, 6};
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_release(&queue));
+
+	eai_osal_queue_send(&queue, &vals[0], EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &vals[1], EAI_OSAL_NO_WAIT);
+
+	for (int i = 0; i < 2; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(vals[i], *(int *)msg);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue));
+	}
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_recv_many(void)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[6] = {0};
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	/* Partial send: only 4 fit */
+	TEST_ASSERT_EQUAL(4, eai_osal_queue_send_many(&queue, in, 6, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, eai_osal_queue_send_many(&queue, in, 1, EAI_OSAL_NO_WAIT));
+
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_recv_many(&queue, out, 3, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+
+	/* Wraps around the end of the buffer */
+	TEST_ASSERT_EQUAL(2, eai_osal_queue_send_many(&queue, &in[4], 2, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_recv_many(&queue, out, 6, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_INT_ARRAY(&in[3], out, 3);
+
+	TEST_ASSERT_EQUAL(0, eai_osal_queue_recv_many(&queue, out, 6, 20));
+
+	eai_osal_queue_destroy(&queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Timer tests (5)
+ * Timer tests (7)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static SemaphoreHandle_t timer_sem;
@@ -419,6 +502,45 @@ static void test_timer_is_running(void)
 	eai_osal_timer_destroy(&timer);
 }
 
+static void test_timer_dispatch_workqueue(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	timer_sem = xSemaphoreCreateCounting(10, 0);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_timer_set_dispatch(&timer,
+						      EAI_OSAL_TIMER_DISPATCH_WORKQUEUE,
+						      NULL));
+	eai_osal_timer_start(&timer, 20, 0);
+
+	TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(timer_sem, pdMS_TO_TICKS(200)));
+	TEST_ASSERT_EQUAL(1, timer_count);
+
+	eai_osal_timer_destroy(&timer);
+	vSemaphoreDelete(timer_sem);
+}
+
+static void test_timer_overruns(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	timer_sem = xSemaphoreCreateCounting(10, 0);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	TEST_ASSERT_EQUAL(0, eai_osal_timer_get_overruns(NULL));
+
+	/* Prompt inline callbacks never overrun */
+	eai_osal_timer_start(&timer, 20, 20);
+	test_sleep_ms(110);
+	eai_osal_timer_stop(&timer);
+	TEST_ASSERT_EQUAL(0, eai_osal_timer_get_overruns(&timer));
+
+	eai_osal_timer_destroy(&timer);
+	vSemaphoreDelete(timer_sem);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Event tests (5)
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -549,9 +671,10 @@ static void test_time_tick_roundtrip(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Work queue tests (9)
+ * Work queue tests (12)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
+/* Work items are static: a queue references them until they have run */
 static SemaphoreHandle_t work_sem;
 static volatile int work_counter;
 
@@ -564,13 +687,13 @@ static void work_callback(void *arg)
 
 static void test_work_init(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_init(&work, work_callback, NULL));
 }
 
 static void test_work_init_null(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
 			  eai_osal_work_init(NULL, work_callback, NULL));
 	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
@@ -579,7 +702,7 @@ static void test_work_init_null(void)
 
 static void test_work_submit(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	work_counter = 0;
 	work_sem = xSemaphoreCreateBinary();
 
@@ -602,7 +725,7 @@ static void work_with_arg(void *arg)
 
 static void test_work_arg_passthrough(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	static int my_arg = 77;
 
 	work_arg_val = 0;
@@ -619,13 +742,13 @@ static void test_work_arg_passthrough(void)
 
 static void test_dwork_init(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_init(&dwork, work_callback, NULL));
 }
 
 static void test_dwork_submit(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	work_sem = xSemaphoreCreateBinary();
 
@@ -645,7 +768,7 @@ static void test_dwork_submit(void)
 
 static void test_dwork_cancel(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	work_sem = xSemaphoreCreateBinary();
 
@@ -679,7 +802,7 @@ static void ensure_test_wq(void)
 
 static void test_custom_workqueue(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	work_counter = 0;
 	work_sem = xSemaphoreCreateBinary();
 
@@ -696,7 +819,7 @@ static void test_custom_workqueue(void)
 
 static void test_dwork_submit_to_queue(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	work_sem = xSemaphoreCreateBinary();
 
@@ -711,6 +834,399 @@ static void test_dwork_submit_to_queue(void)
 	vSemaphoreDelete(work_sem);
 }
 
+static SemaphoreHandle_t gate_sem;
+
+static void gate_callback(void *arg)
+{
+	(void)arg;
+	xSemaphoreTake(gate_sem, portMAX_DELAY);
+}
+
+static void test_work_resubmit_and_cancel_sync(void)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t work;
+	work_counter = 0;
+	work_sem = xSemaphoreCreateCounting(8, 0);
+	gate_sem = xSemaphoreCreateBinary();
+
+	ensure_test_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&gate, &test_wq);
+
+	/* Duplicates must not consume queue slots */
+	for (int i = 0; i < 100; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&work, &test_wq));
+	}
+	TEST_ASSERT_TRUE(eai_osal_work_is_pending(&work));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_cancel(&work));
+	TEST_ASSERT_FALSE(eai_osal_work_is_pending(&work));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&work, &test_wq));
+	xSemaphoreGive(gate_sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_flush(&work));
+	TEST_ASSERT_EQUAL(1, work_counter);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_cancel_sync(&work));
+	vSemaphoreDelete(gate_sem);
+	vSemaphoreDelete(work_sem);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(lanes_wq_stack, 2048);
+EAI_OSAL_WQ_BUF_DEFINE(lanes_buf, 2, 4);
+static eai_osal_workqueue_t lanes_wq;
+static int lane_order[4];
+static volatile int lane_count;
+
+static void lane_record(void *arg)
+{
+	lane_order[lane_count++] = (int)(intptr_t)arg;
+	xSemaphoreGive(work_sem);
+}
+
+static void test_workqueue_lanes(void)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t low[2];
+	static eai_osal_work_t high;
+
+	lane_count = 0;
+	work_sem = xSemaphoreCreateCounting(3, 0);
+	gate_sem = xSemaphoreCreateBinary();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_workqueue_create_lanes(
+				  &lanes_wq, "lanes_wq", lanes_wq_stack,
+				  EAI_OSAL_THREAD_STACK_SIZEOF(lanes_wq_stack),
+				  10, lanes_buf, 4, 2));
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_submit_to(&gate, &lanes_wq);
+	vTaskDelay(pdMS_TO_TICKS(10));
+
+	/* Low lane first, urgent item last: it must still run first */
+	for (int i = 0; i < 2; i++) {
+		eai_osal_work_init(&low[i], lane_record, (void *)(intptr_t)(i + 1));
+		eai_osal_work_submit_to(&low[i], &lanes_wq);
+	}
+	eai_osal_work_init(&high, lane_record, (void *)(intptr_t)100);
+	eai_osal_work_set_lane(&high, 1);
+	eai_osal_work_submit_to(&high, &lanes_wq);
+
+	TEST_ASSERT_EQUAL(2, eai_osal_workqueue_high_water(&lanes_wq, 0));
+	TEST_ASSERT_EQUAL(1, eai_osal_workqueue_high_water(&lanes_wq, 1));
+
+	xSemaphoreGive(gate_sem);
+	for (int i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(work_sem, pdMS_TO_TICKS(500)));
+	}
+	TEST_ASSERT_EQUAL(100, lane_order[0]);
+	TEST_ASSERT_EQUAL(1, lane_order[1]);
+	TEST_ASSERT_EQUAL(2, lane_order[2]);
+
+	vSemaphoreDelete(gate_sem);
+	vSemaphoreDelete(work_sem);
+}
+
+static eai_osal_wq_worker_t pool_workers[2];
+static eai_osal_workqueue_t test_pool;
+static volatile uint32_t pool_counter;
+
+static void pool_item(void *arg)
+{
+	(void)arg;
+	vTaskDelay(pdMS_TO_TICKS(20));
+	__atomic_fetch_add(&pool_counter, 1, __ATOMIC_SEQ_CST);
+	xSemaphoreGive(work_sem);
+}
+
+static void test_workqueue_pool(void)
+{
+	static eai_osal_work_t works[4];
+
+	pool_counter = 0;
+	work_sem = xSemaphoreCreateCounting(4, 0);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_workqueue_pool_create(&test_pool, "pool",
+							 pool_workers, 2, 10,
+							 NULL));
+
+	for (int i = 0; i < 4; i++) {
+		eai_osal_work_init(&works[i], pool_item, NULL);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to(&works[i], &test_pool));
+	}
+	for (int i = 0; i < 4; i++) {
+		TEST_ASSERT_EQUAL(pdTRUE,
+				  xSemaphoreTake(work_sem, pdMS_TO_TICKS(500)));
+	}
+	TEST_ASSERT_EQUAL(4, pool_counter);
+
+	vSemaphoreDelete(work_sem);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_poll_ready_and_timeout(void)
+{
+	eai_osal_queue_t queue;
+	uint32_t buf[4];
+	eai_osal_sem_t sem;
+
+	eai_osal_queue_create(&queue, sizeof(uint32_t), 4, buf);
+	eai_osal_sem_create(&sem, 0, 1);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_QUEUE(&queue),
+		EAI_OSAL_POLL_SEM(&sem),
+	};
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(ev, 2, 20));
+
+	eai_osal_sem_give(&sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(ev, 2, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_FALSE(ev[0].ready);
+	TEST_ASSERT_TRUE(ev[1].ready);
+	/* Poll does not consume */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT));
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_queue_destroy(&queue);
+}
+
+static eai_osal_queue_t poll_queue;
+static eai_osal_event_t poll_event;
+
+static void poll_sender_entry(void *arg)
+{
+	uint32_t v = 7;
+
+	(void)arg;
+	test_sleep_ms(20);
+	eai_osal_event_set(&poll_event, 0x01); /* outside the mask */
+	test_sleep_ms(20);
+	eai_osal_queue_send(&poll_queue, &v, EAI_OSAL_NO_WAIT);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(poll_stack, 2048);
+
+static void test_poll_wakes_on_queue(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t buf[4];
+	uint32_t v = 0;
+
+	eai_osal_queue_create(&poll_queue, sizeof(uint32_t), 4, buf);
+	eai_osal_event_create(&poll_event);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_EVENT(&poll_event, 0x30),
+		EAI_OSAL_POLL_QUEUE(&poll_queue),
+	};
+
+	eai_osal_thread_create(&thread, "poll_tx", poll_sender_entry, NULL,
+			       poll_stack, EAI_OSAL_THREAD_STACK_SIZEOF(poll_stack),
+			       5);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(ev, 2, 500));
+	TEST_ASSERT_FALSE(ev[0].ready);
+	TEST_ASSERT_TRUE(ev[1].ready);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv(&poll_queue, &v, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(7, v);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_event_destroy(&poll_event);
+	eai_osal_queue_destroy(&poll_queue);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define POOL_BLOCK  EAI_OSAL_MEMPOOL_BLOCK_SIZE(24)
+#define POOL_BLOCKS 4
+
+static uint8_t pool_buf[POOL_BLOCK * POOL_BLOCKS] __attribute__((aligned(8)));
+
+static void test_mempool_exhaust_and_stats(void)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *blk[POOL_BLOCKS];
+	void *extra;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK,
+						  POOL_BLOCKS));
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_alloc(&pool, &blk[i]));
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY, eai_osal_mempool_alloc(&pool, &extra));
+
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.in_use);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.peak);
+	TEST_ASSERT_EQUAL(1, st.failed);
+
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[i]));
+	}
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.in_use);
+	eai_osal_mempool_destroy(&pool);
+}
+
+static void test_mempool_rejects_foreign_pointer(void)
+{
+	eai_osal_mempool_t pool;
+	void *blk;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, pool_buf, 25, POOL_BLOCKS));
+	eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK, POOL_BLOCKS);
+	eai_osal_mempool_alloc(&pool, &blk);
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, (uint8_t *)blk + 4));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, &pool));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk));
+	eai_osal_mempool_destroy(&pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Arena tests (1)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static uint8_t arena_buf[128] __attribute__((aligned(16)));
+
+static void test_arena_mark_release(void)
+{
+	eai_osal_arena_t arena;
+	eai_osal_arena_stats_t st;
+	void *a;
+	void *b;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_arena_init(&arena, arena_buf, sizeof(arena_buf)));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 10, 0, &a));
+
+	eai_osal_arena_mark_t m = eai_osal_arena_mark(&arena);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 20, 16, &b));
+	TEST_ASSERT_EQUAL(0, (uintptr_t)b % 16);
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY,
+			  eai_osal_arena_alloc(&arena, 200, 0, &b));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_release(&arena, m));
+
+	eai_osal_arena_get_stats(&arena, &st);
+	TEST_ASSERT_EQUAL(10, st.used);
+	TEST_ASSERT_EQUAL(36, st.high_water);
+	TEST_ASSERT_EQUAL(1, st.failed);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Rwlock tests (1)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_rwlock_shared_and_exclusive(void)
+{
+	eai_osal_rwlock_t rw;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_create(&rw));
+
+	/* Readers share; a writer waits for the last one */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, 10));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+
+	/* A writer excludes readers */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw, 10));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_write_unlock(&rw));
+
+	eai_osal_rwlock_destroy(&rw);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Seqlock tests (1)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_seqlock_roundtrip(void)
+{
+	eai_osal_seqlock_t sl;
+	int32_t shared[3];
+	int32_t in[3] = { 1, -2, 3 };
+	int32_t out[3];
+
+	eai_osal_seqlock_init(&sl);
+	eai_osal_seqlock_write(&sl, shared, in, sizeof(in));
+	TEST_ASSERT_EQUAL(0, eai_osal_seqlock_read(&sl, out, shared, sizeof(out)));
+	TEST_ASSERT_EQUAL_MEMORY(in, out, sizeof(in));
+
+	uint32_t seq = eai_osal_seqlock_read_begin(&sl);
+
+	eai_osal_seqlock_write_begin(&sl);
+	eai_osal_seqlock_write_end(&sl);
+	TEST_ASSERT_TRUE(eai_osal_seqlock_read_retry(&sl, seq));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic / spinlock tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_atomic_ops(void)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+	eai_osal_atomic_val_t expected = 4;
+
+	TEST_ASSERT_EQUAL(5, eai_osal_atomic_fetch_add(&a, 3, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_FALSE(eai_osal_atomic_cas(&a, &expected, 9, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(8, expected);
+	TEST_ASSERT_TRUE(eai_osal_atomic_cas(&a, &expected, 9, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(9, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE));
+}
+
+static eai_osal_spinlock_t spin = EAI_OSAL_SPINLOCK_INITIALIZER;
+static uint32_t spin_count;
+static SemaphoreHandle_t spin_done;
+
+static void spin_task(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < 10000; i++) {
+		eai_osal_spinlock_key_t key = eai_osal_spin_lock(&spin);
+
+		spin_count++;
+		eai_osal_spin_unlock(&spin, key);
+	}
+	xSemaphoreGive(spin_done);
+	vTaskDelete(NULL);
+}
+
+/* One task per core hammering the same lock */
+static void test_spinlock_cross_core(void)
+{
+	spin_count = 0;
+	spin_done = xSemaphoreCreateCounting(2, 0);
+	xTaskCreatePinnedToCore(spin_task, "spin0", 2048, NULL, 5, NULL, 0);
+	xTaskCreatePinnedToCore(spin_task, "spin1", 2048, NULL, 5, NULL,
+				portNUM_PROCESSORS - 1);
+	TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(spin_done, pdMS_TO_TICKS(5000)));
+	TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(spin_done, pdMS_TO_TICKS(5000)));
+	TEST_ASSERT_EQUAL(20000, spin_count);
+	vSemaphoreDelete(spin_done);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Test runner
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -737,25 +1253,31 @@ void app_main(void)
 	RUN_TEST(test_sem_timeout);
 	RUN_TEST(test_sem_give_at_limit);
 
-	/* Thread (4) */
+	/* Thread (5) */
 	RUN_TEST(test_thread_create_join);
 	RUN_TEST(test_thread_sleep);
 	RUN_TEST(test_thread_yield);
 	RUN_TEST(test_thread_priority);
+	RUN_TEST(test_thread_set_affinity);
 
-	/* Queue (5) */
+	/* Queue (8) */
 	RUN_TEST(test_queue_create_destroy);
 	RUN_TEST(test_queue_send_recv);
 	RUN_TEST(test_queue_full);
 	RUN_TEST(test_queue_fifo_order);
 	RUN_TEST(test_queue_empty_timeout);
+	RUN_TEST(test_queue_reserve_commit);
+	RUN_TEST(test_queue_peek_release);
+	RUN_TEST(test_queue_send_recv_many);
 
-	/* Timer (5) */
+	/* Timer (7) */
 	RUN_TEST(test_timer_create_destroy);
 	RUN_TEST(test_timer_one_shot);
 	RUN_TEST(test_timer_periodic);
 	RUN_TEST(test_timer_stop);
 	RUN_TEST(test_timer_is_running);
+	RUN_TEST(test_timer_dispatch_workqueue);
+	RUN_TEST(test_timer_overruns);
 
 	/* Event (5) */
 	RUN_TEST(test_event_create_destroy);
@@ -773,7 +1295,7 @@ void app_main(void)
 	RUN_TEST(test_time_monotonic);
 	RUN_TEST(test_time_tick_roundtrip);
 
-	/* Work (9) */
+	/* Work (12) */
 	RUN_TEST(test_work_init);
 	RUN_TEST(test_work_init_null);
 	RUN_TEST(test_work_submit);
@@ -783,6 +1305,30 @@ void app_main(void)
 	RUN_TEST(test_dwork_cancel);
 	RUN_TEST(test_custom_workqueue);
 	RUN_TEST(test_dwork_submit_to_queue);
+	RUN_TEST(test_work_resubmit_and_cancel_sync);
+	RUN_TEST(test_workqueue_lanes);
+	RUN_TEST(test_workqueue_pool);
+
+	/* Poll (2) */
+	RUN_TEST(test_poll_ready_and_timeout);
+	RUN_TEST(test_poll_wakes_on_queue);
+
+	/* Mempool (2) */
+	RUN_TEST(test_mempool_exhaust_and_stats);
+	RUN_TEST(test_mempool_rejects_foreign_pointer);
+
+	/* Arena (1) */
+	RUN_TEST(test_arena_mark_release);
+
+	/* Rwlock (1) */
+	RUN_TEST(test_rwlock_shared_and_exclusive);
+
+	/* Seqlock (1) */
+	RUN_TEST(test_seqlock_roundtrip);
+
+	/* Atomic / spinlock (2) */
+	RUN_TEST(test_atomic_ops);
+	RUN_TEST(test_spinlock_cross_core);
 
 	UNITY_END();
 }
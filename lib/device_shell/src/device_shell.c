@@ -3,6 +3,10 @@
 #include <zephyr/sys/reboot.h>
 #include <zephyr/version.h>
 
+#if defined(CONFIG_EAI_OSAL_STATS)
+#include <eai_osal/stats.h>
+#endif
+
 static int cmd_device_info(const struct shell *sh, size_t argc, char **argv)
 {
 	ARG_UNUSED(argc);
@@ -52,3 +56,51 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_board,
 );
 
 SHELL_CMD_REGISTER(board, &sub_board, "Board info and management", NULL);
+
+#if defined(CONFIG_EAI_OSAL_STATS)
+static void osal_stats_print(const eai_osal_stats_t *st, void *arg)
+{
+	const struct shell *sh = arg;
+
+	shell_print(sh, "%-16s %-9s %8u %8u %8u %5u  %u/%u/%u/%u/%u/%u",
+		    st->name, eai_osal_stats_kind_name(st->kind),
+		    st->count, st->contended, st->max_us, st->high_water,
+		    st->hist[0], st->hist[1], st->hist[2],
+		    st->hist[3], st->hist[4], st->hist[5]);
+}
+
+static int cmd_osal_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-16s %-9s %8s %8s %8s %5s  %s", "Name", "Kind",
+		    "Count", "Waited", "Max us", "HWM",
+		    "<10us/<100us/<1ms/<10ms/<100ms/more");
+	if (eai_osal_stats_foreach(osal_stats_print, (void *)sh) == 0) {
+		shell_print(sh, "(no objects registered)");
+	}
+
+	return 0;
+}
+
+static int cmd_osal_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	eai_osal_stats_reset();
+	shell_print(sh, "OSAL stats cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_osal,
+	SHELL_CMD(stats, NULL, "Per-object counts, waits, high-water marks",
+		  cmd_osal_stats),
+	SHELL_CMD(reset, NULL, "Zero all OSAL stats", cmd_osal_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(osal, &sub_osal, "OSAL runtime statistics", NULL);
+#endif
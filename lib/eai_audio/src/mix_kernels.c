@@ -0,0 +1,356 @@
+/*
+ * eai_audio mini-flinger — mixing kernels
+ *
+ * The 16-bit SIMD variants split the Q16 volume (at most unity) into
+ * its integer bit and 16 fraction bits, so (s * v) >> 16 becomes a
+ * 16x16 high-half multiply plus an add:
+ *
+ *   v == 0x10000:   s
+ *   v <  0x8000:    mulhi(s, v)
+ *   v >= 0x8000:    mulhi(s, v - 0x10000) + s
+ *
+ * The second form reads the fraction as a negative int16; adding s back
+ * is exact, and the result fits int16 because |v| < 1. It is then
+ * widened into the int32 accumulator. Helium multiplies in 32-bit lanes
+ * instead, and DSP uses SMULWB/SMULWT, which take any volume.
+ *
+ * The output pass is a saturating narrow (PACKSSDW, VQMOVN, SSAT, or a
+ * min/max clamp on Helium), exactly the scalar clamp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "mix_kernels.h"
+#include "mixer.h"
+#include <stdbool.h>
+#include <string.h>
+
+#if !defined(EAI_AUDIO_MIX_SCALAR)
+#if defined(__AVX2__)
+#define MIX_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define MIX_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define MIX_NEON 1
+#include <arm_neon.h>
+#elif defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#define MIX_MVE 1
+#include <arm_mve.h>
+#elif defined(__ARM_FEATURE_DSP)
+#define MIX_DSP 1
+#include <arm_acle.h>
+#endif
+#endif
+
+#if defined(MIX_AVX2)
+const char *const eai_audio_mix_isa = "avx2";
+#elif defined(MIX_SSE2)
+const char *const eai_audio_mix_isa = "sse2";
+#elif defined(MIX_NEON)
+const char *const eai_audio_mix_isa = "neon";
+#elif defined(MIX_MVE)
+const char *const eai_audio_mix_isa = "mve";
+#elif defined(MIX_DSP)
+const char *const eai_audio_mix_isa = "dsp";
+#else
+const char *const eai_audio_mix_isa = "scalar";
+#endif
+
+static inline int16_t sat16(int32_t v)
+{
+	if (v > 32767) {
+		return 32767;
+	}
+	if (v < -32768) {
+		return -32768;
+	}
+	return (int16_t)v;
+}
+
+void eai_audio_mix_acc_s32_scalar(int32_t *acc, const int16_t *src,
+				  uint32_t volume_q16, uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		/* 64-bit so gains above unity cannot overflow the product */
+		acc[i] += (int32_t)(((int64_t)src[i] *
+				     (int32_t)volume_q16) >> 16);
+	}
+}
+
+void eai_audio_mix_out_s16_scalar(int16_t *dst, const int32_t *acc,
+				  uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		dst[i] = sat16(acc[i]);
+	}
+}
+
+#if defined(MIX_AVX2)
+
+static uint32_t acc_simd(int32_t *acc, const int16_t *src, uint32_t volume,
+			 uint32_t samples)
+{
+	const __m256i frac = _mm256_set1_epi16((int16_t)(volume & 0xFFFF));
+	const bool unity = volume == EAI_AUDIO_MIXER_VOLUME_UNITY;
+	const bool high = (volume & 0x8000) != 0;
+	uint32_t i = 0;
+
+	if (volume > EAI_AUDIO_MIXER_VOLUME_UNITY) {
+		return 0;
+	}
+	for (; i + 16 <= samples; i += 16) {
+		__m256i s = _mm256_loadu_si256((const __m256i *)&src[i]);
+		__m256i x = s;
+
+		if (!unity) {
+			x = _mm256_mulhi_epi16(s, frac);
+			if (high) {
+				x = _mm256_add_epi16(x, s);
+			}
+		}
+
+		__m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x));
+		__m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+		__m256i *a = (__m256i *)&acc[i];
+
+		_mm256_storeu_si256(a, _mm256_add_epi32(_mm256_loadu_si256(a), lo));
+		_mm256_storeu_si256(a + 1,
+				    _mm256_add_epi32(_mm256_loadu_si256(a + 1), hi));
+	}
+	return i;
+}
+
+static uint32_t out_simd(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	uint32_t i = 0;
+
+	for (; i + 16 <= samples; i += 16) {
+		__m256i a = _mm256_loadu_si256((const __m256i *)&acc[i]);
+		__m256i b = _mm256_loadu_si256((const __m256i *)&acc[i + 8]);
+		/* packs works per 128-bit lane; put the quarters back in order */
+		__m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+
+		_mm256_storeu_si256((__m256i *)&dst[i], p);
+	}
+	return i;
+}
+
+#elif defined(MIX_SSE2)
+
+static uint32_t acc_simd(int32_t *acc, const int16_t *src, uint32_t volume,
+			 uint32_t samples)
+{
+	const __m128i frac = _mm_set1_epi16((int16_t)(volume & 0xFFFF));
+	const bool unity = volume == EAI_AUDIO_MIXER_VOLUME_UNITY;
+	const bool high = (volume & 0x8000) != 0;
+	uint32_t i = 0;
+
+	if (volume > EAI_AUDIO_MIXER_VOLUME_UNITY) {
+		return 0;
+	}
+	for (; i + 8 <= samples; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)&src[i]);
+		__m128i x = s;
+
+		if (!unity) {
+			x = _mm_mulhi_epi16(s, frac);
+			if (high) {
+				x = _mm_add_epi16(x, s);
+			}
+		}
+
+		/* Sign-extend: duplicate each lane into 32 bits, shift down */
+		__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+		__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+		__m128i *a = (__m128i *)&acc[i];
+
+		_mm_storeu_si128(a, _mm_add_epi32(_mm_loadu_si128(a), lo));
+		_mm_storeu_si128(a + 1, _mm_add_epi32(_mm_loadu_si128(a + 1), hi));
+	}
+	return i;
+}
+
+static uint32_t out_simd(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= samples; i += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)&acc[i]);
+		__m128i b = _mm_loadu_si128((const __m128i *)&acc[i + 4]);
+
+		_mm_storeu_si128((__m128i *)&dst[i], _mm_packs_epi32(a, b));
+	}
+	return i;
+}
+
+#elif defined(MIX_NEON)
+
+static uint32_t acc_simd(int32_t *acc, const int16_t *src, uint32_t volume,
+			 uint32_t samples)
+{
+	const int16x4_t frac = vdup_n_s16((int16_t)(volume & 0xFFFF));
+	const bool unity = volume == EAI_AUDIO_MIXER_VOLUME_UNITY;
+	const bool high = (volume & 0x8000) != 0;
+	uint32_t i = 0;
+
+	if (volume > EAI_AUDIO_MIXER_VOLUME_UNITY) {
+		return 0;
+	}
+	for (; i + 8 <= samples; i += 8) {
+		int16x8_t s = vld1q_s16(&src[i]);
+		int16x8_t x = s;
+
+		if (!unity) {
+			/* NEON has no 16-bit mulhi: widen, keep the high half */
+			x = vcombine_s16(
+				vshrn_n_s32(vmull_s16(vget_low_s16(s), frac), 16),
+				vshrn_n_s32(vmull_s16(vget_high_s16(s), frac), 16));
+			if (high) {
+				x = vaddq_s16(x, s);
+			}
+		}
+		vst1q_s32(&acc[i], vaddw_s16(vld1q_s32(&acc[i]), vget_low_s16(x)));
+		vst1q_s32(&acc[i + 4],
+			  vaddw_s16(vld1q_s32(&acc[i + 4]), vget_high_s16(x)));
+	}
+	return i;
+}
+
+static uint32_t out_simd(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= samples; i += 8) {
+		vst1q_s16(&dst[i], vcombine_s16(vqmovn_s32(vld1q_s32(&acc[i])),
+						vqmovn_s32(vld1q_s32(&acc[i + 4]))));
+	}
+	return i;
+}
+
+#elif defined(MIX_MVE)
+
+/* Widening loads and narrowing stores keep Helium in 32-bit lanes */
+static uint32_t acc_simd(int32_t *acc, const int16_t *src, uint32_t volume,
+			 uint32_t samples)
+{
+	uint32_t i = 0;
+
+	if (volume > EAI_AUDIO_MIXER_VOLUME_UNITY) {
+		return 0;
+	}
+	for (; i + 4 <= samples; i += 4) {
+		int32x4_t s = vldrhq_s32(&src[i]);
+		int32x4_t x = vshrq_n_s32(vmulq_n_s32(s, (int32_t)volume), 16);
+
+		vst1q_s32(&acc[i], vaddq_s32(vld1q_s32(&acc[i]), x));
+	}
+	return i;
+}
+
+static uint32_t out_simd(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	const int32x4_t max = vdupq_n_s32(32767);
+	const int32x4_t min = vdupq_n_s32(-32768);
+	uint32_t i = 0;
+
+	for (; i + 4 <= samples; i += 4) {
+		int32x4_t a = vld1q_s32(&acc[i]);
+
+		vstrhq_s32(&dst[i], vmaxq_s32(vminq_s32(a, max), min));
+	}
+	return i;
+}
+
+#elif defined(MIX_DSP)
+
+/*
+ * Two samples per 32-bit word: SMULWB/SMULWT scale the halves by the
+ * full 32-bit volume. The word goes through memcpy, which compiles to a
+ * plain (unaligned-capable) LDR.
+ */
+static uint32_t acc_simd(int32_t *acc, const int16_t *src, uint32_t volume,
+			 uint32_t samples)
+{
+	uint32_t i = 0;
+
+	for (; i + 2 <= samples; i += 2) {
+		int32_t s;
+
+		memcpy(&s, &src[i], sizeof(s));
+		acc[i] += __smulwb((int32_t)volume, s);
+		acc[i + 1] += __smulwt((int32_t)volume, s);
+	}
+	return i;
+}
+
+static uint32_t out_simd(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		dst[i] = (int16_t)__ssat(acc[i], 16);
+	}
+	return samples;
+}
+
+#endif
+
+#if defined(MIX_AVX2) || defined(MIX_SSE2) || defined(MIX_NEON) || \
+	defined(MIX_MVE) || defined(MIX_DSP)
+#define MIX_SIMD 1
+#endif
+
+void eai_audio_mix_acc_s32(int32_t *acc, const int16_t *src,
+			   uint32_t volume_q16, uint32_t samples)
+{
+	uint32_t done = 0;
+
+	if (volume_q16 == EAI_AUDIO_MIXER_VOLUME_MUTE) {
+		return;
+	}
+#ifdef MIX_SIMD
+	done = acc_simd(acc, src, volume_q16, samples);
+#endif
+	eai_audio_mix_acc_s32_scalar(acc + done, src + done, volume_q16,
+				     samples - done);
+}
+
+void eai_audio_mix_out_s16(int16_t *dst, const int32_t *acc, uint32_t samples)
+{
+	uint32_t done = 0;
+
+#ifdef MIX_SIMD
+	done = out_simd(dst, acc, samples);
+#endif
+	eai_audio_mix_out_s16_scalar(dst + done, acc + done, samples - done);
+}
+
+/* ── Float32 accumulator ────────────────────────────────────────────────── */
+
+void eai_audio_mix_acc_f32(float *acc, const int16_t *src,
+			   uint32_t volume_q16, uint32_t samples)
+{
+	const float gain = (float)volume_q16 * (1.0f / 65536.0f);
+
+	if (volume_q16 == EAI_AUDIO_MIXER_VOLUME_MUTE) {
+		return;
+	}
+	for (uint32_t i = 0; i < samples; i++) {
+		acc[i] += (float)src[i] * gain;
+	}
+}
+
+void eai_audio_mix_out_f32(int16_t *dst, const float *acc, uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		float v = acc[i];
+
+		if (v >= 32767.0f) {
+			dst[i] = 32767;
+		} else if (v <= -32768.0f) {
+			dst[i] = -32768;
+		} else {
+			dst[i] = (int16_t)(v + (v >= 0.0f ? 0.5f : -0.5f));
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * eai_audio mini-flinger — mixing kernels
+ *
+ * The mixer sums every active slot into a wide accumulator, then
+ * saturates once to S16 for the hardware. Integer kernels are
+ * vectorized for the target picked at compile time:
+ *
+ *   AVX2 (__AVX2__), SSE2 (__SSE2__), NEON (__ARM_NEON),
+ *   Helium (__ARM_FEATURE_MVE), Cortex-M DSP (__ARM_FEATURE_DSP),
+ *   or the portable scalar loop.
+ *
+ * Define EAI_AUDIO_MIX_SCALAR to force the scalar loop. Every variant
+ * gives bit-identical results to the scalar one. The float32 kernels
+ * (EAI_AUDIO_MIXER_FLOAT) are plain loops left to the compiler.
+ *
+ * Not part of the public API.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef EAI_AUDIO_MIX_KERNELS_H
+#define EAI_AUDIO_MIX_KERNELS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Name of the compiled-in kernel variant ("avx2", "sse2", ..., "scalar"). */
+extern const char *const eai_audio_mix_isa;
+
+/**
+ * Add one slot to the accumulator: acc[i] += (src[i] * volume_q16) >> 16.
+ *
+ * The product rounds toward minus infinity. Nothing saturates here, so
+ * slots cancel exactly; eight slots at up to 16x gain cannot overflow.
+ * Volumes above unity (0x10000) take the scalar loop except on DSP.
+ *
+ * @param acc        Accumulator, one int32 per sample.
+ * @param src        Slot samples.
+ * @param volume_q16 Q16 volume, 0x10000 = unity.
+ * @param samples    Sample count (frames * channels), any value.
+ */
+void eai_audio_mix_acc_s32(int32_t *acc, const int16_t *src,
+			   uint32_t volume_q16, uint32_t samples);
+
+/** Saturate the accumulator to S16: dst[i] = clamp(acc[i]). */
+void eai_audio_mix_out_s16(int16_t *dst, const int32_t *acc, uint32_t samples);
+
+/** Scalar references for the two above, for tests and benchmarks. */
+void eai_audio_mix_acc_s32_scalar(int32_t *acc, const int16_t *src,
+				  uint32_t volume_q16, uint32_t samples);
+void eai_audio_mix_out_s16_scalar(int16_t *dst, const int32_t *acc,
+				  uint32_t samples);
+
+/** Float accumulator: acc[i] += src[i] * volume_q16 / 65536. */
+void eai_audio_mix_acc_f32(float *acc, const int16_t *src,
+			   uint32_t volume_q16, uint32_t samples);
+
+/** Round the float accumulator to nearest and saturate to S16. */
+void eai_audio_mix_out_f32(int16_t *dst, const float *acc, uint32_t samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EAI_AUDIO_MIX_KERNELS_H */
@@ -2,13 +2,22 @@
  * eai_audio mini-flinger — software mixer
  *
  * Platform-independent. Uses eai_osal for thread, mutex, semaphore.
- * Mixes up to N output streams (S16_LE) via int32 accumulator with
- * per-slot Q16 volume and hard clipping.
+ * Mixes up to N output streams (S16_LE) with per-slot Q16 volume into
+ * one int32 (or float32) accumulator, then hard-clips once, so a loud
+ * slot and one that cancels it sum exactly whatever the slot order.
+ *
+ * Each slot is a lock-free SPSC ring from its client to the mixer
+ * thread, so writers never take the mixer mutex. That lock is the
+ * control plane: open/close/volume, and the mixer thread while it mixes
+ * so a slot cannot be closed or reopened under it. A writer facing a
+ * full ring parks on the ring's semaphore; the mixer's release of each
+ * period wakes it.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "mixer.h"
+#include "mix_kernels.h"
 #include <eai_osal/eai_osal.h>
 #include <string.h>
 
@@ -18,19 +27,46 @@
 #define RING_CAP_SAMPLES \
 	(2 * EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES * EAI_AUDIO_MIXER_MAX_CHANNELS)
 
+/* eai_osal_spsc_ring_init() rejects anything else */
+_Static_assert((RING_CAP_SAMPLES & (RING_CAP_SAMPLES - 1)) == 0,
+	       "RING_CAP_SAMPLES must be a power of two");
+
 /* Mix output buffer in samples */
 #define MIX_BUF_SAMPLES \
 	(EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES * EAI_AUDIO_MIXER_MAX_CHANNELS)
 
+#if EAI_AUDIO_MIXER_FLOAT
+typedef float mix_acc_t;
+#define mix_acc eai_audio_mix_acc_f32
+#define mix_out eai_audio_mix_out_f32
+#else
+typedef int32_t mix_acc_t;
+#define mix_acc eai_audio_mix_acc_s32
+#define mix_out eai_audio_mix_out_s16
+#endif
+
 /* ── Per-slot state ─────────────────────────────────────────────────────── */
 
 struct mixer_slot {
-	int16_t ring[RING_CAP_SAMPLES];
-	uint32_t wr; /* total samples written (monotonic) */
-	uint32_t rd; /* total samples read (monotonic) */
+	int16_t ring_buf[RING_CAP_SAMPLES];
+	eai_osal_spsc_ring_t ring; /* client writer -> mixer thread */
 	uint32_t volume; /* Q16: 0x10000 = unity */
 	uint32_t underruns;
-	bool active;
+	eai_osal_atomic_t active; /* set after the ring is ready */
+
+	/* Low watermark, see eai_audio_mixer_set_low_water() */
+	uint32_t low_water; /* frames */
+	eai_audio_mixer_low_water_t low_water_cb;
+	void *low_water_data;
+	eai_osal_atomic_t low_water_armed; /* set by every write */
+};
+
+/* A low-watermark callback due after the current period */
+struct low_water_call {
+	eai_audio_mixer_low_water_t cb;
+	void *user_data;
+	uint32_t writable;
+	uint8_t slot;
 };
 
 /* ── Module state ───────────────────────────────────────────────────────── */
@@ -39,10 +75,11 @@ static struct {
 	struct eai_audio_mixer_config config;
 	struct mixer_slot slots[EAI_AUDIO_MIXER_MAX_SLOTS];
 
+	mix_acc_t acc[MIX_BUF_SAMPLES];
 	int16_t mix_buf[MIX_BUF_SAMPLES];
 
 	eai_osal_thread_t thread;
-	eai_osal_mutex_t mutex;
+	eai_osal_mutex_t mutex; /* control plane: open/close/volume */
 	eai_osal_sem_t sem;
 
 	bool running;
@@ -51,33 +88,11 @@ static struct {
 
 EAI_OSAL_THREAD_STACK_DEFINE(mixer_stack, 2048);
 
-/* ── Ring buffer helpers ────────────────────────────────────────────────── */
+/* ── Slot helpers ───────────────────────────────────────────────────────── */
 
-static uint32_t ring_count(const struct mixer_slot *s)
+static bool slot_active(struct mixer_slot *s)
 {
-	return s->wr - s->rd;
-}
-
-static uint32_t ring_space(const struct mixer_slot *s)
-{
-	return RING_CAP_SAMPLES - ring_count(s);
-}
-
-static void ring_write(struct mixer_slot *s, const int16_t *data,
-		       uint32_t samples)
-{
-	for (uint32_t i = 0; i < samples; i++) {
-		s->ring[s->wr % RING_CAP_SAMPLES] = data[i];
-		s->wr++;
-	}
-}
-
-static void ring_read(struct mixer_slot *s, int16_t *data, uint32_t samples)
-{
-	for (uint32_t i = 0; i < samples; i++) {
-		data[i] = s->ring[s->rd % RING_CAP_SAMPLES];
-		s->rd++;
-	}
+	return eai_osal_atomic_load(&s->active, EAI_OSAL_ATOMIC_ACQUIRE) != 0;
 }
 
 /* ── Mixer thread ───────────────────────────────────────────────────────── */
@@ -86,8 +101,8 @@ static void mixer_thread_entry(void *arg)
 {
 	(void)arg;
 
-	uint32_t period_samples =
-		mixer.config.period_frames * mixer.config.channels;
+	uint8_t channels = mixer.config.channels;
+	uint32_t period_samples = mixer.config.period_frames * channels;
 
 	/* Compute period in ms for timeout-based wakeup */
 	uint32_t period_ms = (mixer.config.period_frames * 1000) /
@@ -96,8 +111,6 @@ static void mixer_thread_entry(void *arg)
 		period_ms = 1;
 	}
 
-	int16_t slot_buf[MIX_BUF_SAMPLES];
-
 	while (mixer.running) {
 		/* Wait for kick or timeout */
 		eai_osal_sem_take(&mixer.sem, period_ms);
@@ -106,52 +119,69 @@ static void mixer_thread_entry(void *arg)
 			break;
 		}
 
+		/* Writers never take this; it only holds off open/close/volume */
 		eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
 
-		/* Zero mix buffer */
-		memset(mixer.mix_buf, 0, period_samples * sizeof(int16_t));
+		/* Zero the accumulator (all-bits-zero is 0.0f too) */
+		memset(mixer.acc, 0, period_samples * sizeof(mix_acc_t));
 
 		bool any_active = false;
+		struct low_water_call calls[EAI_AUDIO_MIXER_MAX_SLOTS];
+		uint8_t ncalls = 0;
 
 		for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
 			struct mixer_slot *slot = &mixer.slots[i];
 
-			if (!slot->active) {
+			if (!slot_active(slot)) {
 				continue;
 			}
 			any_active = true;
 
-			uint32_t avail = ring_count(slot);
-
-			if (avail < period_samples) {
-				/* Underrun: read what's available, rest is silence */
+			/* Underrun: mix what's available, silence adds nothing */
+			if (eai_osal_spsc_ring_count(&slot->ring) < period_samples) {
 				slot->underruns++;
-				memset(slot_buf, 0,
-				       period_samples * sizeof(int16_t));
-				if (avail > 0) {
-					ring_read(slot, slot_buf, avail);
-				}
-			} else {
-				ring_read(slot, slot_buf, period_samples);
 			}
 
-			/* Mix into accumulator with volume */
-			for (uint32_t j = 0; j < period_samples; j++) {
-				int32_t scaled = ((int32_t)slot_buf[j] *
-						  (int32_t)slot->volume) >> 16;
-				int32_t acc = (int32_t)mixer.mix_buf[j] + scaled;
-
-				/* Hard clip to int16 range */
-				if (acc > 32767) {
-					acc = 32767;
-				} else if (acc < -32768) {
-					acc = -32768;
+			/*
+			 * Accumulate with volume straight from the ring, one
+			 * span per side of the wrap; nothing clips yet.
+			 */
+			uint32_t done = 0;
+
+			while (done < period_samples) {
+				const void *src;
+				uint32_t n = eai_osal_spsc_ring_peek(&slot->ring, &src,
+								     period_samples - done);
+
+				if (n == 0) {
+					break;
 				}
+				mix_acc(&mixer.acc[done], src, slot->volume, n);
+				eai_osal_spsc_ring_release(&slot->ring, n);
+				done += n;
+			}
 
-				mixer.mix_buf[j] = (int16_t)acc;
+			/* Run outside the lock, so the callback may call back in */
+			if (slot->low_water_cb != NULL &&
+			    eai_osal_spsc_ring_count(&slot->ring) / channels <=
+				    slot->low_water &&
+			    eai_osal_atomic_fetch_and(&slot->low_water_armed, 0,
+						      EAI_OSAL_ATOMIC_ACQ_REL) != 0) {
+				calls[ncalls++] = (struct low_water_call){
+					.cb = slot->low_water_cb,
+					.user_data = slot->low_water_data,
+					.writable = eai_osal_spsc_ring_space(&slot->ring) /
+						    channels,
+					.slot = i,
+				};
 			}
 		}
 
+		/* One saturating pass to the output format */
+		if (any_active) {
+			mix_out(mixer.mix_buf, mixer.acc, period_samples);
+		}
+
 		eai_osal_mutex_unlock(&mixer.mutex);
 
 		/* Write mixed output to hardware */
@@ -159,6 +189,11 @@ static void mixer_thread_entry(void *arg)
 			mixer.config.hw_write(mixer.mix_buf,
 					      mixer.config.period_frames);
 		}
+
+		for (uint8_t i = 0; i < ncalls; i++) {
+			calls[i].cb(calls[i].slot, calls[i].writable,
+				    calls[i].user_data);
+		}
 	}
 }
 
@@ -231,6 +266,14 @@ int eai_audio_mixer_deinit(void)
 	eai_osal_sem_give(&mixer.sem); /* wake thread so it exits */
 	eai_osal_thread_join(&mixer.thread, 1000);
 
+	for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
+		if (slot_active(&mixer.slots[i])) {
+			eai_osal_atomic_store(&mixer.slots[i].active, 0,
+					      EAI_OSAL_ATOMIC_RELAXED);
+			eai_osal_spsc_ring_destroy(&mixer.slots[i].ring);
+		}
+	}
+
 	eai_osal_sem_destroy(&mixer.sem);
 	eai_osal_mutex_destroy(&mixer.mutex);
 
@@ -247,12 +290,21 @@ int eai_audio_mixer_slot_open(uint8_t *slot)
 	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
 
 	for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
-		if (!mixer.slots[i].active) {
-			mixer.slots[i].active = true;
-			mixer.slots[i].wr = 0;
-			mixer.slots[i].rd = 0;
-			mixer.slots[i].underruns = 0;
-			mixer.slots[i].volume = EAI_AUDIO_MIXER_VOLUME_UNITY;
+		struct mixer_slot *s = &mixer.slots[i];
+
+		if (!slot_active(s)) {
+			/* Blocking, so full-ring writers can park on it */
+			if (eai_osal_spsc_ring_init(&s->ring, s->ring_buf,
+						    sizeof(int16_t),
+						    RING_CAP_SAMPLES,
+						    true) != EAI_OSAL_OK) {
+				break;
+			}
+			s->underruns = 0;
+			s->volume = EAI_AUDIO_MIXER_VOLUME_UNITY;
+			s->low_water_cb = NULL;
+			eai_osal_atomic_store(&s->active, 1,
+					      EAI_OSAL_ATOMIC_RELEASE);
 			*slot = i;
 			eai_osal_mutex_unlock(&mixer.mutex);
 			return 0;
@@ -269,43 +321,99 @@ int eai_audio_mixer_slot_close(uint8_t slot)
 		return -1;
 	}
 
+	struct mixer_slot *s = &mixer.slots[slot];
+
 	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
-	mixer.slots[slot].active = false;
-	mixer.slots[slot].wr = 0;
-	mixer.slots[slot].rd = 0;
+	if (slot_active(s)) {
+		eai_osal_atomic_store(&s->active, 0, EAI_OSAL_ATOMIC_RELEASE);
+		eai_osal_spsc_ring_destroy(&s->ring);
+	}
 	eai_osal_mutex_unlock(&mixer.mutex);
 	return 0;
 }
 
-int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames)
+int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames,
+			  uint32_t timeout_ms)
 {
 	if (!mixer.initialized || !data || frames == 0) {
 		return -1;
 	}
-	if (slot >= EAI_AUDIO_MIXER_MAX_SLOTS || !mixer.slots[slot].active) {
+	if (slot >= EAI_AUDIO_MIXER_MAX_SLOTS ||
+	    !slot_active(&mixer.slots[slot])) {
 		return -1;
 	}
 
-	uint32_t samples = frames * mixer.config.channels;
+	struct mixer_slot *s = &mixer.slots[slot];
+	uint8_t channels = mixer.config.channels;
+	uint32_t written = 0;
+	uint32_t start = eai_osal_time_get_ms();
 
-	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+	for (;;) {
+		/* Producer side of the slot's ring: no lock, at most two memcpys */
+		uint32_t n = eai_osal_spsc_ring_space(&s->ring) / channels;
 
-	uint32_t space = ring_space(&mixer.slots[slot]);
-	uint32_t to_write = samples < space ? samples : space;
+		if (n > frames - written) {
+			n = frames - written;
+		}
+		if (n > 0) {
+			eai_osal_spsc_ring_push_n(&s->ring, &data[written * channels],
+						  n * channels);
+			written += n;
+			eai_osal_atomic_store(&s->low_water_armed, 1,
+					      EAI_OSAL_ATOMIC_RELEASE);
+
+			/* Wake mixer thread */
+			eai_osal_sem_give(&mixer.sem);
+		}
+		if (written == frames || timeout_ms == EAI_OSAL_NO_WAIT) {
+			break;
+		}
 
-	/* Round down to whole frames */
-	to_write = (to_write / mixer.config.channels) * mixer.config.channels;
+		uint32_t remaining = EAI_OSAL_WAIT_FOREVER;
 
-	if (to_write > 0) {
-		ring_write(&mixer.slots[slot], data, to_write);
+		if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+			uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+			if (elapsed >= timeout_ms) {
+				break;
+			}
+			remaining = timeout_ms - elapsed;
+		}
+
+		/* Released by the mixer thread as it consumes each period */
+		eai_osal_spsc_ring_wait_writable(&s->ring, remaining);
 	}
 
-	eai_osal_mutex_unlock(&mixer.mutex);
+	return (int)written;
+}
+
+uint32_t eai_audio_mixer_get_writable(uint8_t slot)
+{
+	if (!mixer.initialized || slot >= EAI_AUDIO_MIXER_MAX_SLOTS ||
+	    !slot_active(&mixer.slots[slot])) {
+		return 0;
+	}
+	return eai_osal_spsc_ring_space(&mixer.slots[slot].ring) /
+	       mixer.config.channels;
+}
+
+int eai_audio_mixer_set_low_water(uint8_t slot, uint32_t low_water_frames,
+				  eai_audio_mixer_low_water_t cb,
+				  void *user_data)
+{
+	if (!mixer.initialized || slot >= EAI_AUDIO_MIXER_MAX_SLOTS) {
+		return -1;
+	}
 
-	/* Wake mixer thread */
-	eai_osal_sem_give(&mixer.sem);
+	struct mixer_slot *s = &mixer.slots[slot];
 
-	return (int)(to_write / mixer.config.channels);
+	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+	s->low_water = low_water_frames;
+	s->low_water_cb = cb;
+	s->low_water_data = user_data;
+	eai_osal_atomic_store(&s->low_water_armed, 1, EAI_OSAL_ATOMIC_RELEASE);
+	eai_osal_mutex_unlock(&mixer.mutex);
+	return 0;
 }
 
 void eai_audio_mixer_kick(void)
@@ -24,6 +24,15 @@ extern "C" {
 #define EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES 1024
 #define EAI_AUDIO_MIXER_MAX_CHANNELS      2
 
+/* Mix in float32 instead of int32 (targets with an FPU) */
+#ifndef EAI_AUDIO_MIXER_FLOAT
+#if defined(CONFIG_EAI_AUDIO_MIXER_FLOAT)
+#define EAI_AUDIO_MIXER_FLOAT 1
+#else
+#define EAI_AUDIO_MIXER_FLOAT 0
+#endif
+#endif
+
 /* Q16 fixed-point volume: 0x10000 = unity (1.0), 0 = mute */
 #define EAI_AUDIO_MIXER_VOLUME_UNITY  0x10000
 #define EAI_AUDIO_MIXER_VOLUME_MUTE   0
@@ -31,6 +40,11 @@ extern "C" {
 /** Callback to write mixed audio to hardware. */
 typedef int (*eai_audio_mixer_hw_write_t)(const void *buf, uint32_t frames);
 
+/** Callback when a slot drains to its low watermark (mixer thread). */
+typedef void (*eai_audio_mixer_low_water_t)(uint8_t slot,
+					    uint32_t writable_frames,
+					    void *user_data);
+
 /** Mixer configuration. */
 struct eai_audio_mixer_config {
 	uint32_t sample_rate;
@@ -73,13 +87,49 @@ int eai_audio_mixer_slot_close(uint8_t slot);
 /**
  * Write audio data to a mixer slot's ring buffer.
  *
- * @param slot    Slot index.
- * @param data    S16_LE audio samples.
- * @param frames  Number of frames to write.
- * @return Number of frames written (may be < frames if ring full),
+ * Takes no lock. When the ring is full the writer sleeps until the mixer
+ * thread frees space, which it does once per period, or until the
+ * timeout expires. The slot's ring is single-producer, so each slot must
+ * be written from one thread at a time, and not concurrently with its
+ * own close or eai_audio_mixer_deinit().
+ *
+ * @param slot        Slot index.
+ * @param data        S16_LE audio samples.
+ * @param frames      Number of frames to write.
+ * @param timeout_ms  Maximum wait for ring space (0 = non-blocking,
+ *                    EAI_OSAL_WAIT_FOREVER = until all frames are queued).
+ * @return Number of frames written (< frames if the timeout expired),
  *         negative errno on error.
  */
-int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames);
+int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames,
+			  uint32_t timeout_ms);
+
+/**
+ * Get how many frames a slot accepts right now without blocking.
+ *
+ * @param slot  Slot index.
+ * @return Writable frames, or 0 if slot invalid or not open.
+ */
+uint32_t eai_audio_mixer_get_writable(uint8_t slot);
+
+/**
+ * Set a slot's low-watermark callback.
+ *
+ * After a period leaves low_water_frames or fewer queued in the slot, the
+ * mixer thread calls cb once it has written the period to hardware, so a
+ * decoder can refill in one large batch. It fires at most once per period
+ * and not again until the slot has been written to. cb may write to the
+ * slot but must not block.
+ *
+ * @param slot             Slot index.
+ * @param low_water_frames Queued-frame threshold.
+ * @param cb               Callback, or NULL to disable.
+ * @param user_data        Passed to cb.
+ * @return 0 on success, -EINVAL if slot invalid.
+ */
+int eai_audio_mixer_set_low_water(uint8_t slot, uint32_t low_water_frames,
+				  eai_audio_mixer_low_water_t cb,
+				  void *user_data);
 
 /**
  * Wake the mixer thread to process pending data.
@@ -0,0 +1,159 @@
+/*
+ * Mixer kernel cost — one period of mixing, scalar vs. the compiled-in
+ * SIMD variant, plus the float32 accumulator.
+ *
+ * A period is what the mixer thread does per wakeup: clear the
+ * accumulator, scale and add every active slot into it, then saturate
+ * once to S16. Reported for
+ * 1-8 slots, mono and stereo, 256 and 1024 frames, as the median over
+ * the runs. Cycles come from the TSC on x86 (reference cycles, not core
+ * clocks); other hosts report nanoseconds.
+ *
+ * Usage: eai_audio_bench_mix [runs]
+ */
+
+#include "mixer.h"
+#include "mix_kernels.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UNIT "cycles"
+
+static inline uint64_t now(void)
+{
+	return __rdtsc();
+}
+#else
+#define UNIT "ns"
+
+static inline uint64_t now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#define DEFAULT_RUNS 2001u
+#define MAX_SLOTS    8
+#define MAX_SAMPLES  (1024 * 2)
+
+typedef void (*acc_fn)(int32_t *acc, const int16_t *src, uint32_t volume_q16,
+		       uint32_t samples);
+typedef void (*out_fn)(int16_t *dst, const int32_t *acc, uint32_t samples);
+
+static int16_t slot_buf[MAX_SLOTS][MAX_SAMPLES];
+static int16_t mix_buf[MAX_SAMPLES];
+static int32_t acc_s32[MAX_SAMPLES];
+static float acc_f32[MAX_SAMPLES];
+static uint64_t samples_taken[DEFAULT_RUNS * 4];
+
+/* Typical per-stream volumes: below unity, so the SIMD path applies */
+static const uint32_t volumes[MAX_SLOTS] = {
+	0x10000, 0xC000, 0x8000, 0xE000, 0x4000, 0xFFFF, 0x6000, 0x9000,
+};
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static uint64_t median(uint32_t runs)
+{
+	qsort(samples_taken, runs, sizeof(samples_taken[0]), cmp_u64);
+	return samples_taken[runs / 2];
+}
+
+static uint64_t period_cost(acc_fn acc, out_fn out, uint32_t slots,
+			    uint32_t samples, uint32_t runs)
+{
+	for (uint32_t r = 0; r < runs; r++) {
+		uint64_t start = now();
+
+		memset(acc_s32, 0, samples * sizeof(int32_t));
+		for (uint32_t s = 0; s < slots; s++) {
+			acc(acc_s32, slot_buf[s], volumes[s], samples);
+		}
+		out(mix_buf, acc_s32, samples);
+		samples_taken[r] = now() - start;
+	}
+	return median(runs);
+}
+
+static uint64_t period_cost_f32(uint32_t slots, uint32_t samples,
+				uint32_t runs)
+{
+	for (uint32_t r = 0; r < runs; r++) {
+		uint64_t start = now();
+
+		memset(acc_f32, 0, samples * sizeof(float));
+		for (uint32_t s = 0; s < slots; s++) {
+			eai_audio_mix_acc_f32(acc_f32, slot_buf[s], volumes[s],
+					      samples);
+		}
+		eai_audio_mix_out_f32(mix_buf, acc_f32, samples);
+		samples_taken[r] = now() - start;
+	}
+	return median(runs);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t runs = DEFAULT_RUNS;
+
+	if (argc > 1) {
+		runs = (uint32_t)strtoul(argv[1], NULL, 0);
+		if (runs == 0 || runs > DEFAULT_RUNS * 4) {
+			runs = DEFAULT_RUNS;
+		}
+	}
+
+	/* Loud noise, so the saturating paths are exercised too */
+	uint32_t seed = 12345;
+
+	for (uint32_t s = 0; s < MAX_SLOTS; s++) {
+		for (uint32_t i = 0; i < MAX_SAMPLES; i++) {
+			seed = seed * 1664525u + 1013904223u;
+			slot_buf[s][i] = (int16_t)(seed >> 16);
+		}
+	}
+
+	printf("kernel: %s, %u runs, median " UNIT " per period\n",
+	       eai_audio_mix_isa, runs);
+	printf("%6s %3s %5s %12s %12s %8s %12s\n", "frames", "ch", "slots",
+	       "scalar", eai_audio_mix_isa, "speedup", "float");
+
+	static const uint32_t frames[] = { 256, 1024 };
+
+	for (uint32_t f = 0; f < 2; f++) {
+		for (uint32_t ch = 1; ch <= 2; ch++) {
+			uint32_t samples = frames[f] * ch;
+
+			for (uint32_t slots = 1; slots <= MAX_SLOTS; slots++) {
+				uint64_t ref = period_cost(eai_audio_mix_acc_s32_scalar,
+							   eai_audio_mix_out_s16_scalar,
+							   slots, samples, runs);
+				uint64_t simd = period_cost(eai_audio_mix_acc_s32,
+							    eai_audio_mix_out_s16,
+							    slots, samples, runs);
+				uint64_t flt = period_cost_f32(slots, samples, runs);
+
+				printf("%6u %3u %5u %12llu %12llu %7.2fx %12llu\n",
+				       frames[f], ch, slots,
+				       (unsigned long long)ref,
+				       (unsigned long long)simd,
+				       simd ? (double)ref / (double)simd : 0.0,
+				       (unsigned long long)flt);
+			}
+		}
+	}
+	return 0;
+}
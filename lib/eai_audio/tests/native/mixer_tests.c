@@ -5,9 +5,17 @@
  * Requires eai_osal POSIX backend.
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_getaffinity_np */
+#endif
+
 #include "unity.h"
 #include "mixer.h"
+#include "mix_kernels.h"
 #include <eai_osal/eai_osal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
 #include <string.h>
 
 /* ── Test hw_write callback ─────────────────────────────────────────────── */
@@ -18,10 +26,23 @@ static int16_t hw_output[HW_BUF_MAX_SAMPLES];
 static uint32_t hw_output_frames;
 static int hw_write_count;
 
+/* See hold_mixer() */
+static volatile bool hw_hold;
+static eai_osal_sem_t hw_parked;
+static eai_osal_sem_t hw_resume;
+
 static int test_hw_write(const void *buf, uint32_t frames)
 {
 	uint32_t samples = frames; /* mono for most tests */
 
+	if (hw_hold) {
+		/* Park, and drop this (pre-write) period */
+		hw_hold = false;
+		eai_osal_sem_give(&hw_parked);
+		eai_osal_sem_take(&hw_resume, EAI_OSAL_WAIT_FOREVER);
+		return 0;
+	}
+
 	/* Detect channel count from mixer config (not available here,
 	 * so we trust the caller set up mono) */
 	if (samples <= HW_BUF_MAX_SAMPLES - hw_output_frames) {
@@ -49,6 +70,26 @@ static const struct eai_audio_mixer_config mono_config = {
 	.hw_write = test_hw_write,
 };
 
+/*
+ * The mixer wakes on every write, so it could mix slot A before slot B
+ * has been written. Multi-slot tests park it in hw_write() first: it
+ * cannot mix again until release_mixer(), and the next period it mixes
+ * sees every slot. Needs an open slot, since hw_write() only runs for
+ * periods with an active slot.
+ */
+static void hold_mixer(void)
+{
+	hw_hold = true;
+	eai_audio_mixer_kick();
+	eai_osal_sem_take(&hw_parked, EAI_OSAL_WAIT_FOREVER);
+}
+
+static void release_mixer(void)
+{
+	reset_hw_output();
+	eai_osal_sem_give(&hw_resume);
+}
+
 /* ── Tests ──────────────────────────────────────────────────────────────── */
 
 static void test_mixer_init_deinit(void)
@@ -126,7 +167,7 @@ static void test_mixer_single_stream(void)
 		data[i] = (int16_t)(i * 100);
 	}
 
-	int written = eai_audio_mixer_write(slot, data, 64);
+	int written = eai_audio_mixer_write(slot, data, 64, 0);
 
 	TEST_ASSERT_EQUAL(64, written);
 
@@ -165,8 +206,10 @@ static void test_mixer_two_streams(void)
 		data_b[i] = 2000;
 	}
 
-	eai_audio_mixer_write(slot_a, data_a, 64);
-	eai_audio_mixer_write(slot_b, data_b, 64);
+	hold_mixer();
+	eai_audio_mixer_write(slot_a, data_a, 64, 0);
+	eai_audio_mixer_write(slot_b, data_b, 64, 0);
+	release_mixer();
 
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
@@ -202,8 +245,10 @@ static void test_mixer_clipping(void)
 		data_b[i] = 20000;
 	}
 
-	eai_audio_mixer_write(slot_a, data_a, 64);
-	eai_audio_mixer_write(slot_b, data_b, 64);
+	hold_mixer();
+	eai_audio_mixer_write(slot_a, data_a, 64, 0);
+	eai_audio_mixer_write(slot_b, data_b, 64, 0);
+	release_mixer();
 
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
@@ -236,8 +281,10 @@ static void test_mixer_negative_clipping(void)
 		data_b[i] = -20000;
 	}
 
-	eai_audio_mixer_write(slot_a, data_a, 64);
-	eai_audio_mixer_write(slot_b, data_b, 64);
+	hold_mixer();
+	eai_audio_mixer_write(slot_a, data_a, 64, 0);
+	eai_audio_mixer_write(slot_b, data_b, 64, 0);
+	release_mixer();
 
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
@@ -253,6 +300,47 @@ static void test_mixer_negative_clipping(void)
 	eai_audio_mixer_deinit();
 }
 
+/* A loud slot and one that cancels it sum exactly, in any slot order */
+static void test_mixer_single_saturation(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slots[3];
+
+	for (int i = 0; i < 3; i++) {
+		eai_audio_mixer_slot_open(&slots[i]);
+	}
+
+	int16_t loud[64], more[64], cancel[64];
+
+	for (int i = 0; i < 64; i++) {
+		loud[i] = 30000;
+		more[i] = 20000;
+		cancel[i] = -20000;
+	}
+
+	hold_mixer();
+	eai_audio_mixer_write(slots[0], loud, 64, 0);
+	eai_audio_mixer_write(slots[1], more, 64, 0);
+	eai_audio_mixer_write(slots[2], cancel, 64, 0);
+	release_mixer();
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	/* Clipping after each slot would give 32767 - 20000 = 12767 */
+	TEST_ASSERT_GREATER_THAN(0, hw_write_count);
+	for (uint32_t i = 0; i < 64 && i < hw_output_frames; i++) {
+		TEST_ASSERT_EQUAL(30000, hw_output[i]);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		eai_audio_mixer_slot_close(slots[i]);
+	}
+	eai_audio_mixer_deinit();
+}
+
 static void test_mixer_volume(void)
 {
 	reset_hw_output();
@@ -271,7 +359,7 @@ static void test_mixer_volume(void)
 		data[i] = 10000;
 	}
 
-	eai_audio_mixer_write(slot, data, 64);
+	eai_audio_mixer_write(slot, data, 64, 0);
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
 
@@ -301,7 +389,7 @@ static void test_mixer_mute(void)
 		data[i] = 10000;
 	}
 
-	eai_audio_mixer_write(slot, data, 64);
+	eai_audio_mixer_write(slot, data, 64, 0);
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
 
@@ -331,7 +419,7 @@ static void test_mixer_underrun(void)
 		data[i] = 1000;
 	}
 
-	eai_audio_mixer_write(slot, data, 10);
+	eai_audio_mixer_write(slot, data, 10, 0);
 	eai_audio_mixer_kick();
 	eai_osal_thread_sleep(50);
 
@@ -342,10 +430,320 @@ static void test_mixer_underrun(void)
 	eai_audio_mixer_deinit();
 }
 
+/*
+ * Stream several ring-fulls through one slot. 48-frame periods do not
+ * divide the ring, so both writes and mix reads straddle the wrap. The
+ * data is never 0, so the callback can drop underrun silence and what
+ * remains must be the input, in order.
+ */
+#define WRAP_SAMPLES 9600
+
+static int16_t wrap_out[WRAP_SAMPLES];
+static volatile uint32_t wrap_len;
+
+static int16_t wrap_sample(uint32_t i)
+{
+	return (int16_t)(i % 30000 + 1);
+}
+
+static int wrap_hw_write(const void *buf, uint32_t frames)
+{
+	const int16_t *samples = buf;
+
+	for (uint32_t i = 0; i < frames && wrap_len < WRAP_SAMPLES; i++) {
+		if (samples[i] != 0) {
+			wrap_out[wrap_len++] = samples[i];
+		}
+	}
+	return 0;
+}
+
+static void test_mixer_ring_wrap(void)
+{
+	static const struct eai_audio_mixer_config config = {
+		.sample_rate = 16000,
+		.channels = 1,
+		.period_frames = 48,
+		.hw_write = wrap_hw_write,
+	};
+	static int16_t data[WRAP_SAMPLES];
+
+	for (uint32_t i = 0; i < WRAP_SAMPLES; i++) {
+		data[i] = wrap_sample(i);
+	}
+
+	wrap_len = 0;
+	eai_audio_mixer_init(&config);
+
+	uint8_t slot;
+
+	eai_audio_mixer_slot_open(&slot);
+
+	/* Odd-sized chunks, retried while the ring is full */
+	uint32_t sent = 0;
+
+	while (sent < WRAP_SAMPLES) {
+		uint32_t n = WRAP_SAMPLES - sent < 1000 ? WRAP_SAMPLES - sent : 1000;
+		int written = eai_audio_mixer_write(slot, &data[sent], n, 0);
+
+		TEST_ASSERT_GREATER_OR_EQUAL(0, written);
+		sent += (uint32_t)written;
+		if ((uint32_t)written < n) {
+			eai_osal_thread_sleep(5);
+		}
+	}
+
+	for (int i = 0; i < 200 && wrap_len < WRAP_SAMPLES; i++) {
+		eai_osal_thread_sleep(10);
+	}
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+
+	TEST_ASSERT_EQUAL_UINT32(WRAP_SAMPLES, wrap_len);
+	TEST_ASSERT_EQUAL_INT16_ARRAY(data, wrap_out, WRAP_SAMPLES);
+}
+
+/* Ring holds 2 * 1024 * 2 samples: 4096 mono frames */
+#define RING_FRAMES 4096
+
+static void test_mixer_write_blocking(void)
+{
+	static int16_t data[RING_FRAMES + 1000];
+
+	for (uint32_t i = 0; i < RING_FRAMES + 1000; i++) {
+		data[i] = 100;
+	}
+
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+
+	eai_audio_mixer_slot_open(&slot);
+	TEST_ASSERT_EQUAL_UINT32(RING_FRAMES, eai_audio_mixer_get_writable(slot));
+
+	/* More than the ring holds: returns once the mixer has made room */
+	TEST_ASSERT_EQUAL(RING_FRAMES + 1000,
+			  eai_audio_mixer_write(slot, data, RING_FRAMES + 1000,
+						EAI_OSAL_WAIT_FOREVER));
+	TEST_ASSERT_LESS_THAN_UINT32(RING_FRAMES, eai_audio_mixer_get_writable(slot));
+
+	eai_audio_mixer_slot_close(slot);
+	TEST_ASSERT_EQUAL_UINT32(0, eai_audio_mixer_get_writable(slot));
+	eai_audio_mixer_deinit();
+}
+
+/* Blocks for one 64-frame period at 16 kHz, like a DMA-paced device */
+static int paced_hw_write(const void *buf, uint32_t frames)
+{
+	(void)buf;
+	(void)frames;
+	eai_osal_thread_sleep(4);
+	return 0;
+}
+
+static void test_mixer_write_timeout(void)
+{
+	static const struct eai_audio_mixer_config config = {
+		.sample_rate = 16000,
+		.channels = 1,
+		.period_frames = 64,
+		.hw_write = paced_hw_write,
+	};
+	static int16_t data[RING_FRAMES];
+
+	eai_audio_mixer_init(&config);
+
+	uint8_t slot;
+
+	eai_audio_mixer_slot_open(&slot);
+
+	/* The ring starts empty, so this fills it in one push */
+	TEST_ASSERT_EQUAL(RING_FRAMES,
+			  eai_audio_mixer_write(slot, data, RING_FRAMES, 0));
+
+	/* The mixer frees 64 frames per period, far short of 4096 in 40 ms */
+	uint32_t t0 = eai_osal_time_get_ms();
+	int written = eai_audio_mixer_write(slot, data, RING_FRAMES, 40);
+	uint32_t elapsed = eai_osal_time_get_ms() - t0;
+
+	TEST_ASSERT_GREATER_THAN(0, written);
+	TEST_ASSERT_LESS_THAN(RING_FRAMES, written);
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT32(40, elapsed);
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* Runs on the mixer thread: record only, assert from the test thread */
+static volatile uint32_t low_water_fired;
+static volatile uint32_t low_water_writable;
+static void *volatile low_water_user_data;
+
+static void low_water_cb(uint8_t slot, uint32_t writable_frames,
+			 void *user_data)
+{
+	(void)slot;
+	low_water_user_data = user_data;
+	low_water_writable = writable_frames;
+	low_water_fired++;
+}
+
+static void wait_low_water(uint32_t count)
+{
+	for (int i = 0; i < 100 && low_water_fired < count; i++) {
+		eai_osal_thread_sleep(10);
+	}
+}
+
+static void test_mixer_low_water(void)
+{
+	static int16_t data[1024];
+
+	low_water_fired = 0;
+	low_water_user_data = NULL;
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+
+	eai_audio_mixer_slot_open(&slot);
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_set_low_water(slot, 128, low_water_cb,
+							   (void *)&low_water_fired));
+
+	eai_audio_mixer_write(slot, data, 1024, 0);
+	wait_low_water(1);
+	TEST_ASSERT_EQUAL_UINT32(1, low_water_fired);
+	TEST_ASSERT_EQUAL_PTR(&low_water_fired, low_water_user_data);
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT32(RING_FRAMES - 128, low_water_writable);
+
+	/* Drained to silence: no repeat until the next write */
+	eai_osal_thread_sleep(50);
+	TEST_ASSERT_EQUAL_UINT32(1, low_water_fired);
+
+	eai_audio_mixer_write(slot, data, 1024, 0);
+	wait_low_water(2);
+	TEST_ASSERT_EQUAL_UINT32(2, low_water_fired);
+
+	/* Disabled */
+	eai_audio_mixer_set_low_water(slot, 0, NULL, NULL);
+	eai_audio_mixer_write(slot, data, 64, 0);
+	eai_osal_thread_sleep(50);
+	TEST_ASSERT_EQUAL_UINT32(2, low_water_fired);
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* The compiled-in kernels must match the scalar loops bit for bit */
+static void test_mix_kernel_matches_scalar(void)
+{
+	static const uint32_t volumes[] = {
+		0, 1, 0x4000, 0x7FFF, 0x8000, 0xC000, 0xFFFF, 0x10000, 0x18000,
+	};
+	static const uint32_t lengths[] = { 0, 1, 7, 8, 15, 16, 17, 33, 2051 };
+	static int16_t src[2051], ref[2051], out[2051];
+	static int32_t ref_acc[2051], acc[2051];
+	uint32_t seed = 1;
+
+	for (uint32_t i = 0; i < 2051; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		src[i] = (int16_t)(seed >> 16);
+	}
+	/* Extremes at the start, where every variant sees them */
+	src[0] = -32768;
+	src[1] = 32767;
+	src[2] = -1;
+
+	for (uint32_t v = 0; v < sizeof(volumes) / sizeof(volumes[0]); v++) {
+		for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+			uint32_t n = lengths[l];
+
+			/* Start from a partly mixed period, beyond int16 */
+			for (uint32_t i = 0; i < n; i++) {
+				ref_acc[i] = acc[i] = (int32_t)src[n - 1 - i] * 3 / 2;
+			}
+			eai_audio_mix_acc_s32_scalar(ref_acc, src, volumes[v], n);
+			eai_audio_mix_acc_s32(acc, src, volumes[v], n);
+			TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE(ref_acc, acc, n ? n : 1,
+							      eai_audio_mix_isa);
+
+			eai_audio_mix_out_s16_scalar(ref, ref_acc, n);
+			eai_audio_mix_out_s16(out, acc, n);
+			TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(ref, out, n ? n : 1,
+							      eai_audio_mix_isa);
+		}
+	}
+}
+
+/* Float accumulation rounds instead of truncating: within one LSB */
+static void test_mix_kernel_float(void)
+{
+	static int16_t src[257], ref[257], out[257];
+	static int32_t acc[257];
+	static float facc[257];
+	uint32_t seed = 7;
+
+	for (uint32_t i = 0; i < 257; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		src[i] = (int16_t)(seed >> 16);
+	}
+
+	memset(acc, 0, sizeof(acc));
+	memset(facc, 0, sizeof(facc));
+	eai_audio_mix_acc_s32(acc, src, 0xC000, 257);
+	eai_audio_mix_acc_s32(acc, src, 0x10000, 257);
+	eai_audio_mix_acc_f32(facc, src, 0xC000, 257);
+	eai_audio_mix_acc_f32(facc, src, 0x10000, 257);
+	eai_audio_mix_out_s16(ref, acc, 257);
+	eai_audio_mix_out_f32(out, facc, 257);
+
+	for (uint32_t i = 0; i < 257; i++) {
+		TEST_ASSERT_INT_WITHIN(1, ref[i], out[i]);
+	}
+
+	/* Round half away from zero, clip at full scale */
+	static const float edge[] = { 1.5f, -1.5f, 0.49f, 40000.0f, -40000.0f };
+	static const int16_t expect[] = { 2, -2, 0, 32767, -32768 };
+
+	eai_audio_mix_out_f32(out, edge, 5);
+	TEST_ASSERT_EQUAL_INT16_ARRAY(expect, out, 5);
+}
+
 /* ── Runner ─────────────────────────────────────────────────────────────── */
 
 void run_mixer_tests(void)
 {
+#if defined(__linux__)
+	/*
+	 * One CPU for the suite, so the mixer and writers interleave as on a
+	 * single-core target; threads created below inherit it. Pick the
+	 * first CPU this process may use, and put the mask back afterwards.
+	 */
+	cpu_set_t saved, one;
+	bool pinned = false;
+
+	if (pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved) == 0) {
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &saved)) {
+				CPU_ZERO(&one);
+				CPU_SET(cpu, &one);
+				pinned = pthread_setaffinity_np(pthread_self(),
+								sizeof(one),
+								&one) == 0;
+				break;
+			}
+		}
+	}
+	if (!pinned) {
+		printf("mixer tests: could not pin to one CPU, running unpinned\n");
+	}
+#endif
+
+	eai_osal_sem_create(&hw_parked, 0, 1);
+	eai_osal_sem_create(&hw_resume, 0, 1);
+
 	RUN_TEST(test_mixer_init_deinit);
 	RUN_TEST(test_mixer_init_null);
 	RUN_TEST(test_mixer_init_bad_period);
@@ -355,7 +753,23 @@ void run_mixer_tests(void)
 	RUN_TEST(test_mixer_two_streams);
 	RUN_TEST(test_mixer_clipping);
 	RUN_TEST(test_mixer_negative_clipping);
+	RUN_TEST(test_mixer_single_saturation);
 	RUN_TEST(test_mixer_volume);
 	RUN_TEST(test_mixer_mute);
 	RUN_TEST(test_mixer_underrun);
+	RUN_TEST(test_mixer_ring_wrap);
+	RUN_TEST(test_mixer_write_blocking);
+	RUN_TEST(test_mixer_write_timeout);
+	RUN_TEST(test_mixer_low_water);
+	RUN_TEST(test_mix_kernel_matches_scalar);
+	RUN_TEST(test_mix_kernel_float);
+
+	eai_osal_sem_destroy(&hw_resume);
+	eai_osal_sem_destroy(&hw_parked);
+
+#if defined(__linux__)
+	if (pinned) {
+		pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+	}
+#endif
 }
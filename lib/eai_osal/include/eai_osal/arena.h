@@ -0,0 +1,107 @@
+#ifndef EAI_OSAL_ARENA_H
+#define EAI_OSAL_ARENA_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Bump allocator for per-period scratch memory.
+ *
+ * An arena hands out aligned pieces of one caller-provided buffer by
+ * advancing an offset, so an allocation is a few arithmetic ops. Nothing
+ * is freed individually: eai_osal_arena_mark() records the offset and
+ * eai_osal_arena_release() rewinds to it, dropping everything allocated
+ * since in one step. A DSP or compositing loop typically resets its arena
+ * once per period.
+ *
+ * An arena has a single owner and takes no lock.
+ *
+ * With EAI_OSAL_ARENA_POISON (CONFIG_EAI_OSAL_ARENA_POISON on Zephyr),
+ * new allocations are filled with EAI_OSAL_ARENA_POISON_ALLOC and
+ * released memory with EAI_OSAL_ARENA_POISON_FREE, so reads of
+ * uninitialized or stale scratch show up as obvious patterns.
+ */
+
+#ifndef EAI_OSAL_ARENA_POISON
+#if defined(CONFIG_EAI_OSAL_ARENA_POISON)
+#define EAI_OSAL_ARENA_POISON 1
+#else
+#define EAI_OSAL_ARENA_POISON 0
+#endif
+#endif
+
+#define EAI_OSAL_ARENA_POISON_ALLOC 0xCD
+#define EAI_OSAL_ARENA_POISON_FREE  0xDD
+
+/** Alignment used when eai_osal_arena_alloc() is given align = 0. */
+#ifndef EAI_OSAL_ARENA_ALIGN
+#define EAI_OSAL_ARENA_ALIGN 8
+#endif
+
+typedef struct {
+	uint8_t *_buf;
+	size_t _size;
+	size_t _used;     /* bump offset */
+	size_t _hwm;      /* largest _used since init */
+	uint32_t _failed; /* allocations that did not fit */
+} eai_osal_arena_t;
+
+/** Arena position, see eai_osal_arena_mark(). */
+typedef size_t eai_osal_arena_mark_t;
+
+typedef struct {
+	size_t size;
+	size_t used;
+	size_t high_water; /* most bytes in use at once since init */
+	uint32_t failed;   /* allocations refused for lack of space */
+} eai_osal_arena_stats_t;
+
+/**
+ * @brief Initialize an arena over caller-provided storage.
+ *
+ * @param arena  Arena to initialize.
+ * @param buffer Backing storage.
+ * @param size   Size of buffer in bytes.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_arena_init(eai_osal_arena_t *arena, void *buffer,
+				      size_t size);
+
+/**
+ * @brief Carve size bytes off the arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param size  Bytes wanted.
+ * @param align Power-of-two alignment, or 0 for EAI_OSAL_ARENA_ALIGN.
+ * @param ptr   Receives the allocation.
+ * @return EAI_OSAL_OK, EAI_OSAL_NO_MEMORY if it does not fit,
+ *         EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_arena_alloc(eai_osal_arena_t *arena, size_t size,
+				       size_t align, void **ptr);
+
+/**
+ * @brief Record the current position for a later eai_osal_arena_release().
+ */
+eai_osal_arena_mark_t eai_osal_arena_mark(const eai_osal_arena_t *arena);
+
+/**
+ * @brief Drop every allocation made since mark was taken.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if mark lies beyond the
+ *         current position (it was taken before an earlier release).
+ */
+eai_osal_status_t eai_osal_arena_release(eai_osal_arena_t *arena,
+					 eai_osal_arena_mark_t mark);
+
+/**
+ * @brief Drop every allocation. Same as releasing to a mark taken at init.
+ */
+void eai_osal_arena_reset(eai_osal_arena_t *arena);
+
+/**
+ * @brief Snapshot the arena's usage counters.
+ */
+eai_osal_status_t eai_osal_arena_get_stats(const eai_osal_arena_t *arena,
+					   eai_osal_arena_stats_t *stats);
+
+#endif /* EAI_OSAL_ARENA_H */
@@ -0,0 +1,158 @@
+#ifndef EAI_OSAL_ATOMIC_H
+#define EAI_OSAL_ATOMIC_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Word-sized atomics with explicit memory order.
+ *
+ * POSIX and FreeRTOS use the compiler's __atomic builtins (C11 semantics;
+ * on cores without atomic instructions, such as ESP32-C3, ESP-IDF
+ * backs them with short critical sections). Zephyr maps to atomic_t; its
+ * operations are all sequentially consistent, which satisfies any order
+ * asked for here.
+ *
+ * All calls are inline and ISR-safe.
+ */
+
+typedef enum {
+	EAI_OSAL_ATOMIC_RELAXED = __ATOMIC_RELAXED,
+	EAI_OSAL_ATOMIC_ACQUIRE = __ATOMIC_ACQUIRE,
+	EAI_OSAL_ATOMIC_RELEASE = __ATOMIC_RELEASE,
+	EAI_OSAL_ATOMIC_ACQ_REL = __ATOMIC_ACQ_REL,
+	EAI_OSAL_ATOMIC_SEQ_CST = __ATOMIC_SEQ_CST,
+} eai_osal_memorder_t;
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
+
+#include <zephyr/sys/atomic.h>
+
+typedef atomic_val_t eai_osal_atomic_val_t;
+typedef struct { atomic_t _v; } eai_osal_atomic_t;
+
+#define EAI_OSAL_ATOMIC_INIT(v) { ATOMIC_INIT(v) }
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_load(const eai_osal_atomic_t *a, eai_osal_memorder_t mo)
+{
+	(void)mo;
+	return atomic_get(&a->_v);
+}
+
+static inline void eai_osal_atomic_store(eai_osal_atomic_t *a,
+					 eai_osal_atomic_val_t v,
+					 eai_osal_memorder_t mo)
+{
+	(void)mo;
+	atomic_set(&a->_v, v);
+}
+
+static inline bool eai_osal_atomic_cas(eai_osal_atomic_t *a,
+				       eai_osal_atomic_val_t *expected,
+				       eai_osal_atomic_val_t desired,
+				       eai_osal_memorder_t mo)
+{
+	(void)mo;
+	if (atomic_cas(&a->_v, *expected, desired)) {
+		return true;
+	}
+	*expected = atomic_get(&a->_v);
+	return false;
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_add(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	(void)mo;
+	return atomic_add(&a->_v, v);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_sub(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	(void)mo;
+	return atomic_sub(&a->_v, v);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_or(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			 eai_osal_memorder_t mo)
+{
+	(void)mo;
+	return atomic_or(&a->_v, v);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_and(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	(void)mo;
+	return atomic_and(&a->_v, v);
+}
+
+#else /* POSIX, FreeRTOS */
+
+typedef long eai_osal_atomic_val_t;
+typedef struct { eai_osal_atomic_val_t _v; } eai_osal_atomic_t;
+
+#define EAI_OSAL_ATOMIC_INIT(v) { (v) }
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_load(const eai_osal_atomic_t *a, eai_osal_memorder_t mo)
+{
+	return __atomic_load_n(&a->_v, (int)mo);
+}
+
+static inline void eai_osal_atomic_store(eai_osal_atomic_t *a,
+					 eai_osal_atomic_val_t v,
+					 eai_osal_memorder_t mo)
+{
+	__atomic_store_n(&a->_v, v, (int)mo);
+}
+
+static inline bool eai_osal_atomic_cas(eai_osal_atomic_t *a,
+				       eai_osal_atomic_val_t *expected,
+				       eai_osal_atomic_val_t desired,
+				       eai_osal_memorder_t mo)
+{
+	/* Failure order may not be RELEASE/ACQ_REL or stronger than mo */
+	int fail = (mo == EAI_OSAL_ATOMIC_RELEASE) ? __ATOMIC_RELAXED :
+		   (mo == EAI_OSAL_ATOMIC_ACQ_REL) ? __ATOMIC_ACQUIRE : (int)mo;
+
+	return __atomic_compare_exchange_n(&a->_v, expected, desired, false,
+					   (int)mo, fail);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_add(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	return __atomic_fetch_add(&a->_v, v, (int)mo);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_sub(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	return __atomic_fetch_sub(&a->_v, v, (int)mo);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_or(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			 eai_osal_memorder_t mo)
+{
+	return __atomic_fetch_or(&a->_v, v, (int)mo);
+}
+
+static inline eai_osal_atomic_val_t
+eai_osal_atomic_fetch_and(eai_osal_atomic_t *a, eai_osal_atomic_val_t v,
+			  eai_osal_memorder_t mo)
+{
+	return __atomic_fetch_and(&a->_v, v, (int)mo);
+}
+
+#endif
+
+#endif /* EAI_OSAL_ATOMIC_H */
@@ -3,6 +3,13 @@
 
 #include <eai_osal/types.h>
 
+/*
+ * System-wide critical section: one lock shared by every caller (IRQ lock
+ * on Zephyr, a global spinlock on FreeRTOS, a global recursive mutex on
+ * POSIX). To guard a single structure, prefer an eai_osal_spinlock_t or
+ * eai_osal_atomic_t so unrelated modules do not contend.
+ */
+
 eai_osal_critical_key_t eai_osal_critical_enter(void);
 void eai_osal_critical_exit(eai_osal_critical_key_t key);
 
@@ -11,5 +11,15 @@
 #include <eai_osal/critical.h>
 #include <eai_osal/time.h>
 #include <eai_osal/workqueue.h>
+#include <eai_osal/spsc_ring.h>
+#include <eai_osal/poll.h>
+#include <eai_osal/mempool.h>
+#include <eai_osal/arena.h>
+#include <eai_osal/rwlock.h>
+#include <eai_osal/seqlock.h>
+#include <eai_osal/atomic.h>
+#include <eai_osal/spinlock.h>
+#include <eai_osal/stats.h>
+#include <eai_osal/trace.h>
 
 #endif /* EAI_OSAL_H */
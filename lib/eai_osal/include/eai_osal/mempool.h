@@ -0,0 +1,81 @@
+#ifndef EAI_OSAL_MEMPOOL_H
+#define EAI_OSAL_MEMPOOL_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Fixed-block memory pool over caller-provided storage.
+ *
+ * The buffer is carved into num_blocks blocks of block_size bytes that
+ * sit on a free list, so alloc and free are O(1) and never touch the
+ * heap. Allocation never waits: an empty pool fails at once and the
+ * failure is counted in the pool's stats.
+ *
+ * Zephyr maps to k_mem_slab. POSIX keeps a lock-free free list; FreeRTOS
+ * guards it with a per-pool spinlock. alloc and free may be called from
+ * ISRs on Zephyr and FreeRTOS.
+ */
+
+/** Block size and buffer alignment granule. */
+#define EAI_OSAL_MEMPOOL_ALIGN sizeof(void *)
+
+/** Round a block size up to EAI_OSAL_MEMPOOL_ALIGN. */
+#define EAI_OSAL_MEMPOOL_BLOCK_SIZE(size) \
+	(((size) + EAI_OSAL_MEMPOOL_ALIGN - 1) & ~(EAI_OSAL_MEMPOOL_ALIGN - 1))
+
+typedef struct {
+	uint32_t num_blocks;
+	uint32_t in_use;
+	uint32_t peak;   /* most blocks in use at once since create */
+	uint32_t failed; /* allocations refused because the pool was empty */
+} eai_osal_mempool_stats_t;
+
+/**
+ * @brief Initialize a pool over caller-provided storage.
+ *
+ * @param pool       Pool to initialize.
+ * @param buffer     Storage for block_size * num_blocks bytes, aligned to
+ *                   EAI_OSAL_MEMPOOL_ALIGN.
+ * @param block_size Block size in bytes, a non-zero multiple of
+ *                   EAI_OSAL_MEMPOOL_ALIGN.
+ * @param num_blocks Number of blocks.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  void *buffer, size_t block_size,
+					  uint32_t num_blocks);
+
+/**
+ * @brief Retire a pool. The buffer belongs to the caller again.
+ */
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool);
+
+/**
+ * @brief Take one block off the free list.
+ *
+ * @param pool  Pool to allocate from.
+ * @param block Receives the block.
+ * @return EAI_OSAL_OK, EAI_OSAL_NO_MEMORY if every block is in use,
+ *         EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool,
+					 void **block);
+
+/**
+ * @brief Return a block to its pool.
+ *
+ * Freeing a block twice is not detected and corrupts the free list.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if block is not the
+ *         start of one of the pool's blocks.
+ */
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool,
+					void *block);
+
+/**
+ * @brief Snapshot the pool's usage counters.
+ */
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats);
+
+#endif /* EAI_OSAL_MEMPOOL_H */
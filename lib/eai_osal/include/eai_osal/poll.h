@@ -0,0 +1,68 @@
+#ifndef EAI_OSAL_POLL_H
+#define EAI_OSAL_POLL_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Wait on several queues, semaphores and events at once, modeled on
+ * k_poll().
+ *
+ * eai_osal_poll() only reports readiness; it never takes anything. After
+ * it returns, receive/take from the objects whose descriptor is ready
+ * with EAI_OSAL_NO_WAIT. Another thread may have consumed the item in
+ * between, so a NO_WAIT call can still time out.
+ *
+ * Zephyr maps to k_poll (needs CONFIG_EAI_OSAL_POLL, which also gives each
+ * event a k_poll_signal). FreeRTOS parks the poller on a bit of a shared
+ * event group, and POSIX on a shared condition variable. Queue sends,
+ * semaphore gives and event sets wake that bit or condvar only while a
+ * poller is parked, so the cost is a single load when nobody polls.
+ */
+
+/** Upper bound on descriptors per eai_osal_poll() call. */
+#ifndef EAI_OSAL_POLL_MAX_EVENTS
+#define EAI_OSAL_POLL_MAX_EVENTS 8
+#endif
+
+typedef enum {
+	EAI_OSAL_POLL_QUEUE_NOT_EMPTY, /* at least one message queued */
+	EAI_OSAL_POLL_SEM_AVAILABLE,   /* count > 0 */
+	EAI_OSAL_POLL_EVENT_BITS,      /* any of .bits set */
+} eai_osal_poll_type_t;
+
+typedef struct {
+	eai_osal_poll_type_t type;
+	union {
+		eai_osal_queue_t *queue;
+		eai_osal_sem_t *sem;
+		eai_osal_event_t *event;
+	} obj;
+	uint32_t bits; /* EVENT_BITS only */
+	bool ready;    /* output, set by eai_osal_poll() */
+} eai_osal_poll_event_t;
+
+#define EAI_OSAL_POLL_QUEUE(q) \
+	{ .type = EAI_OSAL_POLL_QUEUE_NOT_EMPTY, .obj.queue = (q) }
+#define EAI_OSAL_POLL_SEM(s) \
+	{ .type = EAI_OSAL_POLL_SEM_AVAILABLE, .obj.sem = (s) }
+#define EAI_OSAL_POLL_EVENT(e, b) \
+	{ .type = EAI_OSAL_POLL_EVENT_BITS, .obj.event = (e), .bits = (b) }
+
+/**
+ * @brief Block until at least one descriptor is ready.
+ *
+ * On return every descriptor's ready flag reflects its object's state at
+ * the final check, so several may be set.
+ *
+ * @param events     Array of descriptors.
+ * @param n          Number of descriptors, 1..EAI_OSAL_POLL_MAX_EVENTS.
+ * @param timeout_ms Time to wait for the first ready descriptor.
+ * @return EAI_OSAL_OK if any descriptor is ready, EAI_OSAL_TIMEOUT if none
+ *         became ready, EAI_OSAL_INVALID_PARAM on bad descriptors,
+ *         EAI_OSAL_NO_MEMORY if the FreeRTOS backend has no free poller
+ *         slot.
+ */
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, uint32_t n,
+				uint32_t timeout_ms);
+
+#endif /* EAI_OSAL_POLL_H */
@@ -11,4 +11,95 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 				      uint32_t timeout_ms);
 
+/**
+ * @brief Send up to n messages with one lock acquisition and one wakeup.
+ *
+ * Waits up to timeout_ms for the first free slot, then copies as many
+ * messages as fit without waiting again.
+ *
+ * @param queue      Queue to write to.
+ * @param msgs       Array of n messages, msg_size bytes each.
+ * @param n          Number of messages offered.
+ * @param timeout_ms Time to wait for the first free slot.
+ * @return Number of messages sent (0..n). 0 on timeout or bad args.
+ */
+uint32_t eai_osal_queue_send_many(eai_osal_queue_t *queue, const void *msgs,
+				  uint32_t n, uint32_t timeout_ms);
+
+/**
+ * @brief Receive up to n messages with one lock acquisition and one wakeup.
+ *
+ * Waits up to timeout_ms for the first message, then drains whatever
+ * else is queued, up to n, without waiting again.
+ *
+ * @param queue      Queue to read from.
+ * @param msgs       Room for n messages, msg_size bytes each.
+ * @param n          Capacity of msgs in messages.
+ * @param timeout_ms Time to wait for the first message.
+ * @return Number of messages received (0..n). 0 on timeout or bad args.
+ */
+uint32_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+				  uint32_t n, uint32_t timeout_ms);
+
+/*
+ * Zero-copy access.
+ *
+ * reserve()/commit() let a producer build a message in place, and
+ * peek()/release() let a consumer process one in place. At most one
+ * reservation and one peek may be outstanding per queue; a second
+ * reserve() or peek() fails instead of waiting.
+ *
+ * On POSIX the pointers refer to the queue's own slots, and send()/recv()
+ * wait behind an outstanding reservation/peek so FIFO order is kept.
+ * Zephyr k_msgq and FreeRTOS queues own their storage, so there the
+ * pointer refers to a per-queue staging message (allocated from the
+ * kernel heap on first use) and commit()/peek() perform the single
+ * kernel copy; a concurrent send() may land ahead of a staged message.
+ */
+
+/**
+ * @brief Claim the next free message slot for writing.
+ *
+ * @param queue      Queue to write to.
+ * @param slot       Receives a pointer to msg_size writable bytes.
+ * @param timeout_ms Time to wait for a free slot.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if no slot became free,
+ *         EAI_OSAL_ERROR if a reservation is already outstanding,
+ *         EAI_OSAL_NO_MEMORY if the staging message cannot be allocated.
+ */
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms);
+
+/**
+ * @brief Publish the slot claimed by eai_osal_queue_reserve().
+ *
+ * Never blocks on POSIX. On Zephyr/FreeRTOS the message is put with the
+ * timeout given to reserve() and EAI_OSAL_TIMEOUT means it was dropped.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_ERROR if nothing is reserved.
+ */
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue);
+
+/**
+ * @brief Borrow the oldest message without copying it out.
+ *
+ * The message stays valid until eai_osal_queue_release().
+ *
+ * @param queue      Queue to read from.
+ * @param msg        Receives a pointer to the message.
+ * @param timeout_ms Time to wait for a message.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if the queue stayed empty,
+ *         EAI_OSAL_ERROR if a peek is already outstanding,
+ *         EAI_OSAL_NO_MEMORY if the staging message cannot be allocated.
+ */
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **msg,
+				      uint32_t timeout_ms);
+
+/**
+ * @brief Retire the message borrowed by eai_osal_queue_peek().
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_ERROR if nothing is peeked.
+ */
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue);
+
 #endif /* EAI_OSAL_QUEUE_H */
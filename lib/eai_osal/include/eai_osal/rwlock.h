@@ -0,0 +1,59 @@
+#ifndef EAI_OSAL_RWLOCK_H
+#define EAI_OSAL_RWLOCK_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Reader-writer lock for read-mostly shared state.
+ *
+ * Any number of readers may hold the lock together; a writer holds it
+ * alone. Writers are preferred: once a writer is waiting, new readers
+ * queue behind it, so a steady stream of readers cannot starve writers
+ * (the reverse can happen under constant write load).
+ *
+ * The lock is not recursive and must not be upgraded: a reader that asks
+ * for the write lock deadlocks. Not for ISRs.
+ *
+ * POSIX and Zephyr use a mutex plus two condition variables. FreeRTOS has
+ * no condition variables; there readers hold one of
+ * EAI_OSAL_RWLOCK_MAX_READERS semaphore tokens, and a writer holds a
+ * turnstile mutex while collecting all of them.
+ */
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *lock);
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *lock);
+
+/**
+ * @brief Take the lock shared.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_TIMEOUT if a writer held or wanted
+ *         the lock for all of timeout_ms.
+ */
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *lock,
+					    uint32_t timeout_ms);
+
+/**
+ * @brief Drop a shared hold.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_ERROR if no reader holds the lock.
+ */
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *lock);
+
+/**
+ * @brief Take the lock exclusive.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_TIMEOUT if readers or another writer
+ *         held it for all of timeout_ms.
+ */
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *lock,
+					     uint32_t timeout_ms);
+
+/**
+ * @brief Drop the exclusive hold.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_ERROR if the lock is not write-held
+ *         (on FreeRTOS: not write-held by the caller).
+ */
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *lock);
+
+#endif /* EAI_OSAL_RWLOCK_H */
@@ -0,0 +1,66 @@
+#ifndef EAI_OSAL_SEQLOCK_H
+#define EAI_OSAL_SEQLOCK_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Sequence lock for single-writer, many-reader snapshots (latest sensor
+ * sample, current pose, ...).
+ *
+ * The writer never waits: it bumps the sequence to odd, updates the data
+ * and bumps it back to even. Readers copy the data and retry if the
+ * sequence was odd or moved meanwhile, so they never block the writer and
+ * never see a torn snapshot.
+ *
+ * Use eai_osal_seqlock_write()/eai_osal_seqlock_read() to copy a whole
+ * snapshot; they access the data with relaxed atomics so the overlapping
+ * accesses are well defined. The begin/end/retry calls are for callers
+ * that update or read fields in place.
+ *
+ * Only one writer at a time; serialize writers externally. On a single
+ * core a reader that preempts the writer mid-update spins until the
+ * writer runs again, so publish from an ISR or from a thread that the
+ * readers cannot preempt.
+ */
+
+typedef struct {
+	uint32_t _seq; /* odd while a write is in progress */
+} eai_osal_seqlock_t;
+
+void eai_osal_seqlock_init(eai_osal_seqlock_t *sl);
+
+/** Start an update (writer only). */
+void eai_osal_seqlock_write_begin(eai_osal_seqlock_t *sl);
+
+/** Finish an update started with eai_osal_seqlock_write_begin(). */
+void eai_osal_seqlock_write_end(eai_osal_seqlock_t *sl);
+
+/**
+ * @brief Start a read. Spins while a write is in progress.
+ *
+ * @return Sequence to pass to eai_osal_seqlock_read_retry().
+ */
+uint32_t eai_osal_seqlock_read_begin(const eai_osal_seqlock_t *sl);
+
+/**
+ * @brief Check whether the data read since read_begin may be torn.
+ *
+ * @return true if a write overlapped; read again from read_begin.
+ */
+bool eai_osal_seqlock_read_retry(const eai_osal_seqlock_t *sl, uint32_t seq);
+
+/**
+ * @brief Publish size bytes from src into the shared copy at data.
+ */
+void eai_osal_seqlock_write(eai_osal_seqlock_t *sl, void *data,
+			    const void *src, size_t size);
+
+/**
+ * @brief Take a consistent snapshot of size bytes at data into dst.
+ *
+ * @return Number of retries needed (0 when no write overlapped).
+ */
+uint32_t eai_osal_seqlock_read(const eai_osal_seqlock_t *sl, void *dst,
+			       const void *data, size_t size);
+
+#endif /* EAI_OSAL_SEQLOCK_H */
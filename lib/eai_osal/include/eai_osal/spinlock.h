@@ -0,0 +1,120 @@
+#ifndef EAI_OSAL_SPINLOCK_H
+#define EAI_OSAL_SPINLOCK_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Spinlock guarding one data structure, for short sections that must not
+ * sleep.
+ *
+ * Unlike eai_osal_critical_enter(), which is one lock for the whole
+ * system, each eai_osal_spinlock_t only excludes holders of that same
+ * lock. Hold it for a few dozen instructions at most and never block
+ * while holding it.
+ *
+ * Zephyr maps to k_spinlock (interrupts masked on the local CPU, spin on
+ * SMP). FreeRTOS maps to a portMUX_TYPE entered with the port's
+ * critical-nesting calls, which also mask interrupts and work from ISRs.
+ * POSIX spins on an atomic flag and yields the CPU after a bounded number
+ * of spins, since the holder may have been preempted.
+ *
+ * Locks nest only if they are always taken in the same order; a lock is
+ * not recursive.
+ */
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
+
+typedef struct { struct k_spinlock _impl; } eai_osal_spinlock_t;
+typedef k_spinlock_key_t eai_osal_spinlock_key_t;
+
+#define EAI_OSAL_SPINLOCK_INITIALIZER { }
+
+static inline void eai_osal_spinlock_init(eai_osal_spinlock_t *lock)
+{
+	*lock = (eai_osal_spinlock_t)EAI_OSAL_SPINLOCK_INITIALIZER;
+}
+
+static inline eai_osal_spinlock_key_t
+eai_osal_spin_lock(eai_osal_spinlock_t *lock)
+{
+	return k_spin_lock(&lock->_impl);
+}
+
+static inline void eai_osal_spin_unlock(eai_osal_spinlock_t *lock,
+					eai_osal_spinlock_key_t key)
+{
+	k_spin_unlock(&lock->_impl, key);
+}
+
+#elif defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+
+typedef struct { portMUX_TYPE _mux; } eai_osal_spinlock_t;
+typedef unsigned int eai_osal_spinlock_key_t;
+
+#define EAI_OSAL_SPINLOCK_INITIALIZER { portMUX_INITIALIZER_UNLOCKED }
+
+static inline void eai_osal_spinlock_init(eai_osal_spinlock_t *lock)
+{
+	portMUX_INITIALIZE(&lock->_mux);
+}
+
+static inline eai_osal_spinlock_key_t
+eai_osal_spin_lock(eai_osal_spinlock_t *lock)
+{
+	portENTER_CRITICAL_SAFE(&lock->_mux);
+	return 0; /* the port keeps the nesting count */
+}
+
+static inline void eai_osal_spin_unlock(eai_osal_spinlock_t *lock,
+					eai_osal_spinlock_key_t key)
+{
+	(void)key;
+	portEXIT_CRITICAL_SAFE(&lock->_mux);
+}
+
+#else /* POSIX */
+
+#include <sched.h>
+
+typedef struct { uint32_t _locked; } eai_osal_spinlock_t;
+typedef unsigned int eai_osal_spinlock_key_t;
+
+#define EAI_OSAL_SPINLOCK_INITIALIZER { 0 }
+
+/* Spins on a held lock before yielding the CPU to its holder */
+#ifndef EAI_OSAL_SPIN_LIMIT
+#define EAI_OSAL_SPIN_LIMIT 128
+#endif
+
+static inline void eai_osal_spinlock_init(eai_osal_spinlock_t *lock)
+{
+	__atomic_store_n(&lock->_locked, 0, __ATOMIC_RELAXED);
+}
+
+static inline eai_osal_spinlock_key_t
+eai_osal_spin_lock(eai_osal_spinlock_t *lock)
+{
+	uint32_t spins = 0;
+
+	/* Test-and-test-and-set: wait on a plain load, not on the RMW */
+	while (__atomic_exchange_n(&lock->_locked, 1, __ATOMIC_ACQUIRE) != 0) {
+		while (__atomic_load_n(&lock->_locked, __ATOMIC_RELAXED) != 0) {
+			if (++spins >= EAI_OSAL_SPIN_LIMIT) {
+				sched_yield();
+				spins = 0;
+			}
+		}
+	}
+	return 0;
+}
+
+static inline void eai_osal_spin_unlock(eai_osal_spinlock_t *lock,
+					eai_osal_spinlock_key_t key)
+{
+	(void)key;
+	__atomic_store_n(&lock->_locked, 0, __ATOMIC_RELEASE);
+}
+
+#endif
+
+#endif /* EAI_OSAL_SPINLOCK_H */
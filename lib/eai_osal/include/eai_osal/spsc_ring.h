@@ -0,0 +1,145 @@
+#ifndef EAI_OSAL_SPSC_RING_H
+#define EAI_OSAL_SPSC_RING_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Lock-free single-producer / single-consumer ring of fixed-size elements.
+ *
+ * Exactly one thread may push and exactly one thread may pop. Indices are
+ * published with acquire/release atomics, so the fast path takes no lock
+ * and makes no kernel call. Capacity must be a power of two.
+ *
+ * Blocking is optional: a ring created with blocking = true can park the
+ * consumer in eai_osal_spsc_ring_wait_readable() and the producer in
+ * eai_osal_spsc_ring_wait_writable(). The other side only touches the
+ * semaphore when a waiter is actually parked.
+ */
+
+/* Keep producer and consumer indices on separate cache lines on SMP hosts */
+#ifndef EAI_OSAL_SPSC_ALIGN
+#if defined(CONFIG_EAI_OSAL_BACKEND_POSIX)
+#define EAI_OSAL_SPSC_ALIGN 64
+#else
+#define EAI_OSAL_SPSC_ALIGN 4
+#endif
+#endif
+
+typedef struct {
+	uint8_t *_buf;
+	size_t _elem_size;
+	uint32_t _mask; /* capacity - 1 */
+	bool _blocking;
+	eai_osal_sem_t _readable;
+	eai_osal_sem_t _writable;
+
+	/* Producer side */
+	struct {
+		uint32_t head;       /* next slot to write (free-running) */
+		uint32_t tail_cache; /* last observed consumer index */
+		uint32_t waiting;    /* producer parked on _writable */
+	} _prod __attribute__((aligned(EAI_OSAL_SPSC_ALIGN)));
+
+	/* Consumer side */
+	struct {
+		uint32_t tail;       /* next slot to read (free-running) */
+		uint32_t head_cache; /* last observed producer index */
+		uint32_t waiting;    /* consumer parked on _readable */
+	} _cons __attribute__((aligned(EAI_OSAL_SPSC_ALIGN)));
+} eai_osal_spsc_ring_t;
+
+/**
+ * @brief Initialize a ring over caller-provided storage.
+ *
+ * @param ring      Ring to initialize.
+ * @param buffer    Storage for capacity * elem_size bytes.
+ * @param elem_size Element size in bytes.
+ * @param capacity  Element count, must be a power of two.
+ * @param blocking  Create semaphores for the wait_* calls.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_spsc_ring_init(eai_osal_spsc_ring_t *ring,
+					  void *buffer, size_t elem_size,
+					  uint32_t capacity, bool blocking);
+
+/**
+ * @brief Release semaphores owned by a blocking ring.
+ */
+eai_osal_status_t eai_osal_spsc_ring_destroy(eai_osal_spsc_ring_t *ring);
+
+/**
+ * @brief Push one element (producer only).
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_TIMEOUT if the ring is full.
+ */
+eai_osal_status_t eai_osal_spsc_ring_push(eai_osal_spsc_ring_t *ring,
+					  const void *elem);
+
+/**
+ * @brief Pop one element (consumer only).
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_TIMEOUT if the ring is empty.
+ */
+eai_osal_status_t eai_osal_spsc_ring_pop(eai_osal_spsc_ring_t *ring,
+					 void *elem);
+
+/**
+ * @brief Push up to n elements with at most two memcpy spans (producer only).
+ *
+ * @return Number of elements pushed (0..n).
+ */
+uint32_t eai_osal_spsc_ring_push_n(eai_osal_spsc_ring_t *ring,
+				   const void *elems, uint32_t n);
+
+/**
+ * @brief Pop up to n elements with at most two memcpy spans (consumer only).
+ *
+ * @return Number of elements popped (0..n).
+ */
+uint32_t eai_osal_spsc_ring_pop_n(eai_osal_spsc_ring_t *ring,
+				  void *elems, uint32_t n);
+
+/**
+ * @brief Read elements in place without copying (consumer only).
+ *
+ * Points *elems at the oldest element and returns how many follow it
+ * contiguously, at most max. Elements past the end of the buffer come
+ * from a second peek after eai_osal_spsc_ring_release().
+ *
+ * @return Number of contiguous elements readable (0..max).
+ */
+uint32_t eai_osal_spsc_ring_peek(eai_osal_spsc_ring_t *ring,
+				 const void **elems, uint32_t max);
+
+/**
+ * @brief Hand n peeked elements back to the producer (consumer only).
+ *
+ * n must not exceed what the last eai_osal_spsc_ring_peek() returned.
+ */
+void eai_osal_spsc_ring_release(eai_osal_spsc_ring_t *ring, uint32_t n);
+
+/** Elements currently readable. Exact for the consumer, a snapshot otherwise. */
+uint32_t eai_osal_spsc_ring_count(eai_osal_spsc_ring_t *ring);
+
+/** Free slots. Exact for the producer, a snapshot otherwise. */
+uint32_t eai_osal_spsc_ring_space(eai_osal_spsc_ring_t *ring);
+
+/**
+ * @brief Block the consumer until at least one element is readable.
+ *
+ * @return EAI_OSAL_OK when readable, EAI_OSAL_TIMEOUT on timeout,
+ *         EAI_OSAL_ERROR if the ring was not created with blocking.
+ */
+eai_osal_status_t eai_osal_spsc_ring_wait_readable(eai_osal_spsc_ring_t *ring,
+						   uint32_t timeout_ms);
+
+/**
+ * @brief Block the producer until at least one slot is free.
+ *
+ * @return EAI_OSAL_OK when writable, EAI_OSAL_TIMEOUT on timeout,
+ *         EAI_OSAL_ERROR if the ring was not created with blocking.
+ */
+eai_osal_status_t eai_osal_spsc_ring_wait_writable(eai_osal_spsc_ring_t *ring,
+						   uint32_t timeout_ms);
+
+#endif /* EAI_OSAL_SPSC_RING_H */
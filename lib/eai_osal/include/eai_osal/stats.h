@@ -0,0 +1,76 @@
+#ifndef EAI_OSAL_STATS_H
+#define EAI_OSAL_STATS_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Runtime contention and latency statistics.
+ *
+ * With EAI_OSAL_STATS enabled, every mutex, semaphore, queue and work
+ * queue keeps an eai_osal_stats_t (see types.h) that its lock/take/send
+ * and work dispatch paths update with relaxed atomics. Objects are
+ * counted from create on; naming one with EAI_OSAL_STATS_REGISTER() adds
+ * it to a registry that the query calls below (and the "osal stats"
+ * shell command) walk. destroy removes it again. The POSIX and FreeRTOS
+ * system work queues register themselves as "sysworkq" when started;
+ * Zephyr's does at boot.
+ *
+ * Waits are timed with the backend's cycle counter and are only exact up
+ * to its wrap period (tens of seconds on fast Zephyr targets).
+ *
+ * With EAI_OSAL_STATS disabled the objects carry no counters,
+ * EAI_OSAL_STATS_REGISTER() compiles away and the query calls do not
+ * exist.
+ */
+
+#if EAI_OSAL_STATS
+
+/**
+ * @brief Name an instrumented object and list it in the registry.
+ *
+ * @param obj  Created eai_osal_mutex_t, _sem_t, _queue_t or
+ *             _workqueue_t pointer.
+ * @param name Name to report, kept by reference. Registering again
+ *             only renames.
+ */
+#define EAI_OSAL_STATS_REGISTER(obj, name) \
+	eai_osal_stats_register(&(obj)->_stats, (name))
+
+void eai_osal_stats_register(eai_osal_stats_t *stats, const char *name);
+
+/** Called for each registered object with a snapshot of its counters. */
+typedef void (*eai_osal_stats_cb_t)(const eai_osal_stats_t *stats, void *arg);
+
+/**
+ * @brief Visit every registered object, most recently registered first.
+ *
+ * The callback runs without any lock held and may block (print to a
+ * shell, for example).
+ *
+ * @return Number of objects visited.
+ */
+uint32_t eai_osal_stats_foreach(eai_osal_stats_cb_t cb, void *arg);
+
+/**
+ * @brief Snapshot the counters of the registered object called name.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_ERROR if no object has that name.
+ */
+eai_osal_status_t eai_osal_stats_get(const char *name, eai_osal_stats_t *out);
+
+/** Zero the counters of every registered object. */
+void eai_osal_stats_reset(void);
+
+/** "mutex", "sem", "queue" or "workqueue". */
+const char *eai_osal_stats_kind_name(eai_osal_stats_kind_t kind);
+
+/** Upper bound in microseconds of histogram bucket i (UINT32_MAX for the last). */
+uint32_t eai_osal_stats_bucket_limit_us(uint32_t i);
+
+#else
+
+#define EAI_OSAL_STATS_REGISTER(obj, name) ((void)(obj), (void)(name))
+
+#endif /* EAI_OSAL_STATS */
+
+#endif /* EAI_OSAL_STATS_H */
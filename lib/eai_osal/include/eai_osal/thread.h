@@ -12,6 +12,24 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 					 uint8_t priority);
 eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 				       uint32_t timeout_ms);
+
+/**
+ * @brief Restrict a thread to a set of CPUs.
+ *
+ * POSIX applies it at once via pthread_setaffinity_np (Linux only).
+ * Zephyr needs CONFIG_SCHED_CPU_MASK and briefly suspends the target,
+ * so it cannot re-pin the calling thread. FreeRTOS needs SMP core
+ * affinity (configUSE_CORE_AFFINITY); ESP-IDF fixes a task's core at
+ * creation, so there it returns EAI_OSAL_ERROR.
+ *
+ * @param thread   Thread to pin, or NULL for the calling thread.
+ * @param cpu_mask Bit n set = may run on CPU n.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM if cpu_mask is 0,
+ *         EAI_OSAL_ERROR if the mask cannot be applied.
+ */
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask);
+
 void eai_osal_thread_sleep(uint32_t ms);
 void eai_osal_thread_yield(void);
 
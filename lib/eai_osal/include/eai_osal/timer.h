@@ -3,6 +3,12 @@
 
 #include <eai_osal/types.h>
 
+/** Where a timer's callback runs when it expires. */
+typedef enum {
+	EAI_OSAL_TIMER_DISPATCH_INLINE    = 0, /**< Timer context (default) */
+	EAI_OSAL_TIMER_DISPATCH_WORKQUEUE = 1, /**< Posted to a work queue */
+} eai_osal_timer_dispatch_t;
+
 eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 					eai_osal_timer_cb_t callback,
 					void *arg);
@@ -13,4 +19,37 @@ eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
 eai_osal_status_t eai_osal_timer_stop(eai_osal_timer_t *timer);
 bool eai_osal_timer_is_running(eai_osal_timer_t *timer);
 
+/**
+ * @brief Count expirations a periodic timer failed to deliver on time.
+ *
+ * Periodic timers run on an absolute grid (start + n * period), so late
+ * callbacks do not shift later ones. An expiry a full period or more
+ * behind the grid is an overrun: POSIX skips it, FreeRTOS delivers it
+ * back-to-back with the next one. With WORKQUEUE dispatch, an expiry
+ * that finds the previous one still queued is also an overrun (the two
+ * run once). Inline callbacks on Zephyr run from the timer ISR and
+ * never overrun.
+ *
+ * @param timer Timer.
+ * @return Overruns since the last eai_osal_timer_start(), 0 if timer is NULL.
+ */
+uint32_t eai_osal_timer_get_overruns(eai_osal_timer_t *timer);
+
+/**
+ * @brief Select how a timer's callback is dispatched.
+ *
+ * INLINE runs the callback in timer context (ISR on Zephyr, the timer
+ * daemon task on FreeRTOS, the shared timer service thread on POSIX).
+ * WORKQUEUE posts it to @p wq instead, so it may block or run long.
+ *
+ * @param timer Timer created with eai_osal_timer_create().
+ * @param mode  Dispatch mode.
+ * @param wq    Target work queue for WORKQUEUE mode, NULL = system queue.
+ *              Ignored for INLINE.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args.
+ */
+eai_osal_status_t eai_osal_timer_set_dispatch(eai_osal_timer_t *timer,
+					      eai_osal_timer_dispatch_t mode,
+					      eai_osal_workqueue_t *wq);
+
 #endif /* EAI_OSAL_TIMER_H */
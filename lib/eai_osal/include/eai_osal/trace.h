@@ -0,0 +1,119 @@
+#ifndef EAI_OSAL_TRACE_H
+#define EAI_OSAL_TRACE_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Compile-time trace points.
+ *
+ * With EAI_OSAL_TRACE enabled, the backends record thread start/exit,
+ * semaphore give/take, queue send/receive, work item start/end and timer
+ * expiry as fixed 24-byte records in a per-CPU ring. Zephyr also records
+ * every context switch (CONFIG_EAI_OSAL_TRACE_SWITCH); on FreeRTOS, call
+ * eai_osal_trace_thread_switched_in() from the port's
+ * traceTASK_SWITCHED_IN() hook to get the same.
+ *
+ * Recording is lock-free and ISR-safe: a slot is claimed with one atomic
+ * add on the CPU's ring head and published through a per-slot sequence,
+ * so the cost is a timestamp read plus a few stores. The rings overwrite
+ * their oldest records; eai_osal_trace_dump() streams what is left, oldest
+ * first per CPU, for tools/osal_trace_convert to turn into Chrome/Perfetto
+ * JSON or CTF.
+ *
+ * Timestamps are eai_osal_time_get_ticks() values, so their resolution is
+ * the backend tick (microseconds on POSIX). Records in the same tick keep
+ * their per-CPU order.
+ *
+ * With EAI_OSAL_TRACE disabled every trace point compiles away and the
+ * calls below do not exist.
+ */
+
+typedef enum {
+	EAI_OSAL_TRACE_NONE = 0,        /* empty or overwritten slot */
+	EAI_OSAL_TRACE_THREAD_SWITCH,   /* thread now runs on this CPU */
+	EAI_OSAL_TRACE_THREAD_START,    /* obj = entry function */
+	EAI_OSAL_TRACE_THREAD_EXIT,     /* obj = entry function */
+	EAI_OSAL_TRACE_SEM_GIVE,        /* obj = semaphore */
+	EAI_OSAL_TRACE_SEM_TAKE,        /* obj = semaphore */
+	EAI_OSAL_TRACE_QUEUE_SEND,      /* obj = queue, arg = messages */
+	EAI_OSAL_TRACE_QUEUE_RECV,      /* obj = queue, arg = messages */
+	EAI_OSAL_TRACE_WORK_START,      /* obj = work item */
+	EAI_OSAL_TRACE_WORK_END,        /* obj = work item */
+	EAI_OSAL_TRACE_TIMER_FIRE,      /* obj = timer, before its callback */
+	EAI_OSAL_TRACE_USER = 0x80,     /* application events from here up */
+} eai_osal_trace_event_t;
+
+/**
+ * One trace record, as stored and as dumped (native byte order).
+ *
+ * thread and obj are the low 32 bits of the thread handle and object
+ * address; POSIX threads get small sequential ids instead.
+ */
+typedef struct {
+	uint64_t ts;     /* eai_osal_time_get_ticks() */
+	uint32_t seq;    /* position in its CPU ring, from 1 */
+	uint32_t thread; /* current thread */
+	uint32_t obj;    /* object the event is about */
+	uint16_t arg;    /* event-specific */
+	uint8_t event;   /* eai_osal_trace_event_t */
+	uint8_t cpu;
+} eai_osal_trace_rec_t;
+
+/** Dump header, followed by count eai_osal_trace_rec_t. */
+typedef struct {
+	uint32_t magic;    /* EAI_OSAL_TRACE_MAGIC */
+	uint16_t version;  /* EAI_OSAL_TRACE_VERSION */
+	uint16_t rec_size; /* sizeof(eai_osal_trace_rec_t) */
+	uint32_t ticks_hz; /* timestamp rate */
+	uint32_t count;
+} eai_osal_trace_hdr_t;
+
+#define EAI_OSAL_TRACE_MAGIC   0x52544f45u /* "EOTR" little-endian */
+#define EAI_OSAL_TRACE_VERSION 1
+
+#if EAI_OSAL_TRACE
+
+/**
+ * @brief Record an event. ISR-safe.
+ *
+ * @param event eai_osal_trace_event_t, EAI_OSAL_TRACE_USER or above for
+ *              application events.
+ * @param obj   Object the event is about (only its address is kept).
+ * @param arg   Free-form value shown with the event.
+ */
+void eai_osal_trace_record(uint8_t event, const void *obj, uint16_t arg);
+
+#define EAI_OSAL_TRACE_EVENT(event, obj, arg) \
+	eai_osal_trace_record((event), (obj), (arg))
+
+/** Record that the current thread was just switched in (scheduler hook). */
+void eai_osal_trace_thread_switched_in(void);
+
+/** Start (default) or stop recording. Records already taken are kept. */
+void eai_osal_trace_enable(bool enable);
+
+/** Drop every record. Call with recording stopped. */
+void eai_osal_trace_clear(void);
+
+/** Receives the dump in pieces; return non-zero to stop early. */
+typedef int (*eai_osal_trace_write_t)(const void *data, size_t len, void *ctx);
+
+/**
+ * @brief Stream the header and all records to write.
+ *
+ * Recording may continue meanwhile; slots overwritten during the dump are
+ * written as EAI_OSAL_TRACE_NONE so the count stays right. Stop recording
+ * first for a clean cut.
+ *
+ * @return Number of records written (including NONE ones).
+ */
+uint32_t eai_osal_trace_dump(eai_osal_trace_write_t write, void *ctx);
+
+#else
+
+#define EAI_OSAL_TRACE_EVENT(event, obj, arg) \
+	((void)(event), (void)(obj), (void)(arg))
+
+#endif /* EAI_OSAL_TRACE */
+
+#endif /* EAI_OSAL_TRACE_H */
@@ -16,7 +16,10 @@ typedef enum {
 #define EAI_OSAL_WAIT_FOREVER UINT32_MAX
 #define EAI_OSAL_NO_WAIT      0
 
-/** Timer callback. Invoked from timer context (ISR on some backends). */
+/**
+ * Timer callback. Invoked from timer context (ISR on some backends), or
+ * from a work queue thread with EAI_OSAL_TIMER_DISPATCH_WORKQUEUE.
+ */
 typedef void (*eai_osal_timer_cb_t)(void *arg);
 
 /** Thread entry point. */
@@ -25,6 +28,69 @@ typedef void (*eai_osal_thread_entry_t)(void *arg);
 /** Work item callback. Invoked from the work queue's thread context. */
 typedef void (*eai_osal_work_cb_t)(void *arg);
 
+/** Upper bound on priority lanes per work queue. */
+#ifndef EAI_OSAL_WQ_MAX_LANES
+#define EAI_OSAL_WQ_MAX_LANES 4
+#endif
+
+/*
+ * Runtime statistics (CONFIG_EAI_OSAL_STATS on Zephyr, -DEAI_OSAL_STATS=1
+ * elsewhere). When enabled, mutexes, semaphores, queues and work queues
+ * embed an eai_osal_stats_t; see eai_osal/stats.h.
+ */
+#ifndef EAI_OSAL_STATS
+#if defined(CONFIG_EAI_OSAL_STATS)
+#define EAI_OSAL_STATS 1
+#else
+#define EAI_OSAL_STATS 0
+#endif
+#endif
+
+/*
+ * Trace points (CONFIG_EAI_OSAL_TRACE on Zephyr, -DEAI_OSAL_TRACE=1
+ * elsewhere); see eai_osal/trace.h.
+ */
+#ifndef EAI_OSAL_TRACE
+#if defined(CONFIG_EAI_OSAL_TRACE)
+#define EAI_OSAL_TRACE 1
+#else
+#define EAI_OSAL_TRACE 0
+#endif
+#endif
+
+/** Wait/execution time histogram buckets: <10 us, <100 us, ... >=100 ms. */
+#define EAI_OSAL_STATS_HIST_BUCKETS 6
+
+typedef enum {
+	EAI_OSAL_STATS_MUTEX,
+	EAI_OSAL_STATS_SEM,
+	EAI_OSAL_STATS_QUEUE,
+	EAI_OSAL_STATS_WORKQUEUE,
+} eai_osal_stats_kind_t;
+
+/**
+ * Counters of one instrumented object. Times are in microseconds.
+ *
+ * Mutex, semaphore: count is successful lock/take calls, contended those
+ * that found the object unavailable and had to wait; hist and max_us
+ * describe the wait (uncontended calls land in bucket 0).
+ * Queue: the same for eai_osal_queue_send() waiting for space, plus
+ * high_water, the most messages ever waiting at once (any send path).
+ * Work queue: count is items run; hist and max_us describe callback
+ * execution time; high_water is the most items ever waiting at once
+ * (not tracked on Zephyr, whose k_work_q keeps no depth).
+ */
+typedef struct eai_osal_stats {
+	const char *name; /* NULL until registered */
+	eai_osal_stats_kind_t kind;
+	uint32_t count;
+	uint32_t contended;
+	uint32_t hist[EAI_OSAL_STATS_HIST_BUCKETS];
+	uint32_t max_us;
+	uint32_t high_water;
+	struct eai_osal_stats *_next; /* registry link */
+} eai_osal_stats_t;
+
 /* Backend type dispatch — pulls in eai_osal_mutex_t, eai_osal_sem_t, etc. */
 #if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
 #include "../../src/zephyr/types.h"
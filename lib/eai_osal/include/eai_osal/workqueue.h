@@ -15,11 +15,38 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 				     eai_osal_work_cb_t callback,
 				     void *arg);
 
+/*
+ * Work items follow Zephyr k_work semantics on every backend: the queue
+ * holds a reference to the item, not a copy, so an item must stay valid
+ * until it has run or eai_osal_work_cancel_sync() has returned.
+ * Submitting an item that is still queued is a no-op, so a queue never
+ * holds more entries than there are distinct items. An item that is
+ * running may be queued again.
+ */
+
+/**
+ * @brief Set the priority lane a work item is queued on.
+ *
+ * Lanes only matter on work queues created with
+ * eai_osal_workqueue_create_lanes(): a worker always takes the oldest
+ * item from the highest non-empty lane. Higher lane = more urgent, like
+ * thread priorities. A lane beyond the queue's last lane is clamped to
+ * it. Items start on lane 0; an item that is already queued keeps its
+ * lane until it runs.
+ *
+ * @param work Work item.
+ * @param lane Lane index (0 = least urgent).
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if work is NULL or
+ *         lane >= EAI_OSAL_WQ_MAX_LANES.
+ */
+eai_osal_status_t eai_osal_work_set_lane(eai_osal_work_t *work, uint8_t lane);
+
 /**
  * @brief Submit work to the system work queue.
  *
  * @param work Work item to submit.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if queued or already queued,
+ *         EAI_OSAL_ERROR (or EAI_OSAL_TIMEOUT) if the queue is full.
  */
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work);
 
@@ -28,11 +55,46 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work);
  *
  * @param work Work item to submit.
  * @param wq   Target work queue.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if queued or already queued,
+ *         EAI_OSAL_ERROR (or EAI_OSAL_TIMEOUT) if the queue is full.
  */
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 					  eai_osal_workqueue_t *wq);
 
+/**
+ * @brief Check whether a work item is queued or running.
+ */
+bool eai_osal_work_is_pending(eai_osal_work_t *work);
+
+/**
+ * @brief Wait until a work item is neither queued nor running.
+ *
+ * Must not be called from the item's own callback.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if work is NULL.
+ */
+eai_osal_status_t eai_osal_work_flush(eai_osal_work_t *work);
+
+/**
+ * @brief Cancel a queued work item without waiting.
+ *
+ * An invocation already running is not interrupted.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if work is NULL.
+ */
+eai_osal_status_t eai_osal_work_cancel(eai_osal_work_t *work);
+
+/**
+ * @brief Cancel a work item and wait until the work queue is done with it.
+ *
+ * On return the item is not queued, not running and not referenced by
+ * any queue, so it may be freed or re-initialized. Called from the item's
+ * own callback, it does not wait for that invocation to finish.
+ *
+ * @return EAI_OSAL_OK, or EAI_OSAL_INVALID_PARAM if work is NULL.
+ */
+eai_osal_status_t eai_osal_work_cancel_sync(eai_osal_work_t *work);
+
 /**
  * @brief Initialize a delayed work item.
  *
@@ -91,4 +153,82 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 					    size_t stack_size,
 					    uint8_t priority);
 
+/** Storage for a work queue created with eai_osal_workqueue_create_lanes(). */
+#define EAI_OSAL_WQ_BUF_DEFINE(name, n_lanes, depth) \
+	static void *name[(n_lanes) * (depth)]
+
+/**
+ * @brief Create a work queue with caller-sized priority lanes.
+ *
+ * Like eai_osal_workqueue_create(), but queue storage comes from the
+ * caller and is split into n_lanes lanes of depth slots each. See
+ * eai_osal_work_set_lane() for how items pick a lane. Plain submits and
+ * delayed work land on lane 0 unless the item says otherwise.
+ *
+ * Zephyr's k_work_q is an intrusive list with no depth limit and a single
+ * FIFO, so there buf and depth are unused and every lane shares that
+ * FIFO; give latency-critical work its own higher-priority queue instead.
+ *
+ * @param wq         Work queue to initialize.
+ * @param name       Thread name (for debug).
+ * @param stack      Stack defined via EAI_OSAL_THREAD_STACK_DEFINE.
+ * @param stack_size Stack size via EAI_OSAL_THREAD_STACK_SIZEOF.
+ * @param priority   OSAL priority (0-31, higher = higher priority).
+ * @param buf        Storage defined via EAI_OSAL_WQ_BUF_DEFINE.
+ * @param depth      Slots per lane (>= 1).
+ * @param n_lanes    Number of lanes (1..EAI_OSAL_WQ_MAX_LANES).
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args,
+ *         EAI_OSAL_ERROR or EAI_OSAL_NO_MEMORY if the thread cannot start.
+ */
+eai_osal_status_t eai_osal_workqueue_create_lanes(eai_osal_workqueue_t *wq,
+						  const char *name,
+						  void *stack,
+						  size_t stack_size,
+						  uint8_t priority,
+						  void *buf,
+						  uint32_t depth,
+						  uint8_t n_lanes);
+
+/**
+ * @brief Most items ever waiting on one lane of a work queue.
+ *
+ * Use it to size depth: a high-water mark equal to depth means submits
+ * have been rejected. Pools count all their deques as lane 0. Always 0
+ * on Zephyr, whose queue has no slots to run out of.
+ *
+ * @param wq   Work queue.
+ * @param lane Lane index.
+ * @return High-water mark, or 0 if wq is NULL or lane is out of range.
+ */
+uint32_t eai_osal_workqueue_high_water(eai_osal_workqueue_t *wq, uint8_t lane);
+
+/**
+ * @brief Create a work queue served by a pool of worker threads.
+ *
+ * The result is an ordinary eai_osal_workqueue_t: eai_osal_work_submit_to()
+ * and eai_osal_dwork_submit_to() work unchanged, but items may run
+ * concurrently on different workers, so there is no ordering between them.
+ *
+ * POSIX gives each worker its own deque and lets idle workers steal from
+ * busy ones. FreeRTOS workers share one queue, so any idle worker takes the
+ * next item. Zephyr runs one k_work_q per worker and spreads submits
+ * round-robin (queued k_work items cannot migrate between queues).
+ *
+ * @param wq        Work queue to initialize.
+ * @param name      Thread name prefix (for debug).
+ * @param workers   Storage for n_workers workers, owned by the pool.
+ * @param n_workers Number of worker threads (>= 1).
+ * @param priority  OSAL priority (0-31, higher = higher priority).
+ * @param cpus      Optional per-worker CPU to pin to (n_workers entries,
+ *                  -1 = any CPU), or NULL to leave every worker unpinned.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args,
+ *         EAI_OSAL_ERROR or EAI_OSAL_NO_MEMORY if a worker cannot start.
+ */
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_t *wq,
+						 const char *name,
+						 eai_osal_wq_worker_t *workers,
+						 uint32_t n_workers,
+						 uint8_t priority,
+						 const int *cpus);
+
 #endif /* EAI_OSAL_WORKQUEUE_H */
@@ -0,0 +1,104 @@
+#include <eai_osal/arena.h>
+#include <string.h>
+
+/*
+ * Backend-independent bump allocator.
+ *
+ * Alignment is applied to the absolute address, not the offset, so a
+ * buffer with any alignment works. Padding skipped to reach alignment
+ * counts as used until the next release.
+ */
+
+static void poison(eai_osal_arena_t *arena, size_t from, size_t to, int c)
+{
+#if EAI_OSAL_ARENA_POISON
+	memset(arena->_buf + from, c, to - from);
+#else
+	(void)arena;
+	(void)from;
+	(void)to;
+	(void)c;
+#endif
+}
+
+eai_osal_status_t eai_osal_arena_init(eai_osal_arena_t *arena, void *buffer,
+				      size_t size)
+{
+	if (arena == NULL || buffer == NULL || size == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	arena->_buf = (uint8_t *)buffer;
+	arena->_size = size;
+	arena->_used = 0;
+	arena->_hwm = 0;
+	arena->_failed = 0;
+	poison(arena, 0, size, EAI_OSAL_ARENA_POISON_FREE);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_arena_alloc(eai_osal_arena_t *arena, size_t size,
+				       size_t align, void **ptr)
+{
+	if (arena == NULL || ptr == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (align == 0) {
+		align = EAI_OSAL_ARENA_ALIGN;
+	}
+	if ((align & (align - 1)) != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uintptr_t base = (uintptr_t)arena->_buf;
+	uintptr_t cur = base + arena->_used;
+	size_t start = (size_t)(((cur + align - 1) & ~(uintptr_t)(align - 1)) -
+				base);
+
+	if (start > arena->_size || size > arena->_size - start) {
+		arena->_failed++;
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	arena->_used = start + size;
+	if (arena->_used > arena->_hwm) {
+		arena->_hwm = arena->_used;
+	}
+	poison(arena, start, arena->_used, EAI_OSAL_ARENA_POISON_ALLOC);
+	*ptr = arena->_buf + start;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_arena_mark_t eai_osal_arena_mark(const eai_osal_arena_t *arena)
+{
+	return arena != NULL ? arena->_used : 0;
+}
+
+eai_osal_status_t eai_osal_arena_release(eai_osal_arena_t *arena,
+					 eai_osal_arena_mark_t mark)
+{
+	if (arena == NULL || mark > arena->_used) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	poison(arena, mark, arena->_used, EAI_OSAL_ARENA_POISON_FREE);
+	arena->_used = mark;
+	return EAI_OSAL_OK;
+}
+
+void eai_osal_arena_reset(eai_osal_arena_t *arena)
+{
+	eai_osal_arena_release(arena, 0);
+}
+
+eai_osal_status_t eai_osal_arena_get_stats(const eai_osal_arena_t *arena,
+					   eai_osal_arena_stats_t *stats)
+{
+	if (arena == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	stats->size = arena->_size;
+	stats->used = arena->_used;
+	stats->high_water = arena->_hwm;
+	stats->failed = arena->_failed;
+	return EAI_OSAL_OK;
+}
@@ -31,6 +31,7 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	xEventGroupSetBits(event->_handle, (EventBits_t)bits);
+	osal_poll_notify();
 	return EAI_OSAL_OK;
 }
 
@@ -2,6 +2,7 @@
 #define EAI_OSAL_FREERTOS_INTERNAL_H
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
 #include <eai_osal/types.h>
 
 static inline TickType_t osal_ticks(uint32_t ms)
@@ -27,4 +28,26 @@ static inline UBaseType_t osal_priority(uint8_t prio)
 	return 1 + (prio * (configMAX_PRIORITIES - 2)) / 31;
 }
 
+/*
+ * eai_osal_poll() hub, see poll.c. Call osal_poll_notify() after making a
+ * queue, semaphore or event ready.
+ */
+extern EventBits_t osal_poll_parked;
+void osal_poll_wake(void);
+
+static inline void osal_poll_notify(void)
+{
+	if (__atomic_load_n(&osal_poll_parked, __ATOMIC_SEQ_CST) != 0) {
+		osal_poll_wake();
+	}
+}
+
+/* eai_osal_work_t._state bits, owned by workqueue.c */
+#define WORK_QUEUED  (1U << 0) /* will run; cleared by cancel */
+#define WORK_RUNNING (1U << 1) /* callback executing */
+#define WORK_INQ     (1U << 2) /* a queue slot still points at the item */
+
+#include "../stats_internal.h"
+#include "../trace_internal.h"
+
 #endif /* EAI_OSAL_FREERTOS_INTERNAL_H */
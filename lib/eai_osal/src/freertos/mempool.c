@@ -0,0 +1,111 @@
+#include <eai_osal/mempool.h>
+#include "internal.h"
+
+/*
+ * Fixed-block pool — a singly linked free list threaded through the free
+ * blocks, guarded by a per-pool spinlock. The _SAFE critical section
+ * variants work from both task and ISR context, and the hold time is a
+ * couple of pointer moves, so one pool never stalls the other core for
+ * long. (Xtensa has no 64-bit CAS for a tagged lock-free list.)
+ */
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  void *buffer, size_t block_size,
+					  uint32_t num_blocks)
+{
+	if (pool == NULL || buffer == NULL || num_blocks == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (block_size == 0 || block_size % EAI_OSAL_MEMPOOL_ALIGN != 0 ||
+	    (uintptr_t)buffer % EAI_OSAL_MEMPOOL_ALIGN != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_buf = (uint8_t *)buffer;
+	pool->_block_size = block_size;
+	pool->_num_blocks = num_blocks;
+	pool->_free = NULL;
+	for (uint32_t i = num_blocks; i-- > 0;) {
+		void **blk = (void **)(pool->_buf + (size_t)i * block_size);
+
+		*blk = pool->_free;
+		pool->_free = blk;
+	}
+	portMUX_INITIALIZE(&pool->_lock);
+	pool->_in_use = 0;
+	pool->_peak = 0;
+	pool->_failed = 0;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool,
+					 void **block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	portENTER_CRITICAL_SAFE(&pool->_lock);
+	void **blk = pool->_free;
+
+	if (blk == NULL) {
+		pool->_failed++;
+		portEXIT_CRITICAL_SAFE(&pool->_lock);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	pool->_free = *blk;
+	if (++pool->_in_use > pool->_peak) {
+		pool->_peak = pool->_in_use;
+	}
+	portEXIT_CRITICAL_SAFE(&pool->_lock);
+
+	*block = blk;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool,
+					void *block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uintptr_t off = (uintptr_t)block - (uintptr_t)pool->_buf;
+
+	if ((uintptr_t)block < (uintptr_t)pool->_buf ||
+	    off >= (uintptr_t)pool->_block_size * pool->_num_blocks ||
+	    off % pool->_block_size != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	portENTER_CRITICAL_SAFE(&pool->_lock);
+	*(void **)block = pool->_free;
+	pool->_free = block;
+	pool->_in_use--;
+	portEXIT_CRITICAL_SAFE(&pool->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	portENTER_CRITICAL_SAFE(&pool->_lock);
+	stats->num_blocks = pool->_num_blocks;
+	stats->in_use = pool->_in_use;
+	stats->peak = pool->_peak;
+	stats->failed = pool->_failed;
+	portEXIT_CRITICAL_SAFE(&pool->_lock);
+	return EAI_OSAL_OK;
+}
@@ -10,6 +10,9 @@ eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
 	if (mutex->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_init(&mutex->_stats, EAI_OSAL_STATS_MUTEX);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -18,6 +21,9 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&mutex->_stats);
+#endif
 	if (mutex->_handle != NULL) {
 		vSemaphoreDelete(mutex->_handle);
 		mutex->_handle = NULL;
@@ -30,10 +36,29 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	if (xSemaphoreTakeRecursive(mutex->_handle, 0) == pdTRUE) {
+		osal_stats_acquired(&mutex->_stats, false, 0);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	uint32_t start = osal_stats_cycles();
+
+	if (xSemaphoreTakeRecursive(mutex->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
+		osal_stats_acquired(&mutex->_stats, true,
+				    osal_stats_cycles() - start);
+		return EAI_OSAL_OK;
+	}
+	return EAI_OSAL_TIMEOUT;
+#else
 	if (xSemaphoreTakeRecursive(mutex->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
+#endif
 }
 
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
@@ -0,0 +1,147 @@
+#include <eai_osal/poll.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "internal.h"
+
+/*
+ * FreeRTOS poll — one shared event group, one bit per parked poller.
+ *
+ * Queue sets are the obvious mapping, but a queue can only belong to one
+ * set and must be empty when it is added, so they cannot serve ad-hoc
+ * polls on objects other threads also use. Event groups cannot join a
+ * set at all. Instead a poller claims a bit of a static event group,
+ * clears it, scans its descriptors and waits on the bit. Every send,
+ * give and set calls osal_poll_notify(), which sets all claimed bits
+ * while any poller is parked; woken pollers re-scan.
+ *
+ * The bit is cleared before the scan, so a notify that lands after the
+ * scan leaves it set and the wait returns at once.
+ */
+
+#if defined(configUSE_16_BIT_TICKS) && configUSE_16_BIT_TICKS
+#define POLL_SLOTS 8
+#else
+#define POLL_SLOTS 24
+#endif
+
+EventBits_t osal_poll_parked; /* bits claimed by parked pollers */
+
+static StaticEventGroup_t hub_buf;
+static EventGroupHandle_t hub;
+static portMUX_TYPE hub_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void osal_poll_wake(void)
+{
+	xEventGroupSetBits(hub, __atomic_load_n(&osal_poll_parked,
+						__ATOMIC_RELAXED));
+}
+
+static EventBits_t claim_slot(void)
+{
+	EventBits_t bit = 0;
+
+	taskENTER_CRITICAL(&hub_lock);
+	if (hub == NULL) {
+		hub = xEventGroupCreateStatic(&hub_buf);
+	}
+	for (int i = 0; i < POLL_SLOTS; i++) {
+		if ((osal_poll_parked & ((EventBits_t)1 << i)) == 0) {
+			bit = (EventBits_t)1 << i;
+			__atomic_fetch_or(&osal_poll_parked, bit, __ATOMIC_SEQ_CST);
+			break;
+		}
+	}
+	taskEXIT_CRITICAL(&hub_lock);
+	return bit;
+}
+
+static void release_slot(EventBits_t bit)
+{
+	taskENTER_CRITICAL(&hub_lock);
+	__atomic_fetch_and(&osal_poll_parked, ~bit, __ATOMIC_RELAXED);
+	taskEXIT_CRITICAL(&hub_lock);
+}
+
+static bool scan(eai_osal_poll_event_t *events, uint32_t n)
+{
+	bool any = false;
+
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_poll_event_t *ev = &events[i];
+
+		switch (ev->type) {
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			ev->ready = uxQueueMessagesWaiting(ev->obj.queue->_handle) > 0;
+			break;
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			ev->ready = uxSemaphoreGetCount(ev->obj.sem->_handle) > 0;
+			break;
+		default:
+			ev->ready = (xEventGroupGetBits(ev->obj.event->_handle) &
+				     (EventBits_t)ev->bits) != 0;
+			break;
+		}
+		any |= ev->ready;
+	}
+	return any;
+}
+
+static bool valid(const eai_osal_poll_event_t *events, uint32_t n)
+{
+	if (events == NULL || n == 0 || n > EAI_OSAL_POLL_MAX_EVENTS) {
+		return false;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		if (events[i].obj.queue == NULL ||
+		    events[i].type > EAI_OSAL_POLL_EVENT_BITS ||
+		    (events[i].type == EAI_OSAL_POLL_EVENT_BITS &&
+		     events[i].bits == 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, uint32_t n,
+				uint32_t timeout_ms)
+{
+	if (!valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (scan(events, n)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	EventBits_t bit = claim_slot();
+
+	if (bit == 0) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	TimeOut_t timeout;
+	TickType_t wait = osal_ticks(timeout_ms);
+	eai_osal_status_t rc;
+
+	vTaskSetTimeOutState(&timeout);
+	for (;;) {
+		xEventGroupClearBits(hub, bit);
+		if (scan(events, n)) {
+			rc = EAI_OSAL_OK;
+			break;
+		}
+		if (xTaskCheckForTimeOut(&timeout, &wait) != pdFALSE) {
+			rc = EAI_OSAL_TIMEOUT;
+			break;
+		}
+		xEventGroupWaitBits(hub, bit, pdTRUE, pdFALSE, wait);
+	}
+
+	release_slot(bit);
+	return rc;
+}
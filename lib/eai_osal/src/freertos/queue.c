@@ -15,6 +15,13 @@ eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size
 	if (queue->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	queue->_msg_size = msg_size;
+	queue->_stage = NULL;
+	queue->_tx_timeout = EAI_OSAL_NO_WAIT;
+	queue->_busy = 0;
+#if EAI_OSAL_STATS
+	osal_stats_init(&queue->_stats, EAI_OSAL_STATS_QUEUE);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -23,10 +30,15 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&queue->_stats);
+#endif
 	if (queue->_handle != NULL) {
 		vQueueDelete(queue->_handle);
 		queue->_handle = NULL;
 	}
+	vPortFree(queue->_stage);
+	queue->_stage = NULL;
 	return EAI_OSAL_OK;
 }
 
@@ -36,10 +48,34 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	bool contended = false;
+	uint32_t start = 0;
+	BaseType_t ok = xQueueSend(queue->_handle, msg, 0);
+
+	if (ok != pdTRUE && timeout_ms != EAI_OSAL_NO_WAIT) {
+		contended = true;
+		start = osal_stats_cycles();
+		ok = xQueueSend(queue->_handle, msg, osal_ticks(timeout_ms));
+	}
+	if (ok == pdTRUE) {
+		osal_stats_acquired(&queue->_stats, contended,
+				    contended ? osal_stats_cycles() - start : 0);
+		osal_stats_depth(&queue->_stats,
+				 uxQueueMessagesWaiting(queue->_handle));
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+		osal_poll_notify();
+		return EAI_OSAL_OK;
+	}
+	return EAI_OSAL_TIMEOUT;
+#else
 	if (xQueueSend(queue->_handle, msg, osal_ticks(timeout_ms)) == pdTRUE) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+		osal_poll_notify();
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
+#endif
 }
 
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
@@ -49,7 +85,199 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	if (xQueueReceive(queue->_handle, msg, osal_ticks(timeout_ms)) == pdTRUE) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, 1);
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
 }
+
+/*
+ * FreeRTOS has no batch send/receive. Wait for the first message only,
+ * then move the rest with a zero timeout while the scheduler is
+ * suspended, so a woken peer runs once after the whole batch instead of
+ * once per message.
+ */
+uint32_t eai_osal_queue_send_many(eai_osal_queue_t *queue, const void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	const uint8_t *src = msgs;
+	uint32_t sent = 0;
+
+	vTaskSuspendAll();
+	if (uxQueueSpacesAvailable(queue->_handle) == 0) {
+		/* Must be able to block: wait with the scheduler running */
+		xTaskResumeAll();
+		if (xQueueSend(queue->_handle, src, osal_ticks(timeout_ms)) != pdTRUE) {
+			return 0;
+		}
+		sent = 1;
+		vTaskSuspendAll();
+	}
+	while (sent < n &&
+	       xQueueSend(queue->_handle, src + sent * queue->_msg_size, 0) == pdTRUE) {
+		sent++;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, (uint16_t)sent);
+#if EAI_OSAL_STATS
+	osal_stats_depth(&queue->_stats, uxQueueMessagesWaiting(queue->_handle));
+#endif
+	xTaskResumeAll();
+	osal_poll_notify();
+	return sent;
+}
+
+uint32_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	uint8_t *dst = msgs;
+	uint32_t received = 0;
+
+	vTaskSuspendAll();
+	if (uxQueueMessagesWaiting(queue->_handle) == 0) {
+		xTaskResumeAll();
+		if (xQueueReceive(queue->_handle, dst, osal_ticks(timeout_ms)) != pdTRUE) {
+			return 0;
+		}
+		received = 1;
+		vTaskSuspendAll();
+	}
+	while (received < n &&
+	       xQueueReceive(queue->_handle, dst + received * queue->_msg_size, 0) == pdTRUE) {
+		received++;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, (uint16_t)received);
+	xTaskResumeAll();
+	return received;
+}
+
+/*
+ * Zero-copy emulation — the FreeRTOS queue owns its storage, so
+ * reserve/peek hand out a staging message (tx half, rx half) and
+ * commit/peek do the one copy.
+ */
+
+#define OSAL_QUEUE_TX (1U << 0)
+#define OSAL_QUEUE_RX (1U << 1)
+
+static bool claim(eai_osal_queue_t *queue, uint32_t side)
+{
+	return (__atomic_fetch_or(&queue->_busy, side, __ATOMIC_ACQUIRE) & side) == 0;
+}
+
+static bool unclaim(eai_osal_queue_t *queue, uint32_t side)
+{
+	return (__atomic_fetch_and(&queue->_busy, ~side, __ATOMIC_RELEASE) & side) != 0;
+}
+
+static uint8_t *stage(eai_osal_queue_t *queue, uint32_t side)
+{
+	uint8_t *buf = __atomic_load_n(&queue->_stage, __ATOMIC_ACQUIRE);
+
+	if (buf == NULL) {
+		uint8_t *expected = NULL;
+
+		buf = pvPortMalloc(2 * queue->_msg_size);
+		if (buf == NULL) {
+			return NULL;
+		}
+		/* Lost a race with the other side — use the winner's buffer */
+		if (!__atomic_compare_exchange_n(&queue->_stage, &expected, buf,
+						 false, __ATOMIC_ACQ_REL,
+						 __ATOMIC_ACQUIRE)) {
+			vPortFree(buf);
+			buf = expected;
+		}
+	}
+	return side == OSAL_QUEUE_TX ? buf : buf + queue->_msg_size;
+}
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!claim(queue, OSAL_QUEUE_TX)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint8_t *buf = stage(queue, OSAL_QUEUE_TX);
+
+	if (buf == NULL) {
+		unclaim(queue, OSAL_QUEUE_TX);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT &&
+	    uxQueueSpacesAvailable(queue->_handle) == 0) {
+		unclaim(queue, OSAL_QUEUE_TX);
+		return EAI_OSAL_TIMEOUT;
+	}
+	queue->_tx_timeout = timeout_ms;
+	*slot = buf;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if ((__atomic_load_n(&queue->_busy, __ATOMIC_ACQUIRE) & OSAL_QUEUE_TX) == 0) {
+		return EAI_OSAL_ERROR;
+	}
+
+	BaseType_t ok = xQueueSend(queue->_handle, queue->_stage,
+				   osal_ticks(queue->_tx_timeout));
+
+	unclaim(queue, OSAL_QUEUE_TX);
+	if (ok != pdTRUE) {
+		return EAI_OSAL_TIMEOUT;
+	}
+#if EAI_OSAL_STATS
+	osal_stats_depth(&queue->_stats, uxQueueMessagesWaiting(queue->_handle));
+#endif
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+	osal_poll_notify();
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **msg,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || msg == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!claim(queue, OSAL_QUEUE_RX)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint8_t *buf = stage(queue, OSAL_QUEUE_RX);
+
+	if (buf == NULL) {
+		unclaim(queue, OSAL_QUEUE_RX);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	if (xQueueReceive(queue->_handle, buf, osal_ticks(timeout_ms)) != pdTRUE) {
+		unclaim(queue, OSAL_QUEUE_RX);
+		return EAI_OSAL_TIMEOUT;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, 1);
+	*msg = buf;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return unclaim(queue, OSAL_QUEUE_RX) ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
@@ -0,0 +1,122 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+
+/*
+ * Writer-preferring rwlock without condition variables.
+ *
+ * _tokens is a counting semaphore holding EAI_OSAL_RWLOCK_MAX_READERS
+ * tokens. A reader passes through the _turnstile mutex and takes one
+ * token. A writer takes the turnstile and keeps it while it collects
+ * every token, so readers arriving after it park on the turnstile. The
+ * turnstile is a mutex, so parked readers and writers lend their
+ * priority to the writer that holds it.
+ */
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	lock->_turnstile = xSemaphoreCreateMutex();
+	if (lock->_turnstile == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	lock->_tokens = xSemaphoreCreateCounting(EAI_OSAL_RWLOCK_MAX_READERS,
+						 EAI_OSAL_RWLOCK_MAX_READERS);
+	if (lock->_tokens == NULL) {
+		vSemaphoreDelete(lock->_turnstile);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	vSemaphoreDelete(lock->_tokens);
+	vSemaphoreDelete(lock->_turnstile);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *lock,
+					    uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	TimeOut_t timeout;
+	TickType_t wait = osal_ticks(timeout_ms);
+
+	vTaskSetTimeOutState(&timeout);
+	if (xSemaphoreTake(lock->_turnstile, wait) != pdTRUE) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	xSemaphoreGive(lock->_turnstile);
+
+	xTaskCheckForTimeOut(&timeout, &wait);
+	if (xSemaphoreTake(lock->_tokens, wait) != pdTRUE) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* Fails only if every token is already home, i.e. no reader */
+	if (xSemaphoreGive(lock->_tokens) != pdTRUE) {
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *lock,
+					     uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	TimeOut_t timeout;
+	TickType_t wait = osal_ticks(timeout_ms);
+
+	vTaskSetTimeOutState(&timeout);
+	if (xSemaphoreTake(lock->_turnstile, wait) != pdTRUE) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	/* Drain the readers that got in ahead of us */
+	for (uint32_t got = 0; got < EAI_OSAL_RWLOCK_MAX_READERS; got++) {
+		xTaskCheckForTimeOut(&timeout, &wait);
+		if (xSemaphoreTake(lock->_tokens, wait) != pdTRUE) {
+			while (got-- > 0) {
+				xSemaphoreGive(lock->_tokens);
+			}
+			xSemaphoreGive(lock->_turnstile);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (xSemaphoreGetMutexHolder(lock->_turnstile) !=
+	    xTaskGetCurrentTaskHandle()) {
+		return EAI_OSAL_ERROR;
+	}
+	for (uint32_t i = 0; i < EAI_OSAL_RWLOCK_MAX_READERS; i++) {
+		xSemaphoreGive(lock->_tokens);
+	}
+	xSemaphoreGive(lock->_turnstile);
+	return EAI_OSAL_OK;
+}
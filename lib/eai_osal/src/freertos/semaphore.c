@@ -12,6 +12,9 @@ eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 	if (sem->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_init(&sem->_stats, EAI_OSAL_STATS_SEM);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -20,6 +23,9 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&sem->_stats);
+#endif
 	if (sem->_handle != NULL) {
 		vSemaphoreDelete(sem->_handle);
 		sem->_handle = NULL;
@@ -32,7 +38,9 @@ eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_GIVE, sem, 0);
 	if (xSemaphoreGive(sem->_handle) == pdTRUE) {
+		osal_poll_notify();
 		return EAI_OSAL_OK;
 	}
 	/* Semaphore at limit — give failed */
@@ -44,8 +52,30 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	if (xSemaphoreTake(sem->_handle, 0) == pdTRUE) {
+		osal_stats_acquired(&sem->_stats, false, 0);
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_TAKE, sem, 0);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	uint32_t start = osal_stats_cycles();
+
+	if (xSemaphoreTake(sem->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
+		osal_stats_acquired(&sem->_stats, true,
+				    osal_stats_cycles() - start);
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_TAKE, sem, 0);
+		return EAI_OSAL_OK;
+	}
+	return EAI_OSAL_TIMEOUT;
+#else
 	if (xSemaphoreTake(sem->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_TAKE, sem, 0);
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
+#endif
 }
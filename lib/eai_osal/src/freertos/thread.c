@@ -5,7 +5,9 @@ static void thread_trampoline(void *arg)
 {
 	eai_osal_thread_t *thread = (eai_osal_thread_t *)arg;
 
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_START, thread->_entry, 0);
 	thread->_entry(thread->_entry_arg);
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_EXIT, thread->_entry, 0);
 
 	/* Signal join semaphore before self-deleting */
 	if (thread->_join_sem != NULL) {
@@ -75,6 +77,23 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return EAI_OSAL_TIMEOUT;
 }
 
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (cpu_mask == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+#if defined(configUSE_CORE_AFFINITY) && (configUSE_CORE_AFFINITY == 1)
+	vTaskCoreAffinitySet(thread != NULL ? thread->_handle : NULL,
+			     (UBaseType_t)cpu_mask);
+	return EAI_OSAL_OK;
+#else
+	/* ESP-IDF FreeRTOS pins a task only at creation */
+	(void)thread;
+	return EAI_OSAL_ERROR;
+#endif
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
 	vTaskDelay(pdMS_TO_TICKS(ms));
@@ -84,3 +103,15 @@ void eai_osal_thread_yield(void)
 {
 	taskYIELD();
 }
+
+#if EAI_OSAL_TRACE
+uint32_t osal_trace_cpu(void)
+{
+	return (uint32_t)xPortGetCoreID();
+}
+
+uint32_t osal_trace_thread(void)
+{
+	return (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+}
+#endif
@@ -1,6 +1,8 @@
 #include <eai_osal/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "../stats_internal.h"
 
 uint32_t eai_osal_time_get_ms(void)
 {
@@ -16,3 +18,16 @@ uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)(ticks * portTICK_PERIOD_MS);
 }
+
+#if EAI_OSAL_STATS
+/* Stats clock: low 32 bits of esp_timer's microsecond count */
+uint32_t osal_stats_cycles(void)
+{
+	return (uint32_t)esp_timer_get_time();
+}
+
+uint32_t osal_stats_cycles_to_us(uint32_t cycles)
+{
+	return cycles;
+}
+#endif
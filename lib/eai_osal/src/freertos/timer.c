@@ -1,10 +1,43 @@
 #include <eai_osal/timer.h>
+#include <eai_osal/workqueue.h>
 #include "internal.h"
 
+/*
+ * Auto-reload timers re-arm from their previous expiry time, not from
+ * when the daemon got to them, so periods do not drift. A daemon that
+ * falls behind delivers the missed expirations back-to-back; each call
+ * made when the next expiry is already due counts as an overrun.
+ */
 static void timer_trampoline(TimerHandle_t xTimer)
 {
 	eai_osal_timer_t *timer = (eai_osal_timer_t *)pvTimerGetTimerID(xTimer);
+	TickType_t period = pdMS_TO_TICKS(timer->_period_ms);
 
+	if (period > 0) {
+		/* First expiry used initial_ms; continue at the real period */
+		if (xTimerGetPeriod(xTimer) != period) {
+			xTimerChangePeriod(xTimer, period, 0);
+		} else if ((TickType_t)(xTaskGetTickCount() -
+					xTimerGetExpiryTime(xTimer)) <
+			   portMAX_DELAY / 2) {
+			timer->_overruns++;
+		}
+	}
+
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_TIMER_FIRE, timer, 0);
+	if (timer->_deferred) {
+		if (__atomic_load_n(&timer->_work._state, __ATOMIC_ACQUIRE) &
+		    WORK_QUEUED) {
+			timer->_overruns++;
+		}
+		if (timer->_wq != NULL) {
+			eai_osal_work_submit_to(&timer->_work,
+						(eai_osal_workqueue_t *)timer->_wq);
+		} else {
+			eai_osal_work_submit(&timer->_work);
+		}
+		return;
+	}
 	if (timer->_cb != NULL) {
 		timer->_cb(timer->_cb_arg);
 	}
@@ -20,6 +53,10 @@ eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 	timer->_cb = callback;
 	timer->_cb_arg = arg;
 	timer->_period_ms = 0;
+	timer->_deferred = false;
+	timer->_wq = NULL;
+	timer->_overruns = 0;
+	eai_osal_work_init(&timer->_work, callback, arg);
 
 	/* Create as one-shot; period set on start */
 	timer->_handle = xTimerCreate("osal",
@@ -42,7 +79,8 @@ eai_osal_status_t eai_osal_timer_destroy(eai_osal_timer_t *timer)
 		xTimerDelete(timer->_handle, portMAX_DELAY);
 		timer->_handle = NULL;
 	}
-	return EAI_OSAL_OK;
+	/* A deferred dispatch may still sit on a work queue */
+	return eai_osal_work_cancel_sync(&timer->_work);
 }
 
 eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
@@ -54,6 +92,7 @@ eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
 	}
 
 	timer->_period_ms = period_ms;
+	timer->_overruns = 0;
 
 	/* Set the period to initial_ms for the first fire */
 	xTimerChangePeriod(timer->_handle, pdMS_TO_TICKS(initial_ms), portMAX_DELAY);
@@ -85,3 +124,23 @@ bool eai_osal_timer_is_running(eai_osal_timer_t *timer)
 	}
 	return xTimerIsTimerActive(timer->_handle) != pdFALSE;
 }
+
+eai_osal_status_t eai_osal_timer_set_dispatch(eai_osal_timer_t *timer,
+					      eai_osal_timer_dispatch_t mode,
+					      eai_osal_workqueue_t *wq)
+{
+	if (timer == NULL || mode > EAI_OSAL_TIMER_DISPATCH_WORKQUEUE) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	timer->_deferred = (mode == EAI_OSAL_TIMER_DISPATCH_WORKQUEUE);
+	timer->_wq = timer->_deferred ? wq : NULL;
+	return EAI_OSAL_OK;
+}
+
+uint32_t eai_osal_timer_get_overruns(eai_osal_timer_t *timer)
+{
+	if (timer == NULL) {
+		return 0;
+	}
+	return timer->_overruns;
+}
@@ -14,11 +14,19 @@
 #include "freertos/timers.h"
 #include "freertos/event_groups.h"
 
-typedef struct { SemaphoreHandle_t _handle; } eai_osal_mutex_t;
+typedef struct {
+	SemaphoreHandle_t _handle;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
+} eai_osal_mutex_t;
 
 typedef struct {
 	SemaphoreHandle_t _handle;
 	uint32_t _limit;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_sem_t;
 
 typedef struct {
@@ -30,37 +38,91 @@ typedef struct {
 
 typedef struct {
 	QueueHandle_t _handle;
+	size_t _msg_size;
+	uint8_t *_stage;      /* reserve/peek staging, 2 * msg_size, lazy */
+	uint32_t _tx_timeout; /* timeout passed to reserve, used by commit */
+	uint32_t _busy;       /* OSAL_QUEUE_TX / OSAL_QUEUE_RX outstanding */
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_queue_t;
 
+/* Work item — queued by pointer, _state tracks queued/running */
+typedef struct {
+	eai_osal_work_cb_t _cb;
+	void *_cb_arg;
+	uint32_t _state;     /* WORK_* bits, see workqueue.c */
+	TaskHandle_t _runner; /* task running _cb, valid while RUNNING */
+	uint8_t _lane;        /* priority lane, see eai_osal_work_set_lane() */
+} eai_osal_work_t;
+
 typedef struct {
 	TimerHandle_t _handle;
 	eai_osal_timer_cb_t _cb;
 	void *_cb_arg;
 	uint32_t _period_ms;
+	bool _deferred;       /* dispatch via work queue */
+	void *_wq;            /* eai_osal_workqueue_t*, NULL = system */
+	eai_osal_work_t _work;
+	uint32_t _overruns;   /* expirations late by a period since start */
 } eai_osal_timer_t;
 
 typedef struct { EventGroupHandle_t _handle; } eai_osal_event_t;
 
 typedef unsigned int eai_osal_critical_key_t;
 
-/* Work item — submitted to a work queue (task + queue pattern) */
+/* Readers beyond this many wait for a token, see src/freertos/rwlock.c */
+#ifndef EAI_OSAL_RWLOCK_MAX_READERS
+#define EAI_OSAL_RWLOCK_MAX_READERS 8
+#endif
+
 typedef struct {
-	eai_osal_work_cb_t _cb;
-	void *_cb_arg;
-} eai_osal_work_t;
+	SemaphoreHandle_t _turnstile; /* mutex, held by the writer */
+	SemaphoreHandle_t _tokens;    /* one per concurrent reader */
+} eai_osal_rwlock_t;
+
+/* Fixed-block pool — free list under a per-pool spinlock */
+typedef struct {
+	uint8_t *_buf;
+	size_t _block_size;
+	uint32_t _num_blocks;
+	void *_free; /* first free block, links live in the free blocks */
+	portMUX_TYPE _lock;
+	uint32_t _in_use;
+	uint32_t _peak;
+	uint32_t _failed;
+} eai_osal_mempool_t;
 
 /* Delayed work — uses a timer to defer submission */
 typedef struct {
-	eai_osal_work_cb_t _cb;
-	void *_cb_arg;
+	eai_osal_work_t _work; /* queued on expiry */
 	TimerHandle_t _timer;
 	void *_target_wq; /* eai_osal_workqueue_t*, NULL = system */
 } eai_osal_dwork_t;
 
-/* Work queue — task that processes {cb, arg} items from a FreeRTOS queue */
+/* Pool worker — a task pulling from the pool's shared queue */
+typedef struct {
+	TaskHandle_t _task;
+} eai_osal_wq_worker_t;
+
+/*
+ * Work queue — task that processes work item pointers from one FreeRTOS
+ * queue per priority lane. With more than one lane, _avail counts items
+ * across lanes so the task can block on all of them at once.
+ */
 typedef struct {
 	TaskHandle_t _task;
-	QueueHandle_t _queue;
+	QueueHandle_t _lanes[EAI_OSAL_WQ_MAX_LANES];
+	StaticQueue_t _lane_qs[EAI_OSAL_WQ_MAX_LANES]; /* create_lanes() only */
+	uint32_t _hwm[EAI_OSAL_WQ_MAX_LANES];
+	uint8_t _n_lanes;
+	SemaphoreHandle_t _avail; /* NULL with a single lane */
+	StaticSemaphore_t _avail_buf;
+	eai_osal_wq_worker_t *_workers; /* pool mode, NULL otherwise */
+	uint32_t _n_workers;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_workqueue_t;
 
 /*
@@ -7,34 +7,146 @@
  *
  * FreeRTOS has no native work queue. We implement it as:
  * - A FreeRTOS task that blocks on a queue
- * - Work items are {callback, arg} pairs sent to the queue
+ * - Work item pointers are sent to the queue
  * - Delayed work uses a FreeRTOS timer that enqueues on expiry
  *
+ * A queue made with eai_osal_workqueue_create_lanes() has one static
+ * FreeRTOS queue per lane over the caller's buffer. Every submit also
+ * gives a counting semaphore, and the task takes one count per item
+ * from the highest non-empty lane.
+ *
  * The system work queue is lazily initialized on first use.
+ *
+ * Work items follow k_work semantics, tracked in _state exactly as on
+ * POSIX: resubmitting a queued item is a no-op, cancel clears QUEUED and
+ * leaves the stale slot to be skipped, cancel_sync waits for the slot to
+ * drain. There is no condition variable, so waits poll once per tick.
+ *
+ * A pool runs several tasks on one shared queue. FreeRTOS queues are
+ * multi-consumer, so whichever worker is idle takes the next item — the
+ * load balancing a per-worker deque with stealing would give, without
+ * the extra bookkeeping.
  */
 
 #define WQ_DEPTH 16
-
-struct wq_item {
-	eai_osal_work_cb_t cb;
-	void *arg;
-};
+#define WQ_POOL_STACK_SIZE 4096
 
 /* ── System work queue (lazy init) ────────────────────────────────────── */
 
 static eai_osal_workqueue_t sys_wq;
 static bool sys_wq_ready;
 
+/* Run a dequeued item, or drop it if it was cancelled while queued. */
+static void work_run(eai_osal_workqueue_t *wq, eai_osal_work_t *work)
+{
+	uint32_t old = __atomic_load_n(&work->_state, __ATOMIC_ACQUIRE);
+	uint32_t next;
+
+	do {
+		next = old & ~(WORK_QUEUED | WORK_INQ);
+		if (old & WORK_QUEUED) {
+			next |= WORK_RUNNING;
+		}
+	} while (!__atomic_compare_exchange_n(&work->_state, &old, next, false,
+					      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+	if (!(old & WORK_QUEUED)) {
+		return;
+	}
+
+	work->_runner = xTaskGetCurrentTaskHandle();
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_START, work, 0);
+#if EAI_OSAL_STATS
+	uint32_t start = osal_stats_cycles();
+#endif
+	work->_cb(work->_cb_arg);
+#if EAI_OSAL_STATS
+	osal_stats_executed(&wq->_stats, osal_stats_cycles() - start);
+#else
+	(void)wq;
+#endif
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_END, work, 0);
+	__atomic_fetch_and(&work->_state, ~WORK_RUNNING, __ATOMIC_ACQ_REL);
+}
+
+/* Poll until none of mask is set in work->_state. */
+static void work_wait(eai_osal_work_t *work, uint32_t mask)
+{
+	for (;;) {
+		uint32_t state = __atomic_load_n(&work->_state, __ATOMIC_ACQUIRE);
+
+		/* From the item's own callback, RUNNING never clears */
+		if ((state & WORK_RUNNING) &&
+		    work->_runner == xTaskGetCurrentTaskHandle()) {
+			state &= ~WORK_RUNNING;
+		}
+		if (!(state & mask)) {
+			return;
+		}
+		vTaskDelay(1);
+	}
+}
+
+/* Oldest item of the highest non-empty lane, blocking until one arrives. */
+static eai_osal_work_t *lanes_pop(eai_osal_workqueue_t *wq)
+{
+	eai_osal_work_t *work = NULL;
+
+	if (wq->_avail == NULL) {
+		xQueueReceive(wq->_lanes[0], &work, portMAX_DELAY);
+		return work;
+	}
+
+	xSemaphoreTake(wq->_avail, portMAX_DELAY);
+	for (int i = wq->_n_lanes - 1; i >= 0; i--) {
+		if (xQueueReceive(wq->_lanes[i], &work, 0) == pdTRUE) {
+			break;
+		}
+	}
+	return work;
+}
+
+static eai_osal_status_t lanes_push(eai_osal_workqueue_t *wq,
+				    eai_osal_work_t *work)
+{
+	uint8_t idx = work->_lane < wq->_n_lanes ? work->_lane : wq->_n_lanes - 1;
+
+	if (xQueueSend(wq->_lanes[idx], &work, 0) != pdTRUE) {
+		return EAI_OSAL_ERROR;
+	}
+
+	/* Racy against the consumer, so a slight undercount at worst */
+	uint32_t fill = uxQueueMessagesWaiting(wq->_lanes[idx]);
+	uint32_t hwm = __atomic_load_n(&wq->_hwm[idx], __ATOMIC_RELAXED);
+
+	while (fill > hwm &&
+	       !__atomic_compare_exchange_n(&wq->_hwm[idx], &hwm, fill, true,
+					    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+#if EAI_OSAL_STATS
+	uint32_t pending = 0;
+
+	for (uint8_t i = 0; i < wq->_n_lanes; i++) {
+		pending += uxQueueMessagesWaiting(wq->_lanes[i]);
+	}
+	osal_stats_depth(&wq->_stats, pending);
+#endif
+
+	if (wq->_avail != NULL) {
+		xSemaphoreGive(wq->_avail);
+	}
+	return EAI_OSAL_OK;
+}
+
 static void wq_task(void *arg)
 {
 	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)arg;
-	struct wq_item item;
 
 	for (;;) {
-		if (xQueueReceive(wq->_queue, &item, portMAX_DELAY) == pdTRUE) {
-			if (item.cb != NULL) {
-				item.cb(item.arg);
-			}
+		eai_osal_work_t *work = lanes_pop(wq);
+
+		if (work != NULL) {
+			work_run(wq, work);
 		}
 	}
 }
@@ -42,18 +154,23 @@ static void wq_task(void *arg)
 static eai_osal_workqueue_t *get_sys_wq(void)
 {
 	if (!sys_wq_ready) {
-		sys_wq._queue = xQueueCreate(WQ_DEPTH, sizeof(struct wq_item));
-		if (sys_wq._queue == NULL) {
+		sys_wq._lanes[0] = xQueueCreate(WQ_DEPTH, sizeof(eai_osal_work_t *));
+		if (sys_wq._lanes[0] == NULL) {
 			return NULL;
 		}
+		sys_wq._n_lanes = 1;
 		BaseType_t ret = xTaskCreate(wq_task, "sys_wq", 4096,
 					     &sys_wq, tskIDLE_PRIORITY + 1,
 					     &sys_wq._task);
 		if (ret != pdPASS) {
-			vQueueDelete(sys_wq._queue);
-			sys_wq._queue = NULL;
+			vQueueDelete(sys_wq._lanes[0]);
+			sys_wq._lanes[0] = NULL;
 			return NULL;
 		}
+#if EAI_OSAL_STATS
+		osal_stats_init(&sys_wq._stats, EAI_OSAL_STATS_WORKQUEUE);
+		eai_osal_stats_register(&sys_wq._stats, "sysworkq");
+#endif
 		sys_wq_ready = true;
 	}
 	return &sys_wq;
@@ -70,17 +187,37 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+	work->_state = 0;
+	work->_runner = NULL;
+	work->_lane = 0;
 	return EAI_OSAL_OK;
 }
 
-static eai_osal_status_t submit_to_queue(QueueHandle_t q,
-					 eai_osal_work_cb_t cb, void *arg)
+eai_osal_status_t eai_osal_work_set_lane(eai_osal_work_t *work, uint8_t lane)
 {
-	struct wq_item item = { .cb = cb, .arg = arg };
+	if (work == NULL || lane >= EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	work->_lane = lane;
+	return EAI_OSAL_OK;
+}
+
+/* Queue work on wq unless it is already queued (k_work_submit semantics). */
+static eai_osal_status_t submit_to_queue(eai_osal_workqueue_t *wq,
+					 eai_osal_work_t *work)
+{
+	uint32_t old = __atomic_fetch_or(&work->_state, WORK_QUEUED | WORK_INQ,
+					 __ATOMIC_ACQ_REL);
 
-	if (xQueueSend(q, &item, 0) == pdTRUE) {
+	/* Already queued, or a cancelled slot is still there to reuse */
+	if (old & (WORK_QUEUED | WORK_INQ)) {
 		return EAI_OSAL_OK;
 	}
+	if (lanes_push(wq, work) == EAI_OSAL_OK) {
+		return EAI_OSAL_OK;
+	}
+	__atomic_fetch_and(&work->_state, ~(WORK_QUEUED | WORK_INQ),
+			   __ATOMIC_ACQ_REL);
 	return EAI_OSAL_ERROR;
 }
 
@@ -94,7 +231,7 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 	if (wq == NULL) {
 		return EAI_OSAL_ERROR;
 	}
-	return submit_to_queue(wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work);
 }
 
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
@@ -103,7 +240,44 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return submit_to_queue(wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work);
+}
+
+bool eai_osal_work_is_pending(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return false;
+	}
+	return (__atomic_load_n(&work->_state, __ATOMIC_ACQUIRE) &
+		(WORK_QUEUED | WORK_RUNNING)) != 0;
+}
+
+eai_osal_status_t eai_osal_work_flush(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	work_wait(work, WORK_QUEUED | WORK_RUNNING);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	__atomic_fetch_and(&work->_state, ~WORK_QUEUED, __ATOMIC_ACQ_REL);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel_sync(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	__atomic_fetch_and(&work->_state, ~WORK_QUEUED, __ATOMIC_ACQ_REL);
+	work_wait(work, WORK_RUNNING | WORK_INQ);
+	return EAI_OSAL_OK;
 }
 
 /* ── Delayed work ─────────────────────────────────────────────────────── */
@@ -117,7 +291,7 @@ static void dwork_timer_cb(TimerHandle_t xTimer)
 		wq = get_sys_wq();
 	}
 	if (wq != NULL) {
-		submit_to_queue(wq->_queue, dwork->_cb, dwork->_cb_arg);
+		submit_to_queue(wq, &dwork->_work);
 	}
 }
 
@@ -128,8 +302,7 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || callback == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_cb = callback;
-	dwork->_cb_arg = arg;
+	eai_osal_work_init(&dwork->_work, callback, arg);
 	dwork->_target_wq = NULL;
 
 	dwork->_timer = xTimerCreate("dwork",
@@ -173,10 +346,11 @@ eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	if (xTimerStop(dwork->_timer, portMAX_DELAY) == pdTRUE) {
-		return EAI_OSAL_OK;
+	if (xTimerStop(dwork->_timer, portMAX_DELAY) != pdTRUE) {
+		return EAI_OSAL_ERROR;
 	}
-	return EAI_OSAL_ERROR;
+	/* Already expired onto the queue but not yet running */
+	return eai_osal_work_cancel(&dwork->_work);
 }
 
 /* ── Custom work queue ────────────────────────────────────────────────── */
@@ -191,10 +365,15 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	wq->_queue = xQueueCreate(WQ_DEPTH, sizeof(struct wq_item));
-	if (wq->_queue == NULL) {
+	memset(wq, 0, sizeof(*wq));
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+	wq->_lanes[0] = xQueueCreate(WQ_DEPTH, sizeof(eai_osal_work_t *));
+	if (wq->_lanes[0] == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	wq->_n_lanes = 1;
 
 	BaseType_t ret = xTaskCreate(wq_task,
 				     name ? name : "wq",
@@ -203,10 +382,107 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 				     osal_priority(priority),
 				     &wq->_task);
 	if (ret != pdPASS) {
-		vQueueDelete(wq->_queue);
-		wq->_queue = NULL;
+		vQueueDelete(wq->_lanes[0]);
+		wq->_lanes[0] = NULL;
 		return EAI_OSAL_NO_MEMORY;
 	}
 
 	return EAI_OSAL_OK;
 }
+
+eai_osal_status_t eai_osal_workqueue_create_lanes(eai_osal_workqueue_t *wq,
+						  const char *name,
+						  void *stack,
+						  size_t stack_size,
+						  uint8_t priority,
+						  void *buf,
+						  uint32_t depth,
+						  uint8_t n_lanes)
+{
+	if (wq == NULL || stack == NULL || stack_size == 0 || buf == NULL ||
+	    depth == 0 || n_lanes == 0 || n_lanes > EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	memset(wq, 0, sizeof(*wq));
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+	wq->_n_lanes = n_lanes;
+
+	/* Static objects over caller memory — nothing to free on failure */
+	for (uint8_t i = 0; i < n_lanes; i++) {
+		uint8_t *storage = (uint8_t *)buf +
+			(size_t)i * depth * sizeof(eai_osal_work_t *);
+
+		wq->_lanes[i] = xQueueCreateStatic(depth, sizeof(eai_osal_work_t *),
+						   storage, &wq->_lane_qs[i]);
+	}
+	if (n_lanes > 1) {
+		wq->_avail = xSemaphoreCreateCountingStatic(depth * n_lanes, 0,
+							    &wq->_avail_buf);
+	}
+
+	BaseType_t ret = xTaskCreate(wq_task,
+				     name ? name : "wq",
+				     stack_size / sizeof(StackType_t),
+				     wq,
+				     osal_priority(priority),
+				     &wq->_task);
+
+	return ret == pdPASS ? EAI_OSAL_OK : EAI_OSAL_NO_MEMORY;
+}
+
+uint32_t eai_osal_workqueue_high_water(eai_osal_workqueue_t *wq, uint8_t lane)
+{
+	if (wq == NULL || lane >= wq->_n_lanes) {
+		return 0;
+	}
+	return __atomic_load_n(&wq->_hwm[lane], __ATOMIC_RELAXED);
+}
+
+/* ── Work queue pool ──────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_t *wq,
+						 const char *name,
+						 eai_osal_wq_worker_t *workers,
+						 uint32_t n_workers,
+						 uint8_t priority,
+						 const int *cpus)
+{
+	if (wq == NULL || workers == NULL || n_workers == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	memset(wq, 0, sizeof(*wq));
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+
+	/* Same total capacity as n single-thread queues */
+	wq->_lanes[0] = xQueueCreate(WQ_DEPTH * n_workers, sizeof(eai_osal_work_t *));
+	if (wq->_lanes[0] == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	wq->_n_lanes = 1;
+	wq->_workers = workers;
+	wq->_n_workers = n_workers;
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		BaseType_t core = (cpus != NULL && cpus[i] >= 0)
+			? (BaseType_t)cpus[i] : tskNO_AFFINITY;
+		BaseType_t ret = xTaskCreatePinnedToCore(wq_task,
+							 name ? name : "wq_pool",
+							 WQ_POOL_STACK_SIZE / sizeof(StackType_t),
+							 wq,
+							 osal_priority(priority),
+							 &workers[i]._task,
+							 core);
+		if (ret != pdPASS) {
+			/* Workers already started keep serving the queue */
+			return EAI_OSAL_NO_MEMORY;
+		}
+	}
+
+	return EAI_OSAL_OK;
+}
@@ -0,0 +1,150 @@
+#include "deadline.h"
+
+/*
+ * Pairing heap over struct eai_osal_deadline.
+ *
+ * Each node keeps its first child and its next sibling. _prev points at the
+ * left sibling, or at the parent for a first child, so any node can be
+ * unlinked in O(1) before its children are re-merged.
+ */
+
+static bool before(const struct eai_osal_deadline *a,
+		   const struct eai_osal_deadline *b)
+{
+	if (a->_deadline != b->_deadline) {
+		return a->_deadline < b->_deadline;
+	}
+	return a->_seq < b->_seq;
+}
+
+static struct eai_osal_deadline *meld(struct eai_osal_deadline *a,
+				      struct eai_osal_deadline *b)
+{
+	if (a == NULL) {
+		return b;
+	}
+	if (b == NULL) {
+		return a;
+	}
+	if (before(b, a)) {
+		struct eai_osal_deadline *t = a;
+
+		a = b;
+		b = t;
+	}
+
+	/* b becomes the first child of a */
+	b->_prev = a;
+	b->_next = a->_child;
+	if (a->_child != NULL) {
+		a->_child->_prev = b;
+	}
+	a->_child = b;
+	a->_next = NULL;
+	a->_prev = NULL;
+	return a;
+}
+
+/* Standard two-pass merge of a sibling list */
+static struct eai_osal_deadline *merge_pairs(struct eai_osal_deadline *first)
+{
+	struct eai_osal_deadline *acc = NULL;
+
+	/* Pass 1: meld adjacent pairs left to right, stacking results */
+	while (first != NULL) {
+		struct eai_osal_deadline *a = first;
+		struct eai_osal_deadline *b = a->_next;
+
+		if (b == NULL) {
+			a->_prev = NULL;
+			a->_next = acc;
+			acc = a;
+			break;
+		}
+		first = b->_next;
+		a->_next = a->_prev = NULL;
+		b->_next = b->_prev = NULL;
+
+		struct eai_osal_deadline *m = meld(a, b);
+
+		m->_next = acc;
+		acc = m;
+	}
+
+	if (acc == NULL) {
+		return NULL;
+	}
+
+	/* Pass 2: fold the stack right to left */
+	struct eai_osal_deadline *root = acc;
+
+	acc = acc->_next;
+	root->_next = NULL;
+	while (acc != NULL) {
+		struct eai_osal_deadline *next = acc->_next;
+
+		acc->_next = NULL;
+		root = meld(root, acc);
+		acc = next;
+	}
+	return root;
+}
+
+void osal_deadline_heap_init(struct eai_osal_deadline_heap *heap)
+{
+	heap->_root = NULL;
+	heap->_seq = 0;
+	heap->_count = 0;
+}
+
+void osal_deadline_insert(struct eai_osal_deadline_heap *heap,
+			  struct eai_osal_deadline *node, uint64_t deadline_us)
+{
+	node->_deadline = deadline_us;
+	node->_seq = heap->_seq++;
+	node->_child = NULL;
+	node->_next = NULL;
+	node->_prev = NULL;
+	node->_linked = true;
+	heap->_root = meld(heap->_root, node);
+	heap->_count++;
+}
+
+bool osal_deadline_remove(struct eai_osal_deadline_heap *heap,
+			  struct eai_osal_deadline *node)
+{
+	if (!node->_linked) {
+		return false;
+	}
+
+	if (node == heap->_root) {
+		heap->_root = merge_pairs(node->_child);
+	} else {
+		if (node->_prev->_child == node) {
+			node->_prev->_child = node->_next;
+		} else {
+			node->_prev->_next = node->_next;
+		}
+		if (node->_next != NULL) {
+			node->_next->_prev = node->_prev;
+		}
+		heap->_root = meld(heap->_root, merge_pairs(node->_child));
+	}
+
+	node->_child = NULL;
+	node->_next = NULL;
+	node->_prev = NULL;
+	node->_linked = false;
+	heap->_count--;
+	return true;
+}
+
+struct eai_osal_deadline *osal_deadline_pop(struct eai_osal_deadline_heap *heap)
+{
+	struct eai_osal_deadline *node = heap->_root;
+
+	if (node != NULL) {
+		osal_deadline_remove(heap, node);
+	}
+	return node;
+}
@@ -0,0 +1,39 @@
+#ifndef EAI_OSAL_POSIX_DEADLINE_H
+#define EAI_OSAL_POSIX_DEADLINE_H
+
+/*
+ * Intrusive deadline heap (pairing heap) shared by the POSIX timer service
+ * and delayed work. Nodes live inside the owning object, so arming never
+ * allocates. Insert and peek are O(1); remove and pop are O(log n) amortized.
+ *
+ * Not thread-safe — callers serialize access with their own lock.
+ */
+
+#include <eai_osal/types.h>
+
+void osal_deadline_heap_init(struct eai_osal_deadline_heap *heap);
+
+/** Insert node with an absolute deadline (microseconds). Node must be unlinked. */
+void osal_deadline_insert(struct eai_osal_deadline_heap *heap,
+			  struct eai_osal_deadline *node, uint64_t deadline_us);
+
+/** Remove node if linked. Returns true if it was in the heap. */
+bool osal_deadline_remove(struct eai_osal_deadline_heap *heap,
+			  struct eai_osal_deadline *node);
+
+/** Earliest node, or NULL if the heap is empty. */
+static inline struct eai_osal_deadline *
+osal_deadline_peek(const struct eai_osal_deadline_heap *heap)
+{
+	return heap->_root;
+}
+
+/** Remove and return the earliest node, or NULL if empty. */
+struct eai_osal_deadline *osal_deadline_pop(struct eai_osal_deadline_heap *heap);
+
+static inline bool osal_deadline_is_linked(const struct eai_osal_deadline *node)
+{
+	return node->_linked;
+}
+
+#endif /* EAI_OSAL_POSIX_DEADLINE_H */
@@ -1,6 +1,117 @@
 #include <eai_osal/event.h>
+#include <eai_osal/time.h>
 #include "internal.h"
 
+#define BITS_MET(v, b, all) ((all) ? (((v) & (b)) == (b)) : (((v) & (b)) != 0))
+
+#if EAI_OSAL_POSIX_FUTEX
+
+/*
+ * _state holds the bits in its low half (the futex word) and the number
+ * of parked waiters in its high half. set ORs the bits in with one atomic
+ * op and calls FUTEX_WAKE only if that op saw a waiter and actually
+ * changed the bits, so setting bits nobody waits for never enters the
+ * kernel. Waiters sleep on the bit value they last tested; any change
+ * makes FUTEX_WAIT return and they re-test.
+ */
+
+#define EVENT_BITS(s) ((uint32_t)(s))
+
+eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	event->_state = 0;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint64_t s = __atomic_fetch_or(&event->_state, (uint64_t)bits,
+				       __ATOMIC_SEQ_CST);
+
+	/* event may already be gone here; only its address is used */
+	if (s >= OSAL_FUTEX_WAITER && (EVENT_BITS(s) | bits) != EVENT_BITS(s)) {
+		osal_futex_wake(osal_futex_lo(&event->_state), INT32_MAX);
+	}
+	osal_poll_notify();
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
+				      bool wait_all, uint32_t *actual,
+				      uint32_t timeout_ms)
+{
+	if (event == NULL || bits == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t v = EVENT_BITS(__atomic_load_n(&event->_state,
+						__ATOMIC_ACQUIRE));
+
+	if (!BITS_MET(v, bits, wait_all)) {
+		if (timeout_ms == EAI_OSAL_NO_WAIT) {
+			return EAI_OSAL_TIMEOUT;
+		}
+
+		uint64_t deadline = UINT64_MAX;
+
+		if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+			deadline = eai_osal_time_get_ticks() +
+				   (uint64_t)timeout_ms * 1000;
+		}
+
+		bool expired = false;
+
+		v = EVENT_BITS(__atomic_add_fetch(&event->_state,
+						  OSAL_FUTEX_WAITER,
+						  __ATOMIC_ACQUIRE));
+		while (!BITS_MET(v, bits, wait_all) && !expired) {
+			expired = osal_futex_wait(osal_futex_lo(&event->_state),
+						  v, deadline) == ETIMEDOUT;
+			v = EVENT_BITS(__atomic_load_n(&event->_state,
+						       __ATOMIC_ACQUIRE));
+		}
+		__atomic_fetch_sub(&event->_state, OSAL_FUTEX_WAITER,
+				   __ATOMIC_RELAXED);
+
+		if (!BITS_MET(v, bits, wait_all)) {
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+
+	if (actual != NULL) {
+		*actual = v & bits;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_clear(eai_osal_event_t *event, uint32_t bits)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* Clearing never satisfies a waiter, so nobody is woken */
+	__atomic_fetch_and(&event->_state, ~(uint64_t)bits, __ATOMIC_RELAXED);
+	return EAI_OSAL_OK;
+}
+
+#else /* !EAI_OSAL_POSIX_FUTEX */
+
 eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
 {
 	if (event == NULL) {
@@ -36,8 +147,9 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 	}
 	pthread_mutex_lock(&event->_lock);
 	event->_bits |= bits;
-	pthread_cond_broadcast(&event->_cond);
+	osal_cond_broadcast(&event->_cond);
 	pthread_mutex_unlock(&event->_lock);
+	osal_poll_notify();
 	return EAI_OSAL_OK;
 }
 
@@ -51,24 +163,20 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 
 	pthread_mutex_lock(&event->_lock);
 
-	/* Check condition macro */
-	#define BITS_MET(ev, b, all) \
-		((all) ? (((ev)->_bits & (b)) == (b)) : (((ev)->_bits & (b)) != 0))
-
 	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		if (!BITS_MET(event, bits, wait_all)) {
+		if (!BITS_MET(event->_bits, bits, wait_all)) {
 			pthread_mutex_unlock(&event->_lock);
 			return EAI_OSAL_TIMEOUT;
 		}
 	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		while (!BITS_MET(event, bits, wait_all)) {
-			pthread_cond_wait(&event->_cond, &event->_lock);
+		while (!BITS_MET(event->_bits, bits, wait_all)) {
+			osal_cond_wait(&event->_cond, &event->_lock);
 		}
 	} else {
 		struct timespec ts = osal_timespec(timeout_ms);
-		while (!BITS_MET(event, bits, wait_all)) {
-			int ret = pthread_cond_timedwait(&event->_cond,
-							 &event->_lock, &ts);
+		while (!BITS_MET(event->_bits, bits, wait_all)) {
+			int ret = osal_cond_timedwait(&event->_cond,
+						      &event->_lock, &ts);
 			if (ret != 0) {
 				pthread_mutex_unlock(&event->_lock);
 				return EAI_OSAL_TIMEOUT;
@@ -76,8 +184,6 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 		}
 	}
 
-	#undef BITS_MET
-
 	if (actual != NULL) {
 		*actual = event->_bits & bits;
 	}
@@ -95,3 +201,5 @@ eai_osal_status_t eai_osal_event_clear(eai_osal_event_t *event, uint32_t bits)
 	pthread_mutex_unlock(&event->_lock);
 	return EAI_OSAL_OK;
 }
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
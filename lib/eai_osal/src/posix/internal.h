@@ -2,18 +2,48 @@
 #define EAI_OSAL_POSIX_INTERNAL_H
 
 #include <eai_osal/types.h>
+#include <errno.h>
+#include <pthread.h>
 #include <time.h>
 
+#if EAI_OSAL_POSIX_VTIME
+#if EAI_OSAL_POSIX_FUTEX
+#error "EAI_OSAL_POSIX_VTIME needs EAI_OSAL_POSIX_FUTEX=0"
+#endif
+
+/*
+ * Virtual time, see vtime.c. Waits below register with the simulated
+ * clock; deadlines are virtual microseconds. A cond may only be
+ * signalled with its mutex held.
+ */
+uint64_t osal_vt_now(void);
+int osal_vt_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock,
+		      uint64_t deadline_us);
+void osal_vt_cond_broadcast(pthread_cond_t *cond);
+int osal_vt_mutex_lock(pthread_mutex_t *mutex, uint64_t deadline_us);
+void osal_vt_mutex_unlock(pthread_mutex_t *mutex);
+void osal_vt_sleep(uint64_t us);
+int osal_vt_pthread_create(pthread_t *thread, const pthread_attr_t *attr,
+			   void *(*entry)(void *), void *arg);
+#endif
+
 /*
  * Compute absolute timespec for pthread_cond_timedwait / pthread_mutex_timedlock.
  * Uses CLOCK_REALTIME because macOS doesn't support pthread_condattr_setclock
- * with CLOCK_MONOTONIC.
+ * with CLOCK_MONOTONIC. Under virtual time it holds the virtual deadline.
  */
 static inline struct timespec osal_timespec(uint32_t ms)
 {
 	struct timespec ts;
 
+#if EAI_OSAL_POSIX_VTIME
+	uint64_t now = osal_vt_now();
+
+	ts.tv_sec = (time_t)(now / 1000000ULL);
+	ts.tv_nsec = (long)(now % 1000000ULL) * 1000L;
+#else
 	clock_gettime(CLOCK_REALTIME, &ts);
+#endif
 	ts.tv_sec += ms / 1000;
 	ts.tv_nsec += (long)(ms % 1000) * 1000000L;
 	if (ts.tv_nsec >= 1000000000L) {
@@ -23,4 +53,189 @@ static inline struct timespec osal_timespec(uint32_t ms)
 	return ts;
 }
 
+/*
+ * Deadline waits. Timers and delayed work keep absolute deadlines in
+ * eai_osal_time_get_ticks() units (CLOCK_MONOTONIC microseconds), so
+ * their condition variables wait on that clock directly: a wakeup is
+ * never stretched by callback time or moved by a wall-clock step.
+ * Linux binds the clock with pthread_condattr_setclock. macOS lacks it,
+ * so there the deadline becomes a relative wait just before sleeping.
+ */
+static inline int osal_cond_init_monotonic(pthread_cond_t *cond)
+{
+#if defined(__APPLE__)
+	return pthread_cond_init(cond, NULL);
+#else
+	pthread_condattr_t attr;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	int rc = pthread_cond_init(cond, &attr);
+
+	pthread_condattr_destroy(&attr);
+	return rc;
+#endif
+}
+
+/* Wait on a cond set up by osal_cond_init_monotonic() until deadline_us. */
+static inline int osal_cond_wait_until(pthread_cond_t *cond,
+				       pthread_mutex_t *lock,
+				       uint64_t deadline_us)
+{
+	struct timespec ts;
+
+#if EAI_OSAL_POSIX_VTIME
+	(void)ts;
+	return osal_vt_cond_wait(cond, lock, deadline_us);
+#elif defined(__APPLE__)
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64_t now = (uint64_t)ts.tv_sec * 1000000ULL +
+		       (uint64_t)(ts.tv_nsec / 1000);
+	uint64_t us = deadline_us > now ? deadline_us - now : 0;
+
+	ts.tv_sec = (time_t)(us / 1000000ULL);
+	ts.tv_nsec = (long)(us % 1000000ULL) * 1000L;
+	return pthread_cond_timedwait_relative_np(cond, lock, &ts);
+#else
+	ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+	ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;
+	return pthread_cond_timedwait(cond, lock, &ts);
+#endif
+}
+
+/*
+ * Every other wait, wake and backend thread goes through these, so that
+ * virtual time sees it. Without EAI_OSAL_POSIX_VTIME they are the plain
+ * pthread calls.
+ */
+static inline int osal_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock)
+{
+#if EAI_OSAL_POSIX_VTIME
+	return osal_vt_cond_wait(cond, lock, UINT64_MAX);
+#else
+	return pthread_cond_wait(cond, lock);
+#endif
+}
+
+/* Wait on a default-clock cond until an osal_timespec() deadline. */
+static inline int osal_cond_timedwait(pthread_cond_t *cond,
+				      pthread_mutex_t *lock,
+				      const struct timespec *ts)
+{
+#if EAI_OSAL_POSIX_VTIME
+	return osal_vt_cond_wait(cond, lock,
+				 (uint64_t)ts->tv_sec * 1000000ULL +
+				 (uint64_t)(ts->tv_nsec / 1000));
+#else
+	return pthread_cond_timedwait(cond, lock, ts);
+#endif
+}
+
+static inline void osal_cond_signal(pthread_cond_t *cond)
+{
+#if EAI_OSAL_POSIX_VTIME
+	osal_vt_cond_broadcast(cond);
+#else
+	pthread_cond_signal(cond);
+#endif
+}
+
+static inline void osal_cond_broadcast(pthread_cond_t *cond)
+{
+#if EAI_OSAL_POSIX_VTIME
+	osal_vt_cond_broadcast(cond);
+#else
+	pthread_cond_broadcast(cond);
+#endif
+}
+
+static inline int osal_pthread_create(pthread_t *thread,
+				      const pthread_attr_t *attr,
+				      void *(*entry)(void *), void *arg)
+{
+#if EAI_OSAL_POSIX_VTIME
+	return osal_vt_pthread_create(thread, attr, entry, arg);
+#else
+	return pthread_create(thread, attr, entry, arg);
+#endif
+}
+
+#if EAI_OSAL_POSIX_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * Sleep while *word == expected, until deadline_us on CLOCK_MONOTONIC
+ * (UINT64_MAX = no deadline). Returns 0 when woken or when *word already
+ * differed, ETIMEDOUT on deadline. Spurious returns are possible; callers
+ * re-check their condition.
+ */
+static inline int osal_futex_wait(uint32_t *word, uint32_t expected,
+				  uint64_t deadline_us)
+{
+	struct timespec ts;
+	struct timespec *tsp = NULL;
+
+	if (deadline_us != UINT64_MAX) {
+		ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+		ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;
+		tsp = &ts;
+	}
+	/* WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline */
+	if (syscall(SYS_futex, word, FUTEX_WAIT_BITSET_PRIVATE, expected, tsp,
+		    NULL, FUTEX_BITSET_MATCH_ANY) == 0) {
+		return 0;
+	}
+	return errno == ETIMEDOUT ? ETIMEDOUT : 0;
+}
+
+static inline void osal_futex_wake(uint32_t *word, int n)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+}
+
+/*
+ * Semaphores and events keep their value and waiter count in one 64-bit
+ * word, so a waker learns whether anyone is parked from the same atomic
+ * op that publishes the value. It never touches the object afterwards;
+ * only the FUTEX_WAKE syscall follows, which is harmless if the woken
+ * thread has already destroyed the object.
+ */
+#define OSAL_FUTEX_WAITER (1ULL << 32)
+
+static inline uint32_t *osal_futex_lo(uint64_t *state)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	return (uint32_t *)state;
+#else
+	return (uint32_t *)state + 1;
+#endif
+}
+#endif
+
+/*
+ * eai_osal_poll() hub, see poll.c. Call osal_poll_notify() after making a
+ * queue, semaphore or event ready; the state change must be published
+ * with a seq_cst atomic or under the object's lock before the call.
+ */
+extern uint32_t osal_poll_waiters;
+void osal_poll_wake(void);
+
+static inline void osal_poll_notify(void)
+{
+	if (__atomic_load_n(&osal_poll_waiters, __ATOMIC_SEQ_CST) != 0) {
+		osal_poll_wake();
+	}
+}
+
+/* eai_osal_work_t._state bits, owned by workqueue.c */
+#define WORK_QUEUED  (1U << 0) /* will run; cleared by cancel */
+#define WORK_RUNNING (1U << 1) /* callback executing */
+#define WORK_INQ     (1U << 2) /* a queue slot still points at the item */
+#define WORK_WAITED  (1U << 3) /* flush/cancel_sync parked on work_cond */
+
+#include "../stats_internal.h"
+#include "../trace_internal.h"
+
 #endif /* EAI_OSAL_POSIX_INTERNAL_H */
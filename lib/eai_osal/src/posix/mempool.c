@@ -0,0 +1,144 @@
+#include <eai_osal/mempool.h>
+
+/*
+ * Lock-free fixed-block pool — a Treiber stack of free blocks.
+ *
+ * Each free block holds, in its first word, the index + 1 of the next
+ * free block (0 ends the list). _head packs the index + 1 of the first
+ * free block with a tag in its high half that every update bumps, so a
+ * CAS against a head that was popped and pushed back in between (ABA)
+ * fails instead of installing a stale link.
+ *
+ * alloc reads the link of a block that another thread may pop and start
+ * using at the same moment. The value read is then garbage, but the tag
+ * has moved and the CAS retries. Links are accessed atomically for that
+ * reason.
+ */
+
+#define HEAD(tag, idx1) (((uint64_t)(tag) << 32) | (idx1))
+#define HEAD_IDX1(h)    ((uint32_t)(h))
+#define HEAD_TAG(h)     ((uint32_t)((h) >> 32))
+
+static uint32_t *link_of(eai_osal_mempool_t *pool, uint32_t idx)
+{
+	return (uint32_t *)(pool->_buf + (size_t)idx * pool->_block_size);
+}
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  void *buffer, size_t block_size,
+					  uint32_t num_blocks)
+{
+	if (pool == NULL || buffer == NULL || num_blocks == 0 ||
+	    num_blocks == UINT32_MAX) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (block_size == 0 || block_size % EAI_OSAL_MEMPOOL_ALIGN != 0 ||
+	    (uintptr_t)buffer % EAI_OSAL_MEMPOOL_ALIGN != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_buf = (uint8_t *)buffer;
+	pool->_block_size = block_size;
+	pool->_num_blocks = num_blocks;
+	for (uint32_t i = 0; i < num_blocks; i++) {
+		*link_of(pool, i) = (i + 1 < num_blocks) ? i + 2 : 0;
+	}
+	pool->_in_use = 0;
+	pool->_peak = 0;
+	pool->_failed = 0;
+	__atomic_store_n(&pool->_head, HEAD(0, 1), __ATOMIC_RELEASE);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool,
+					 void **block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint64_t h = __atomic_load_n(&pool->_head, __ATOMIC_ACQUIRE);
+	uint32_t idx1;
+
+	for (;;) {
+		idx1 = HEAD_IDX1(h);
+		if (idx1 == 0) {
+			__atomic_fetch_add(&pool->_failed, 1, __ATOMIC_RELAXED);
+			return EAI_OSAL_NO_MEMORY;
+		}
+		uint32_t next = __atomic_load_n(link_of(pool, idx1 - 1),
+						__ATOMIC_RELAXED);
+
+		if (__atomic_compare_exchange_n(&pool->_head, &h,
+						HEAD(HEAD_TAG(h) + 1, next),
+						true, __ATOMIC_ACQUIRE,
+						__ATOMIC_ACQUIRE)) {
+			break;
+		}
+	}
+
+	uint32_t used = __atomic_add_fetch(&pool->_in_use, 1, __ATOMIC_RELAXED);
+	uint32_t peak = __atomic_load_n(&pool->_peak, __ATOMIC_RELAXED);
+
+	while (used > peak &&
+	       !__atomic_compare_exchange_n(&pool->_peak, &peak, used, true,
+					    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+
+	*block = link_of(pool, idx1 - 1);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool,
+					void *block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uintptr_t off = (uintptr_t)block - (uintptr_t)pool->_buf;
+
+	if ((uintptr_t)block < (uintptr_t)pool->_buf ||
+	    off >= (uintptr_t)pool->_block_size * pool->_num_blocks ||
+	    off % pool->_block_size != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t idx = (uint32_t)(off / pool->_block_size);
+	uint32_t *link = link_of(pool, idx);
+	uint64_t h = __atomic_load_n(&pool->_head, __ATOMIC_RELAXED);
+
+	/* Uncount before the push: once the block is on the free list another
+	 * thread can allocate it, and counting it twice would overstate peak.
+	 */
+	__atomic_fetch_sub(&pool->_in_use, 1, __ATOMIC_RELAXED);
+	do {
+		__atomic_store_n(link, HEAD_IDX1(h), __ATOMIC_RELAXED);
+	} while (!__atomic_compare_exchange_n(&pool->_head, &h,
+					      HEAD(HEAD_TAG(h) + 1, idx + 1),
+					      true, __ATOMIC_RELEASE,
+					      __ATOMIC_RELAXED));
+
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	stats->num_blocks = pool->_num_blocks;
+	stats->in_use = __atomic_load_n(&pool->_in_use, __ATOMIC_RELAXED);
+	stats->peak = __atomic_load_n(&pool->_peak, __ATOMIC_RELAXED);
+	stats->failed = __atomic_load_n(&pool->_failed, __ATOMIC_RELAXED);
+	return EAI_OSAL_OK;
+}
@@ -16,6 +16,9 @@ eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
 	int ret = pthread_mutex_init(&mutex->_handle, &attr);
 	pthread_mutexattr_destroy(&attr);
 
+#if EAI_OSAL_STATS
+	osal_stats_init(&mutex->_stats, EAI_OSAL_STATS_MUTEX);
+#endif
 	return ret == 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
 }
 
@@ -24,16 +27,26 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&mutex->_stats);
+#endif
 	pthread_mutex_destroy(&mutex->_handle);
 	return EAI_OSAL_OK;
 }
 
-eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_ms)
+static eai_osal_status_t mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_ms)
 {
-	if (mutex == NULL) {
-		return EAI_OSAL_INVALID_PARAM;
-	}
+#if EAI_OSAL_POSIX_VTIME
+	/* A thread parked in pthread_mutex_lock would look busy to the clock */
+	if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint64_t deadline = timeout_ms == EAI_OSAL_WAIT_FOREVER
+			? UINT64_MAX
+			: osal_vt_now() + (uint64_t)timeout_ms * 1000;
 
+		return osal_vt_mutex_lock(&mutex->_handle, deadline) == 0
+			? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+	}
+#endif
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		return pthread_mutex_lock(&mutex->_handle) == 0
 			? EAI_OSAL_OK : EAI_OSAL_ERROR;
@@ -60,11 +73,44 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 	return EAI_OSAL_TIMEOUT;
 }
 
+eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_ms)
+{
+	if (mutex == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+#if EAI_OSAL_STATS
+	eai_osal_status_t ret = mutex_lock(mutex, EAI_OSAL_NO_WAIT);
+
+	if (ret == EAI_OSAL_OK) {
+		osal_stats_acquired(&mutex->_stats, false, 0);
+	} else if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint32_t start = osal_stats_cycles();
+
+		ret = mutex_lock(mutex, timeout_ms);
+		if (ret == EAI_OSAL_OK) {
+			osal_stats_acquired(&mutex->_stats, true,
+					    osal_stats_cycles() - start);
+		}
+	}
+	return ret;
+#else
+	return mutex_lock(mutex, timeout_ms);
+#endif
+}
+
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
 {
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_POSIX_VTIME
+	if (pthread_mutex_unlock(&mutex->_handle) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	osal_vt_mutex_unlock(&mutex->_handle);
+	return EAI_OSAL_OK;
+#else
 	return pthread_mutex_unlock(&mutex->_handle) == 0
 		? EAI_OSAL_OK : EAI_OSAL_ERROR;
+#endif
 }
@@ -0,0 +1,178 @@
+#include <eai_osal/poll.h>
+#include <eai_osal/time.h>
+#include "internal.h"
+
+/*
+ * POSIX poll — one process-wide hub.
+ *
+ * A poller registers in osal_poll_waiters, snapshots the hub sequence,
+ * scans its descriptors and sleeps on the hub condvar until the sequence
+ * moves. Every queue send, semaphore give and event set calls
+ * osal_poll_notify(), which bumps the sequence and broadcasts only while
+ * some poller is registered.
+ *
+ * The waker publishes its object state before reading osal_poll_waiters,
+ * and the poller registers before scanning, so one of them always sees
+ * the other. A change to any object wakes every poller; they re-scan and
+ * sleep again if none of theirs is ready. That is cheap enough on a host.
+ */
+
+uint32_t osal_poll_waiters;
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond; /* sequence moved, monotonic */
+	uint64_t seq;
+} hub = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static pthread_once_t hub_once = PTHREAD_ONCE_INIT;
+
+static void hub_init(void)
+{
+	osal_cond_init_monotonic(&hub.cond);
+}
+
+void osal_poll_wake(void)
+{
+	pthread_once(&hub_once, hub_init);
+	pthread_mutex_lock(&hub.lock);
+	hub.seq++;
+	osal_cond_broadcast(&hub.cond);
+	pthread_mutex_unlock(&hub.lock);
+}
+
+static bool queue_ready(eai_osal_queue_t *queue)
+{
+	pthread_mutex_lock(&queue->_lock);
+	bool ready = queue->_count > 0 && !queue->_peeked;
+
+	pthread_mutex_unlock(&queue->_lock);
+	return ready;
+}
+
+static bool sem_ready(eai_osal_sem_t *sem)
+{
+#if EAI_OSAL_POSIX_FUTEX
+	return (uint32_t)__atomic_load_n(&sem->_state, __ATOMIC_SEQ_CST) > 0;
+#else
+	pthread_mutex_lock(&sem->_lock);
+	bool ready = sem->_count > 0;
+
+	pthread_mutex_unlock(&sem->_lock);
+	return ready;
+#endif
+}
+
+static bool event_ready(eai_osal_event_t *event, uint32_t bits)
+{
+#if EAI_OSAL_POSIX_FUTEX
+	return ((uint32_t)__atomic_load_n(&event->_state, __ATOMIC_SEQ_CST) &
+		bits) != 0;
+#else
+	pthread_mutex_lock(&event->_lock);
+	bool ready = (event->_bits & bits) != 0;
+
+	pthread_mutex_unlock(&event->_lock);
+	return ready;
+#endif
+}
+
+/* Refresh every ready flag; true if any is set */
+static bool scan(eai_osal_poll_event_t *events, uint32_t n)
+{
+	bool any = false;
+
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_poll_event_t *ev = &events[i];
+
+		switch (ev->type) {
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			ev->ready = queue_ready(ev->obj.queue);
+			break;
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			ev->ready = sem_ready(ev->obj.sem);
+			break;
+		default:
+			ev->ready = event_ready(ev->obj.event, ev->bits);
+			break;
+		}
+		any |= ev->ready;
+	}
+	return any;
+}
+
+static bool valid(const eai_osal_poll_event_t *events, uint32_t n)
+{
+	if (events == NULL || n == 0 || n > EAI_OSAL_POLL_MAX_EVENTS) {
+		return false;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		if (events[i].obj.queue == NULL ||
+		    events[i].type > EAI_OSAL_POLL_EVENT_BITS ||
+		    (events[i].type == EAI_OSAL_POLL_EVENT_BITS &&
+		     events[i].bits == 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, uint32_t n,
+				uint32_t timeout_ms)
+{
+	if (!valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (scan(events, n)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	uint64_t deadline = UINT64_MAX;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		deadline = eai_osal_time_get_ticks() + (uint64_t)timeout_ms * 1000;
+	}
+
+	pthread_once(&hub_once, hub_init);
+	__atomic_fetch_add(&osal_poll_waiters, 1, __ATOMIC_SEQ_CST);
+
+	eai_osal_status_t rc;
+
+	for (;;) {
+		pthread_mutex_lock(&hub.lock);
+		uint64_t seq = hub.seq;
+
+		pthread_mutex_unlock(&hub.lock);
+
+		if (scan(events, n)) {
+			rc = EAI_OSAL_OK;
+			break;
+		}
+
+		int err = 0;
+
+		pthread_mutex_lock(&hub.lock);
+		while (hub.seq == seq && err == 0) {
+			if (deadline == UINT64_MAX) {
+				osal_cond_wait(&hub.cond, &hub.lock);
+			} else {
+				err = osal_cond_wait_until(&hub.cond, &hub.lock,
+							   deadline);
+			}
+		}
+		pthread_mutex_unlock(&hub.lock);
+
+		if (err != 0) {
+			rc = scan(events, n) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+			break;
+		}
+	}
+
+	__atomic_fetch_sub(&osal_poll_waiters, 1, __ATOMIC_RELAXED);
+	return rc;
+}
@@ -2,6 +2,77 @@
 #include "internal.h"
 #include <string.h>
 
+/*
+ * Ring of fixed-size slots over the caller's buffer, guarded by one mutex.
+ *
+ * reserve()/peek() hand out the head/tail slot itself. While a reservation
+ * is outstanding the head slot is claimed but not yet counted, so other
+ * producers wait; while a peek is outstanding the tail slot stays counted,
+ * so other consumers wait. commit()/release() then publish the slot exactly
+ * as send()/recv() would, minus the memcpy.
+ */
+
+static uint8_t *slot_at(eai_osal_queue_t *queue, uint32_t index)
+{
+	return queue->_buf + (size_t)index * queue->_msg_size;
+}
+
+static bool can_write(const eai_osal_queue_t *queue)
+{
+	return queue->_count < queue->_max_msgs && !queue->_reserved;
+}
+
+static bool can_read(const eai_osal_queue_t *queue)
+{
+	return queue->_count > 0 && !queue->_peeked;
+}
+
+/* Wait on cond until ready(queue). Called and returns with queue->_lock held. */
+static eai_osal_status_t wait_for(eai_osal_queue_t *queue, pthread_cond_t *cond,
+				  bool (*ready)(const eai_osal_queue_t *),
+				  uint32_t timeout_ms)
+{
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return ready(queue) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+	}
+	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
+		while (!ready(queue)) {
+			osal_cond_wait(cond, &queue->_lock);
+		}
+		return EAI_OSAL_OK;
+	}
+
+	struct timespec ts = osal_timespec(timeout_ms);
+
+	while (!ready(queue)) {
+		if (osal_cond_timedwait(cond, &queue->_lock, &ts) != 0) {
+			return ready(queue) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+/* Publish the head slot. Caller holds queue->_lock. */
+static void push_head(eai_osal_queue_t *queue)
+{
+	queue->_head = (queue->_head + 1) % queue->_max_msgs;
+	queue->_count++;
+#if EAI_OSAL_STATS
+	osal_stats_depth(&queue->_stats, queue->_count);
+#endif
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+	osal_cond_signal(&queue->_not_empty);
+}
+
+/* Retire the tail slot. Caller holds queue->_lock. */
+static void pop_tail(eai_osal_queue_t *queue)
+{
+	queue->_tail = (queue->_tail + 1) % queue->_max_msgs;
+	queue->_count--;
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, 1);
+	osal_cond_signal(&queue->_not_full);
+}
+
 eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size,
 					uint32_t max_msgs, void *buffer)
 {
@@ -15,6 +86,11 @@ eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size
 	queue->_head = 0;
 	queue->_tail = 0;
 	queue->_count = 0;
+	queue->_reserved = false;
+	queue->_peeked = false;
+#if EAI_OSAL_STATS
+	osal_stats_init(&queue->_stats, EAI_OSAL_STATS_QUEUE);
+#endif
 
 	if (pthread_mutex_init(&queue->_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
@@ -36,6 +112,9 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&queue->_stats);
+#endif
 	pthread_cond_destroy(&queue->_not_empty);
 	pthread_cond_destroy(&queue->_not_full);
 	pthread_mutex_destroy(&queue->_lock);
@@ -51,33 +130,26 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 
 	pthread_mutex_lock(&queue->_lock);
 
-	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		if (queue->_count >= queue->_max_msgs) {
-			pthread_mutex_unlock(&queue->_lock);
-			return EAI_OSAL_TIMEOUT;
-		}
-	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		while (queue->_count >= queue->_max_msgs) {
-			pthread_cond_wait(&queue->_not_full, &queue->_lock);
-		}
-	} else {
-		struct timespec ts = osal_timespec(timeout_ms);
-		while (queue->_count >= queue->_max_msgs) {
-			int ret = pthread_cond_timedwait(&queue->_not_full,
-							 &queue->_lock, &ts);
-			if (ret != 0) {
-				pthread_mutex_unlock(&queue->_lock);
-				return EAI_OSAL_TIMEOUT;
-			}
-		}
+#if EAI_OSAL_STATS
+	bool contended = !can_write(queue);
+	uint32_t start = osal_stats_cycles();
+#endif
+	eai_osal_status_t rc = wait_for(queue, &queue->_not_full, can_write,
+					timeout_ms);
+	if (rc == EAI_OSAL_OK) {
+		memcpy(slot_at(queue, queue->_head), msg, queue->_msg_size);
+		push_head(queue);
+#if EAI_OSAL_STATS
+		osal_stats_acquired(&queue->_stats, contended,
+				    osal_stats_cycles() - start);
+#endif
 	}
 
-	memcpy(queue->_buf + queue->_head * queue->_msg_size, msg, queue->_msg_size);
-	queue->_head = (queue->_head + 1) % queue->_max_msgs;
-	queue->_count++;
-	pthread_cond_signal(&queue->_not_empty);
 	pthread_mutex_unlock(&queue->_lock);
-	return EAI_OSAL_OK;
+	if (rc == EAI_OSAL_OK) {
+		osal_poll_notify();
+	}
+	return rc;
 }
 
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
@@ -89,31 +161,201 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 
 	pthread_mutex_lock(&queue->_lock);
 
-	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		if (queue->_count == 0) {
-			pthread_mutex_unlock(&queue->_lock);
-			return EAI_OSAL_TIMEOUT;
-		}
-	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		while (queue->_count == 0) {
-			pthread_cond_wait(&queue->_not_empty, &queue->_lock);
-		}
-	} else {
-		struct timespec ts = osal_timespec(timeout_ms);
-		while (queue->_count == 0) {
-			int ret = pthread_cond_timedwait(&queue->_not_empty,
-							 &queue->_lock, &ts);
-			if (ret != 0) {
-				pthread_mutex_unlock(&queue->_lock);
-				return EAI_OSAL_TIMEOUT;
-			}
-		}
+	eai_osal_status_t rc = wait_for(queue, &queue->_not_empty, can_read,
+					timeout_ms);
+	if (rc == EAI_OSAL_OK) {
+		memcpy(msg, slot_at(queue, queue->_tail), queue->_msg_size);
+		pop_tail(queue);
 	}
 
-	memcpy(msg, queue->_buf + queue->_tail * queue->_msg_size, queue->_msg_size);
-	queue->_tail = (queue->_tail + 1) % queue->_max_msgs;
-	queue->_count--;
-	pthread_cond_signal(&queue->_not_full);
 	pthread_mutex_unlock(&queue->_lock);
+	return rc;
+}
+
+/* Wake one waiter for a single message, all of them for a batch */
+static void wake(pthread_cond_t *cond, uint32_t moved)
+{
+	if (moved == 1) {
+		osal_cond_signal(cond);
+	} else if (moved > 1) {
+		osal_cond_broadcast(cond);
+	}
+}
+
+uint32_t eai_osal_queue_send_many(eai_osal_queue_t *queue, const void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (wait_for(queue, &queue->_not_full, can_write, timeout_ms) != EAI_OSAL_OK) {
+		pthread_mutex_unlock(&queue->_lock);
+		return 0;
+	}
+
+	uint32_t space = queue->_max_msgs - queue->_count;
+
+	if (n > space) {
+		n = space;
+	}
+
+	/* At most two spans: head..end of buffer, then from the start */
+	uint32_t first = queue->_max_msgs - queue->_head;
+	const uint8_t *src = msgs;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(slot_at(queue, queue->_head), src, first * queue->_msg_size);
+	if (n > first) {
+		memcpy(queue->_buf, src + first * queue->_msg_size,
+		       (n - first) * queue->_msg_size);
+	}
+	queue->_head = (queue->_head + n) % queue->_max_msgs;
+	queue->_count += n;
+#if EAI_OSAL_STATS
+	osal_stats_depth(&queue->_stats, queue->_count);
+#endif
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, (uint16_t)n);
+	wake(&queue->_not_empty, n);
+
+	pthread_mutex_unlock(&queue->_lock);
+	osal_poll_notify();
+	return n;
+}
+
+uint32_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (wait_for(queue, &queue->_not_empty, can_read, timeout_ms) != EAI_OSAL_OK) {
+		pthread_mutex_unlock(&queue->_lock);
+		return 0;
+	}
+
+	if (n > queue->_count) {
+		n = queue->_count;
+	}
+
+	uint32_t first = queue->_max_msgs - queue->_tail;
+	uint8_t *dst = msgs;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(dst, slot_at(queue, queue->_tail), first * queue->_msg_size);
+	if (n > first) {
+		memcpy(dst + first * queue->_msg_size, queue->_buf,
+		       (n - first) * queue->_msg_size);
+	}
+	queue->_tail = (queue->_tail + n) % queue->_max_msgs;
+	queue->_count -= n;
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, (uint16_t)n);
+	wake(&queue->_not_full, n);
+
+	pthread_mutex_unlock(&queue->_lock);
+	return n;
+}
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (queue->_reserved) {
+		pthread_mutex_unlock(&queue->_lock);
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t rc = wait_for(queue, &queue->_not_full, can_write,
+					timeout_ms);
+	if (rc == EAI_OSAL_OK) {
+		queue->_reserved = true;
+		*slot = slot_at(queue, queue->_head);
+	}
+
+	pthread_mutex_unlock(&queue->_lock);
+	return rc;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (!queue->_reserved) {
+		pthread_mutex_unlock(&queue->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	queue->_reserved = false;
+	push_head(queue);
+	/* Producers parked behind the reservation may all proceed now */
+	osal_cond_broadcast(&queue->_not_full);
+
+	pthread_mutex_unlock(&queue->_lock);
+	osal_poll_notify();
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **msg,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || msg == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (queue->_peeked) {
+		pthread_mutex_unlock(&queue->_lock);
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t rc = wait_for(queue, &queue->_not_empty, can_read,
+					timeout_ms);
+	if (rc == EAI_OSAL_OK) {
+		queue->_peeked = true;
+		*msg = slot_at(queue, queue->_tail);
+	}
+
+	pthread_mutex_unlock(&queue->_lock);
+	return rc;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&queue->_lock);
+
+	if (!queue->_peeked) {
+		pthread_mutex_unlock(&queue->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	queue->_peeked = false;
+	pop_tail(queue);
+	/* Consumers parked behind the peek may all proceed now */
+	osal_cond_broadcast(&queue->_not_empty);
+
+	pthread_mutex_unlock(&queue->_lock);
+	/* Messages behind the peek become visible to pollers */
+	osal_poll_notify();
 	return EAI_OSAL_OK;
 }
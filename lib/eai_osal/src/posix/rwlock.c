@@ -0,0 +1,158 @@
+#include <eai_osal/rwlock.h>
+#include <eai_osal/time.h>
+#include "internal.h"
+
+/*
+ * Writer-preferring rwlock on a mutex and two monotonic condvars.
+ * pthread_rwlock_t is not used: its preference is implementation-defined
+ * (glibc prefers readers) and its timed waits run on CLOCK_REALTIME.
+ */
+
+static uint64_t deadline_of(uint32_t timeout_ms)
+{
+	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
+		return UINT64_MAX;
+	}
+	return eai_osal_time_get_ticks() + (uint64_t)timeout_ms * 1000;
+}
+
+/* One wait on cond; returns non-zero once the deadline has passed */
+static int wait(pthread_cond_t *cond, pthread_mutex_t *mtx, uint64_t deadline)
+{
+	if (deadline == UINT64_MAX) {
+		osal_cond_wait(cond, mtx);
+		return 0;
+	}
+	return osal_cond_wait_until(cond, mtx, deadline);
+}
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	lock->_readers = 0;
+	lock->_writers_waiting = 0;
+	lock->_writer = false;
+
+	if (pthread_mutex_init(&lock->_lock, NULL) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	if (osal_cond_init_monotonic(&lock->_read_ok) != 0) {
+		pthread_mutex_destroy(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (osal_cond_init_monotonic(&lock->_write_ok) != 0) {
+		pthread_cond_destroy(&lock->_read_ok);
+		pthread_mutex_destroy(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pthread_cond_destroy(&lock->_write_ok);
+	pthread_cond_destroy(&lock->_read_ok);
+	pthread_mutex_destroy(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *lock,
+					    uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint64_t deadline = deadline_of(timeout_ms);
+
+	pthread_mutex_lock(&lock->_lock);
+	while (lock->_writer || lock->_writers_waiting > 0) {
+		if (timeout_ms == EAI_OSAL_NO_WAIT ||
+		    wait(&lock->_read_ok, &lock->_lock, deadline) != 0) {
+			if (!lock->_writer && lock->_writers_waiting == 0) {
+				break; /* freed just as the wait expired */
+			}
+			pthread_mutex_unlock(&lock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	lock->_readers++;
+	pthread_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&lock->_lock);
+	if (lock->_readers == 0) {
+		pthread_mutex_unlock(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (--lock->_readers == 0 && lock->_writers_waiting > 0) {
+		osal_cond_signal(&lock->_write_ok);
+	}
+	pthread_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *lock,
+					     uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint64_t deadline = deadline_of(timeout_ms);
+
+	pthread_mutex_lock(&lock->_lock);
+	lock->_writers_waiting++;
+	while (lock->_writer || lock->_readers > 0) {
+		if (timeout_ms == EAI_OSAL_NO_WAIT ||
+		    wait(&lock->_write_ok, &lock->_lock, deadline) != 0) {
+			if (!lock->_writer && lock->_readers == 0) {
+				break;
+			}
+			/* Readers held back only by this writer may go now */
+			if (--lock->_writers_waiting == 0 && !lock->_writer) {
+				osal_cond_broadcast(&lock->_read_ok);
+			}
+			pthread_mutex_unlock(&lock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	lock->_writers_waiting--;
+	lock->_writer = true;
+	pthread_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&lock->_lock);
+	if (!lock->_writer) {
+		pthread_mutex_unlock(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	lock->_writer = false;
+	if (lock->_writers_waiting > 0) {
+		osal_cond_signal(&lock->_write_ok);
+	} else {
+		osal_cond_broadcast(&lock->_read_ok);
+	}
+	pthread_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
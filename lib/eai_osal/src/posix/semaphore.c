@@ -1,6 +1,129 @@
 #include <eai_osal/semaphore.h>
+#include <eai_osal/time.h>
 #include "internal.h"
 
+#if EAI_OSAL_POSIX_FUTEX
+
+/*
+ * _state holds the count in its low half (the futex word) and the number
+ * of parked takers in its high half. give bumps the count with one CAS
+ * and calls FUTEX_WAKE only if that CAS saw a taker; take decrements with
+ * a CAS and only sleeps when the count is zero.
+ *
+ * A taker registers before its last look at the count, on the same word
+ * give updates, so give either sees the taker or the taker sees the new
+ * count. FUTEX_WAIT re-checks count == 0 in the kernel, so a give that
+ * lands between the look and the sleep makes it return at once.
+ */
+
+#define SEM_COUNT(s) ((uint32_t)(s))
+
+eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
+				      uint32_t limit)
+{
+	if (sem == NULL || limit == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	sem->_state = initial;
+	sem->_limit = limit;
+#if EAI_OSAL_STATS
+	osal_stats_init(&sem->_stats, EAI_OSAL_STATS_SEM);
+#endif
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&sem->_stats);
+#endif
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_GIVE, sem, 0);
+
+	uint32_t limit = sem->_limit;
+	uint64_t s = __atomic_load_n(&sem->_state, __ATOMIC_RELAXED);
+
+	do {
+		if (SEM_COUNT(s) >= limit) {
+			/* At limit — silently ignore, matching FreeRTOS behavior */
+			return EAI_OSAL_OK;
+		}
+	} while (!__atomic_compare_exchange_n(&sem->_state, &s, s + 1, true,
+					      __ATOMIC_SEQ_CST,
+					      __ATOMIC_RELAXED));
+
+	/* sem may already be gone here; only its address is used */
+	if (s >= OSAL_FUTEX_WAITER) {
+		osal_futex_wake(osal_futex_lo(&sem->_state), 1);
+	}
+	osal_poll_notify();
+	return EAI_OSAL_OK;
+}
+
+static eai_osal_status_t sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
+{
+
+	uint64_t s = __atomic_load_n(&sem->_state, __ATOMIC_RELAXED);
+
+	while (SEM_COUNT(s) > 0) {
+		if (__atomic_compare_exchange_n(&sem->_state, &s, s - 1, true,
+						__ATOMIC_ACQUIRE,
+						__ATOMIC_RELAXED)) {
+			return EAI_OSAL_OK;
+		}
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	uint64_t deadline = UINT64_MAX;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		deadline = eai_osal_time_get_ticks() + (uint64_t)timeout_ms * 1000;
+	}
+
+	/* Register, then take-and-unregister or unregister in one CAS */
+	bool expired = false;
+
+	s = __atomic_add_fetch(&sem->_state, OSAL_FUTEX_WAITER, __ATOMIC_RELAXED);
+	for (;;) {
+		if (SEM_COUNT(s) > 0) {
+			if (__atomic_compare_exchange_n(&sem->_state, &s,
+							s - 1 - OSAL_FUTEX_WAITER,
+							true, __ATOMIC_ACQUIRE,
+							__ATOMIC_RELAXED)) {
+				return EAI_OSAL_OK;
+			}
+			continue;
+		}
+		if (expired) {
+			if (__atomic_compare_exchange_n(&sem->_state, &s,
+							s - OSAL_FUTEX_WAITER,
+							true, __ATOMIC_RELAXED,
+							__ATOMIC_RELAXED)) {
+				return EAI_OSAL_TIMEOUT;
+			}
+			continue;
+		}
+		expired = osal_futex_wait(osal_futex_lo(&sem->_state), 0,
+					  deadline) == ETIMEDOUT;
+		s = __atomic_load_n(&sem->_state, __ATOMIC_RELAXED);
+	}
+}
+
+#else /* !EAI_OSAL_POSIX_FUTEX */
+
 eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 				      uint32_t limit)
 {
@@ -10,6 +133,9 @@ eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 
 	sem->_count = initial;
 	sem->_limit = limit;
+#if EAI_OSAL_STATS
+	osal_stats_init(&sem->_stats, EAI_OSAL_STATS_SEM);
+#endif
 
 	if (pthread_mutex_init(&sem->_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
@@ -26,6 +152,9 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&sem->_stats);
+#endif
 	pthread_cond_destroy(&sem->_cond);
 	pthread_mutex_destroy(&sem->_lock);
 	return EAI_OSAL_OK;
@@ -36,22 +165,21 @@ eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_GIVE, sem, 0);
 
 	pthread_mutex_lock(&sem->_lock);
 	if (sem->_count < sem->_limit) {
 		sem->_count++;
-		pthread_cond_signal(&sem->_cond);
+		osal_cond_signal(&sem->_cond);
 	}
 	/* At limit — silently ignore, matching FreeRTOS behavior */
 	pthread_mutex_unlock(&sem->_lock);
+	osal_poll_notify();
 	return EAI_OSAL_OK;
 }
 
-eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
+static eai_osal_status_t sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 {
-	if (sem == NULL) {
-		return EAI_OSAL_INVALID_PARAM;
-	}
 
 	pthread_mutex_lock(&sem->_lock);
 
@@ -67,7 +195,7 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		while (sem->_count == 0) {
-			pthread_cond_wait(&sem->_cond, &sem->_lock);
+			osal_cond_wait(&sem->_cond, &sem->_lock);
 		}
 		sem->_count--;
 		pthread_mutex_unlock(&sem->_lock);
@@ -78,7 +206,7 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	struct timespec ts = osal_timespec(timeout_ms);
 
 	while (sem->_count == 0) {
-		int ret = pthread_cond_timedwait(&sem->_cond, &sem->_lock, &ts);
+		int ret = osal_cond_timedwait(&sem->_cond, &sem->_lock, &ts);
 		if (ret != 0) {
 			pthread_mutex_unlock(&sem->_lock);
 			return EAI_OSAL_TIMEOUT;
@@ -88,3 +216,36 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	pthread_mutex_unlock(&sem->_lock);
 	return EAI_OSAL_OK;
 }
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
+
+eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret;
+
+#if EAI_OSAL_STATS
+	ret = sem_take(sem, EAI_OSAL_NO_WAIT);
+
+	if (ret == EAI_OSAL_OK) {
+		osal_stats_acquired(&sem->_stats, false, 0);
+	} else if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint32_t start = osal_stats_cycles();
+
+		ret = sem_take(sem, timeout_ms);
+		if (ret == EAI_OSAL_OK) {
+			osal_stats_acquired(&sem->_stats, true,
+					    osal_stats_cycles() - start);
+		}
+	}
+#else
+	ret = sem_take(sem, timeout_ms);
+#endif
+	if (ret == EAI_OSAL_OK) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_TAKE, sem, 0);
+	}
+	return ret;
+}
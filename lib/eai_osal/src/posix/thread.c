@@ -1,18 +1,73 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_setaffinity_np */
+#endif
+
 #include <eai_osal/thread.h>
 #include "internal.h"
+#include <errno.h>
 #include <unistd.h>
 #include <sched.h>
+#include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+/*
+ * Scheduling. OSAL priorities 0-31 map to levels 1-32 of
+ * EAI_OSAL_POSIX_SCHED_POLICY, which keeps OSAL threads below threaded
+ * IRQ handlers (50) on PREEMPT_RT. The policy is set through the thread
+ * attributes, so a thread never runs at the wrong priority.
+ *
+ * Without CAP_SYS_NICE the kernel refuses a real-time policy. The thread
+ * is then created with SCHED_OTHER and sets its own nice value to
+ * PRIO_NICE_ZERO - priority, one nice step per OSAL level. Raising nice
+ * is always allowed; a negative value needs RLIMIT_NICE headroom and is
+ * skipped without it. Build with EAI_OSAL_POSIX_SCHED_POLICY=SCHED_OTHER
+ * to use nice values only.
+ */
+#ifndef EAI_OSAL_POSIX_SCHED_POLICY
+#define EAI_OSAL_POSIX_SCHED_POLICY SCHED_FIFO
+#endif
+
+#define PRIO_NICE_ZERO 16 /* OSAL priority that maps to nice 0 */
+
+static int rt_priority(uint8_t priority)
+{
+	int lo = sched_get_priority_min(EAI_OSAL_POSIX_SCHED_POLICY);
+	int hi = sched_get_priority_max(EAI_OSAL_POSIX_SCHED_POLICY);
+	int prio = lo + (int)priority;
+
+	return prio > hi ? hi : prio;
+}
+
+/* Nice fallback, applied by the new thread to itself. */
+static void apply_nice(uint8_t priority)
+{
+#if defined(__linux__)
+	/* Linux keeps nice per thread, addressed by TID */
+	setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid),
+		    PRIO_NICE_ZERO - (int)priority);
+#else
+	/* Elsewhere nice is per process — leave it alone */
+	(void)priority;
+#endif
+}
 
 static void *thread_trampoline(void *arg)
 {
 	eai_osal_thread_t *thread = (eai_osal_thread_t *)arg;
 
+	if (!thread->_rt) {
+		apply_nice(thread->_priority);
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_START, thread->_entry, 0);
 	thread->_entry(thread->_entry_arg);
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_EXIT, thread->_entry, 0);
 
 	/* Signal join waiters */
 	pthread_mutex_lock(&thread->_join_lock);
 	thread->_done = true;
-	pthread_cond_broadcast(&thread->_join_cond);
+	osal_cond_broadcast(&thread->_join_cond);
 	pthread_mutex_unlock(&thread->_join_lock);
 
 	return NULL;
@@ -38,6 +93,7 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 	thread->_entry = entry;
 	thread->_entry_arg = arg;
 	thread->_done = false;
+	thread->_priority = priority;
 
 	if (pthread_mutex_init(&thread->_join_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
@@ -51,7 +107,25 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 	pthread_attr_init(&attr);
 	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
 
-	int ret = pthread_create(&thread->_handle, &attr, thread_trampoline, thread);
+	thread->_rt = EAI_OSAL_POSIX_SCHED_POLICY != SCHED_OTHER;
+	if (thread->_rt) {
+		struct sched_param sp = { .sched_priority = rt_priority(priority) };
+
+		pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attr, EAI_OSAL_POSIX_SCHED_POLICY);
+		pthread_attr_setschedparam(&attr, &sp);
+	}
+
+	int ret = osal_pthread_create(&thread->_handle, &attr,
+				      thread_trampoline, thread);
+
+	if (ret == EPERM && thread->_rt) {
+		/* Real-time policy not permitted — fall back to nice */
+		thread->_rt = false;
+		pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+		ret = osal_pthread_create(&thread->_handle, &attr,
+					  thread_trampoline, thread);
+	}
 	pthread_attr_destroy(&attr);
 
 	if (ret != 0) {
@@ -60,10 +134,6 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 		return EAI_OSAL_ERROR;
 	}
 
-	/* Best-effort priority setting — no error if insufficient privileges */
-	struct sched_param sp = { .sched_priority = 0 };
-	pthread_setschedparam(thread->_handle, SCHED_OTHER, &sp);
-
 	return EAI_OSAL_OK;
 }
 
@@ -78,15 +148,14 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		while (!thread->_done) {
-			pthread_cond_wait(&thread->_join_cond,
-					  &thread->_join_lock);
+			osal_cond_wait(&thread->_join_cond, &thread->_join_lock);
 		}
 	} else {
 		struct timespec ts = osal_timespec(timeout_ms);
 		while (!thread->_done) {
-			int ret = pthread_cond_timedwait(&thread->_join_cond,
-							 &thread->_join_lock,
-							 &ts);
+			int ret = osal_cond_timedwait(&thread->_join_cond,
+						      &thread->_join_lock,
+						      &ts);
 			if (ret != 0) {
 				pthread_mutex_unlock(&thread->_join_lock);
 				return EAI_OSAL_TIMEOUT;
@@ -101,12 +170,68 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return EAI_OSAL_OK;
 }
 
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (cpu_mask == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+#if defined(__linux__)
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	for (int cpu = 0; cpu < 32; cpu++) {
+		if (cpu_mask & (1U << cpu)) {
+			CPU_SET(cpu, &set);
+		}
+	}
+
+	pthread_t handle = thread != NULL ? thread->_handle : pthread_self();
+
+	return pthread_setaffinity_np(handle, sizeof(set), &set) == 0
+		? EAI_OSAL_OK : EAI_OSAL_ERROR;
+#else
+	/* No portable thread affinity API (e.g. macOS) */
+	(void)thread;
+	return EAI_OSAL_ERROR;
+#endif
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
+#if EAI_OSAL_POSIX_VTIME
+	osal_vt_sleep((uint64_t)ms * 1000);
+#else
 	usleep((useconds_t)ms * 1000);
+#endif
 }
 
 void eai_osal_thread_yield(void)
 {
 	sched_yield();
 }
+
+#if EAI_OSAL_TRACE
+uint32_t osal_trace_cpu(void)
+{
+#if defined(__linux__)
+	int cpu = sched_getcpu();
+
+	return cpu < 0 ? 0 : (uint32_t)cpu;
+#else
+	return 0;
+#endif
+}
+
+/* Small sequential ids read better on a timeline than pthread_t values */
+uint32_t osal_trace_thread(void)
+{
+	static uint32_t next_id;
+	static __thread uint32_t id;
+
+	if (id == 0) {
+		id = __atomic_add_fetch(&next_id, 1, __ATOMIC_RELAXED);
+	}
+	return id;
+}
+#endif
@@ -1,13 +1,26 @@
 #include <eai_osal/time.h>
 #include <time.h>
+#include "internal.h"
 
 /*
- * POSIX time — uses CLOCK_MONOTONIC for monotonic uptime.
+ * POSIX time — uses CLOCK_MONOTONIC for monotonic uptime, or the
+ * simulated clock under EAI_OSAL_POSIX_VTIME.
  * Ticks are microseconds for reasonable precision without overflow.
  */
 
 #define TICKS_PER_MS 1000 /* 1 tick = 1 microsecond */
 
+#if EAI_OSAL_POSIX_VTIME
+uint32_t eai_osal_time_get_ms(void)
+{
+	return (uint32_t)(osal_vt_now() / TICKS_PER_MS);
+}
+
+uint64_t eai_osal_time_get_ticks(void)
+{
+	return osal_vt_now();
+}
+#else
 uint32_t eai_osal_time_get_ms(void)
 {
 	struct timespec ts;
@@ -23,8 +36,22 @@ uint64_t eai_osal_time_get_ticks(void)
 	clock_gettime(CLOCK_MONOTONIC, &ts);
 	return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
 }
+#endif
 
 uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)(ticks / TICKS_PER_MS);
 }
+
+#if EAI_OSAL_STATS
+/* Stats clock: low 32 bits of the microsecond tick count */
+uint32_t osal_stats_cycles(void)
+{
+	return (uint32_t)eai_osal_time_get_ticks();
+}
+
+uint32_t osal_stats_cycles_to_us(uint32_t cycles)
+{
+	return cycles;
+}
+#endif
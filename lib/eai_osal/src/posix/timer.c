@@ -1,65 +1,157 @@
 #include <eai_osal/timer.h>
+#include <eai_osal/time.h>
+#include <eai_osal/workqueue.h>
 #include "internal.h"
+#include "deadline.h"
 
-static void *timer_thread_func(void *arg)
+/*
+ * POSIX timers — one shared service thread multiplexes every timer.
+ *
+ * Armed timers sit in a deadline heap keyed on monotonic microseconds.
+ * The service thread sleeps until the earliest deadline, fires whatever
+ * has expired and re-arms periodic timers. Start/stop are heap operations
+ * under a single lock; no per-timer threads exist.
+ *
+ * Periodic timers re-arm on their original grid (previous deadline +
+ * period), not relative to when the callback ran, so callback time and
+ * wakeup latency never accumulate as drift. If the service thread falls
+ * a full period or more behind, the missed expirations are skipped and
+ * counted as overruns; a deferred dispatch that finds the previous one
+ * still queued counts as an overrun too.
+ *
+ * Inline callbacks share the service thread, so a slow callback delays
+ * every other timer. Timers with long-running callbacks should use
+ * EAI_OSAL_TIMER_DISPATCH_WORKQUEUE.
+ */
+
+#define TIMER_SVC_STACK_SIZE 65536
+
+#define TIMER_OF(node) \
+	((eai_osal_timer_t *)((uint8_t *)(node) - offsetof(eai_osal_timer_t, _node)))
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;      /* earliest deadline changed, monotonic */
+	pthread_cond_t idle;      /* a callback dispatch finished */
+	pthread_t thread;
+	struct eai_osal_deadline_heap heap;
+	eai_osal_timer_t *firing; /* timer being dispatched, lock released */
+	bool started;
+} svc = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.idle = PTHREAD_COND_INITIALIZER,
+};
+
+static void dispatch(eai_osal_timer_t *timer, bool deferred,
+		     eai_osal_workqueue_t *wq)
+{
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_TIMER_FIRE, timer, 0);
+	if (!deferred) {
+		timer->_cb(timer->_cb_arg);
+	} else if (wq == NULL) {
+		eai_osal_work_submit(&timer->_work);
+	} else {
+		eai_osal_work_submit_to(&timer->_work, wq);
+	}
+}
+
+/*
+ * Next slot on the timer's grid at or after now; a slot due exactly now
+ * still fires. Only slots strictly in the past are overruns. Caller holds
+ * svc.lock.
+ */
+static void rearm(eai_osal_timer_t *timer, uint64_t now)
 {
-	eai_osal_timer_t *timer = (eai_osal_timer_t *)arg;
+	uint64_t period = (uint64_t)timer->_period_ms * 1000;
+	uint64_t next = timer->_node._deadline + period;
 
-	pthread_mutex_lock(&timer->_lock);
+	if (next < now) {
+		uint64_t missed = (now - next - 1) / period + 1;
 
-	/* Wait for first start signal */
-	while (!timer->_running && !timer->_destroy) {
-		pthread_cond_wait(&timer->_cond, &timer->_lock);
+		timer->_overruns += (uint32_t)missed;
+		next += missed * period;
 	}
+	osal_deadline_insert(&svc.heap, &timer->_node, next);
+}
 
-	while (!timer->_destroy) {
-		if (!timer->_running) {
-			pthread_cond_wait(&timer->_cond, &timer->_lock);
-			continue;
-		}
+static void *timer_svc_thread(void *arg)
+{
+	(void)arg;
 
-		/* Determine wait: initial_ms for first fire, period_ms after */
-		uint32_t wait_ms;
-		if (timer->_initial_ms > 0) {
-			wait_ms = timer->_initial_ms;
-		} else {
-			wait_ms = timer->_period_ms;
-		}
+	pthread_mutex_lock(&svc.lock);
 
-		struct timespec ts = osal_timespec(wait_ms);
-		pthread_cond_timedwait(&timer->_cond, &timer->_lock, &ts);
+	for (;;) {
+		struct eai_osal_deadline *next = osal_deadline_peek(&svc.heap);
 
-		if (timer->_destroy) {
-			break;
+		if (next == NULL) {
+			osal_cond_wait(&svc.cond, &svc.lock);
+			continue;
 		}
-		if (!timer->_running) {
+
+		uint64_t now = eai_osal_time_get_ticks();
+
+		if (next->_deadline > now) {
+			osal_cond_wait_until(&svc.cond, &svc.lock, next->_deadline);
 			continue;
 		}
 
-		/* Fire callback with lock released */
-		eai_osal_timer_cb_t cb = timer->_cb;
-		void *cb_arg = timer->_cb_arg;
-		pthread_mutex_unlock(&timer->_lock);
+		eai_osal_timer_t *timer = TIMER_OF(osal_deadline_pop(&svc.heap));
 
-		if (cb != NULL) {
-			cb(cb_arg);
+		if (timer->_period_ms > 0) {
+			rearm(timer, now);
+		} else {
+			timer->_running = false;
 		}
 
-		pthread_mutex_lock(&timer->_lock);
+		/* Dispatch with lock released; destroy waits on svc.idle */
+		bool deferred = timer->_deferred;
+		eai_osal_workqueue_t *wq = timer->_wq;
 
-		/* After initial fire: switch to repeat period or stop */
-		if (timer->_initial_ms > 0) {
-			timer->_initial_ms = 0;
-			if (timer->_period_ms == 0) {
-				timer->_running = false;
-			}
+		if (deferred && (__atomic_load_n(&timer->_work._state,
+						 __ATOMIC_ACQUIRE) & WORK_QUEUED)) {
+			timer->_overruns++;
 		}
+
+		svc.firing = timer;
+		pthread_mutex_unlock(&svc.lock);
+
+		dispatch(timer, deferred, wq);
+
+		pthread_mutex_lock(&svc.lock);
+		svc.firing = NULL;
+		osal_cond_broadcast(&svc.idle);
 	}
 
-	pthread_mutex_unlock(&timer->_lock);
 	return NULL;
 }
 
+/* Lazily start the service thread. Caller holds svc.lock. */
+static eai_osal_status_t svc_ensure_started(void)
+{
+	if (svc.started) {
+		return EAI_OSAL_OK;
+	}
+
+	if (osal_cond_init_monotonic(&svc.cond) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, TIMER_SVC_STACK_SIZE);
+
+	int rc = osal_pthread_create(&svc.thread, &attr, timer_svc_thread, NULL);
+	pthread_attr_destroy(&attr);
+
+	if (rc != 0) {
+		pthread_cond_destroy(&svc.cond);
+		return EAI_OSAL_ERROR;
+	}
+	pthread_detach(svc.thread);
+	svc.started = true;
+	return EAI_OSAL_OK;
+}
+
 eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 					eai_osal_timer_cb_t callback,
 					void *arg)
@@ -68,23 +160,16 @@ eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
+	timer->_node._linked = false;
 	timer->_cb = callback;
 	timer->_cb_arg = arg;
-	timer->_initial_ms = 0;
 	timer->_period_ms = 0;
 	timer->_running = false;
-	timer->_destroy = false;
-	timer->_thread_alive = false;
+	timer->_deferred = false;
+	timer->_wq = NULL;
+	timer->_overruns = 0;
 
-	if (pthread_mutex_init(&timer->_lock, NULL) != 0) {
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&timer->_cond, NULL) != 0) {
-		pthread_mutex_destroy(&timer->_lock);
-		return EAI_OSAL_ERROR;
-	}
-
-	return EAI_OSAL_OK;
+	return eai_osal_work_init(&timer->_work, callback, arg);
 }
 
 eai_osal_status_t eai_osal_timer_destroy(eai_osal_timer_t *timer)
@@ -93,20 +178,20 @@ eai_osal_status_t eai_osal_timer_destroy(eai_osal_timer_t *timer)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	pthread_mutex_lock(&timer->_lock);
-	timer->_destroy = true;
+	pthread_mutex_lock(&svc.lock);
+	osal_deadline_remove(&svc.heap, &timer->_node);
 	timer->_running = false;
-	pthread_cond_signal(&timer->_cond);
-	bool alive = timer->_thread_alive;
-	pthread_mutex_unlock(&timer->_lock);
 
-	if (alive) {
-		pthread_join(timer->_thread, NULL);
+	/* Wait out an in-flight callback unless we are that callback */
+	if (svc.started && !pthread_equal(pthread_self(), svc.thread)) {
+		while (svc.firing == timer) {
+			osal_cond_wait(&svc.idle, &svc.lock);
+		}
 	}
+	pthread_mutex_unlock(&svc.lock);
 
-	pthread_cond_destroy(&timer->_cond);
-	pthread_mutex_destroy(&timer->_lock);
-	return EAI_OSAL_OK;
+	/* A deferred dispatch may still sit on a work queue */
+	return eai_osal_work_cancel_sync(&timer->_work);
 }
 
 eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
@@ -117,25 +202,26 @@ eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	pthread_mutex_lock(&timer->_lock);
-	timer->_initial_ms = initial_ms;
+	pthread_mutex_lock(&svc.lock);
+
+	if (svc_ensure_started() != EAI_OSAL_OK) {
+		pthread_mutex_unlock(&svc.lock);
+		return EAI_OSAL_ERROR;
+	}
+
+	osal_deadline_remove(&svc.heap, &timer->_node);
 	timer->_period_ms = period_ms;
 	timer->_running = true;
-	timer->_destroy = false;
+	timer->_overruns = 0;
+	osal_deadline_insert(&svc.heap, &timer->_node,
+			     eai_osal_time_get_ticks() + (uint64_t)initial_ms * 1000);
 
-	if (!timer->_thread_alive) {
-		int ret = pthread_create(&timer->_thread, NULL,
-					 timer_thread_func, timer);
-		if (ret != 0) {
-			timer->_running = false;
-			pthread_mutex_unlock(&timer->_lock);
-			return EAI_OSAL_ERROR;
-		}
-		timer->_thread_alive = true;
+	/* Only wake the service thread if its next deadline moved earlier */
+	if (osal_deadline_peek(&svc.heap) == &timer->_node) {
+		osal_cond_signal(&svc.cond);
 	}
 
-	pthread_cond_signal(&timer->_cond);
-	pthread_mutex_unlock(&timer->_lock);
+	pthread_mutex_unlock(&svc.lock);
 	return EAI_OSAL_OK;
 }
 
@@ -144,10 +230,10 @@ eai_osal_status_t eai_osal_timer_stop(eai_osal_timer_t *timer)
 	if (timer == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	pthread_mutex_lock(&timer->_lock);
+	pthread_mutex_lock(&svc.lock);
+	osal_deadline_remove(&svc.heap, &timer->_node);
 	timer->_running = false;
-	pthread_cond_signal(&timer->_cond);
-	pthread_mutex_unlock(&timer->_lock);
+	pthread_mutex_unlock(&svc.lock);
 	return EAI_OSAL_OK;
 }
 
@@ -156,8 +242,33 @@ bool eai_osal_timer_is_running(eai_osal_timer_t *timer)
 	if (timer == NULL) {
 		return false;
 	}
-	pthread_mutex_lock(&timer->_lock);
+	pthread_mutex_lock(&svc.lock);
 	bool running = timer->_running;
-	pthread_mutex_unlock(&timer->_lock);
+	pthread_mutex_unlock(&svc.lock);
 	return running;
 }
+
+eai_osal_status_t eai_osal_timer_set_dispatch(eai_osal_timer_t *timer,
+					      eai_osal_timer_dispatch_t mode,
+					      eai_osal_workqueue_t *wq)
+{
+	if (timer == NULL || mode > EAI_OSAL_TIMER_DISPATCH_WORKQUEUE) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pthread_mutex_lock(&svc.lock);
+	timer->_deferred = (mode == EAI_OSAL_TIMER_DISPATCH_WORKQUEUE);
+	timer->_wq = timer->_deferred ? wq : NULL;
+	pthread_mutex_unlock(&svc.lock);
+	return EAI_OSAL_OK;
+}
+
+uint32_t eai_osal_timer_get_overruns(eai_osal_timer_t *timer)
+{
+	if (timer == NULL) {
+		return 0;
+	}
+	pthread_mutex_lock(&svc.lock);
+	uint32_t overruns = timer->_overruns;
+	pthread_mutex_unlock(&svc.lock);
+	return overruns;
+}
@@ -11,13 +11,45 @@
 
 typedef struct {
 	pthread_mutex_t _handle;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_mutex_t;
 
+/*
+ * -DEAI_OSAL_POSIX_VTIME=1 runs the backend on a simulated clock, see
+ * vtime.c. Every wait then goes through a condvar the clock can see.
+ */
+#ifndef EAI_OSAL_POSIX_VTIME
+#define EAI_OSAL_POSIX_VTIME 0
+#endif
+
+/*
+ * Linux semaphores and events are an atomic word plus a futex: give/set
+ * and an uncontended take/wait never enter the kernel. Other hosts (or
+ * -DEAI_OSAL_POSIX_FUTEX=0) use the portable mutex + condvar version.
+ */
+#ifndef EAI_OSAL_POSIX_FUTEX
+#if defined(__linux__) && !EAI_OSAL_POSIX_VTIME
+#define EAI_OSAL_POSIX_FUTEX 1
+#else
+#define EAI_OSAL_POSIX_FUTEX 0
+#endif
+#endif
+
 typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	/* count (low half, the futex word) | parked takers << 32 */
+	uint64_t _state __attribute__((aligned(8)));
+#else
 	pthread_mutex_t _lock;
 	pthread_cond_t _cond;
 	uint32_t _count;
+#endif
 	uint32_t _limit;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_sem_t;
 
 typedef struct {
@@ -27,6 +59,8 @@ typedef struct {
 	pthread_mutex_t _join_lock;
 	pthread_cond_t _join_cond;
 	bool _done;
+	bool _rt;          /* created with the real-time policy */
+	uint8_t _priority; /* OSAL priority, for the nice fallback */
 } eai_osal_thread_t;
 
 typedef struct {
@@ -39,57 +73,151 @@ typedef struct {
 	uint32_t _head;
 	uint32_t _tail;
 	uint32_t _count;
+	bool _reserved; /* head slot handed out by reserve(), not yet committed */
+	bool _peeked;   /* tail slot handed out by peek(), not yet released */
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_queue_t;
 
+/* Intrusive deadline heap node — see src/posix/deadline.c */
+struct eai_osal_deadline {
+	uint64_t _deadline; /* absolute, monotonic microseconds */
+	uint64_t _seq;
+	struct eai_osal_deadline *_child;
+	struct eai_osal_deadline *_next;
+	struct eai_osal_deadline *_prev;
+	bool _linked;
+};
+
+struct eai_osal_deadline_heap {
+	struct eai_osal_deadline *_root;
+	uint64_t _seq; /* insertion counter — FIFO order for equal deadlines */
+	uint32_t _count;
+};
+
+/* Work item — queued by pointer, _state tracks queued/running */
 typedef struct {
-	pthread_t _thread;
-	pthread_mutex_t _lock;
-	pthread_cond_t _cond;
+	eai_osal_work_cb_t _cb;
+	void *_cb_arg;
+	uint32_t _state; /* WORK_* bits, see workqueue.c */
+	uint8_t _lane;   /* priority lane, see eai_osal_work_set_lane() */
+} eai_osal_work_t;
+
+/* Forward declaration for delayed work / timer dispatch target */
+struct eai_osal_workqueue;
+
+/* Timer — multiplexed onto the shared timer service thread */
+typedef struct {
+	struct eai_osal_deadline _node;
 	eai_osal_timer_cb_t _cb;
 	void *_cb_arg;
-	uint32_t _initial_ms;
 	uint32_t _period_ms;
 	bool _running;
-	bool _destroy;
-	bool _thread_alive;
+	bool _deferred;                 /* dispatch via work queue */
+	struct eai_osal_workqueue *_wq; /* NULL = system work queue */
+	eai_osal_work_t _work;
+	uint32_t _overruns;             /* expirations missed since start */
 } eai_osal_timer_t;
 
 typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	/* bits (low half, the futex word) | parked waiters << 32 */
+	uint64_t _state __attribute__((aligned(8)));
+#else
 	pthread_mutex_t _lock;
 	pthread_cond_t _cond;
 	uint32_t _bits;
+#endif
 } eai_osal_event_t;
 
 typedef unsigned int eai_osal_critical_key_t;
 
-/* Work item — submitted to a work queue */
+/* Reader-writer lock — writer-preferring, see src/posix/rwlock.c */
 typedef struct {
-	eai_osal_work_cb_t _cb;
-	void *_cb_arg;
-} eai_osal_work_t;
+	pthread_mutex_t _lock;
+	pthread_cond_t _read_ok;  /* no writer holds or wants the lock */
+	pthread_cond_t _write_ok; /* last reader or writer left */
+	uint32_t _readers;
+	uint32_t _writers_waiting;
+	bool _writer;
+} eai_osal_rwlock_t;
 
-/* Forward declaration for delayed work target */
-struct eai_osal_workqueue;
+/* Fixed-block pool — lock-free free list, links live in the free blocks */
+typedef struct {
+	uint8_t *_buf;
+	size_t _block_size;
+	uint32_t _num_blocks;
+	/* first free block index + 1 (0 = empty) | ABA tag << 32 */
+	uint64_t _head __attribute__((aligned(8)));
+	uint32_t _in_use;
+	uint32_t _peak;
+	uint32_t _failed;
+} eai_osal_mempool_t;
 
-/* Delayed work — uses a timer thread to defer submission */
+/* Delayed work — parked in the target work queue's deadline heap */
 typedef struct {
-	eai_osal_work_cb_t _cb;
-	void *_cb_arg;
-	pthread_t _timer_thread;
-	pthread_mutex_t _lock;
-	pthread_cond_t _cond;
-	uint32_t _delay_ms;
-	void *_target_wq; /* eai_osal_workqueue_t*, NULL = system */
-	bool _pending;
-	bool _cancel;
-	bool _thread_alive;
+	struct eai_osal_deadline _node;
+	eai_osal_work_t _work;          /* queued on expiry */
+	struct eai_osal_workqueue *_wq; /* queue whose heap holds _node */
 } eai_osal_dwork_t;
 
-/* Work queue — thread that processes {cb, arg} items from an internal queue */
+#define EAI_OSAL_WQ_POOL_DEPTH 16
+
+/* Pool worker — one thread draining its own deque, stealing when idle */
+typedef struct eai_osal_wq_worker {
+	pthread_t _thread;
+	struct eai_osal_workqueue *_wq;
+	pthread_mutex_t _lock;
+	eai_osal_work_t *_items[EAI_OSAL_WQ_POOL_DEPTH];
+	uint32_t _head; /* oldest item, owner pops here (free-running) */
+	uint32_t _tail; /* next free slot, thieves take tail - 1 */
+	int _cpu;       /* pinned CPU, -1 = any */
+} eai_osal_wq_worker_t;
+
+/* Default depth of eai_osal_workqueue_create() and the system queue */
+#define EAI_OSAL_WQ_DEPTH 16
+
+/* One priority lane — a bounded FIFO of work item pointers */
+struct eai_osal_wq_lane {
+	eai_osal_work_t **_slots;
+	uint32_t _head; /* oldest item (free-running) */
+	uint32_t _tail; /* next free slot (free-running) */
+	uint32_t _hwm;  /* most items ever waiting */
+};
+
+/*
+ * Work queue — thread that processes work item pointers from its lanes,
+ * highest lane first, plus a lazily started timer thread that moves
+ * expired delayed work onto them. _lock guards the lanes.
+ * A pool (eai_osal_workqueue_pool_create) replaces the single thread and
+ * lanes with _n_workers workers.
+ */
 typedef struct eai_osal_workqueue {
 	pthread_t _thread;
-	eai_osal_queue_t _queue;
-	uint8_t _buf[16 * (sizeof(eai_osal_work_cb_t) + sizeof(void *))];
+	pthread_mutex_t _lock;
+	pthread_cond_t _cond; /* an item was queued */
+	struct eai_osal_wq_lane _lanes[EAI_OSAL_WQ_MAX_LANES];
+	uint32_t _depth;      /* slots per lane */
+	uint8_t _n_lanes;
+	eai_osal_work_t *_buf[EAI_OSAL_WQ_DEPTH]; /* storage for create() */
+	struct eai_osal_deadline_heap _delayed;
+	pthread_cond_t _delayed_cond;
+	pthread_t _delayed_thread;
+	bool _delayed_started;
+
+	/* Pool mode only — _workers is NULL for a single-thread queue */
+	eai_osal_wq_worker_t *_workers;
+	uint32_t _n_workers;
+	uint32_t _rr;       /* round-robin submit cursor */
+	uint32_t _queued;   /* items across all deques */
+	uint32_t _sleepers; /* workers parked on _pool_cond */
+	bool _pool_stop;    /* workers exit; guarded by _pool_lock */
+	pthread_mutex_t _pool_lock;
+	pthread_cond_t _pool_cond;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
 } eai_osal_workqueue_t;
 
 /*
@@ -0,0 +1,316 @@
+#include "internal.h"
+#include <stdlib.h>
+
+#if EAI_OSAL_POSIX_VTIME
+
+/*
+ * Virtual time (-DEAI_OSAL_POSIX_VTIME=1).
+ *
+ * The monotonic clock is a counter that only moves when every
+ * participating thread is blocked: then it jumps straight to the earliest
+ * pending deadline and wakes whatever expires there. A 60 s scenario made
+ * of sleeps, timeouts, timers and delayed work runs as fast as the CPU
+ * gets through its callbacks, and everything scheduled for different
+ * instants happens in deadline order on every run. Threads woken at the
+ * same instant still run concurrently.
+ *
+ * Participants are the process's main thread plus every thread the
+ * backend starts (OSAL threads, timer service, work queues). Each of
+ * their waits — condvar, mutex, sleep — goes through osal_vt_cond_wait(),
+ * which keeps a waiter record with its cond, mutex and deadline. A
+ * signal marks every record on its cond runnable before the broadcast,
+ * so the blocked count never lags a wakeup. Blocking the clock cannot see
+ * (usleep, raw pthread waits, I/O) just looks like a busy thread: the
+ * clock holds still until it returns. With every participant blocked and
+ * no deadline pending the process is deadlocked, as it would be in real
+ * time.
+ *
+ * Expiries are delivered by a clock thread that holds no other lock: it
+ * takes each expired waiter's mutex in turn to broadcast, so the wakeup
+ * cannot slip in before the waiter sleeps. A record stays pinned until
+ * then; a waiter that wakes early for another reason waits for the pin
+ * with its mutex released. Lock order is object mutex, then vt.lock.
+ *
+ * Time starts at 0. Everything here is serialized by vt.lock, which is
+ * fine for simulation and not meant to be fast.
+ */
+
+struct vt_waiter {
+	struct vt_waiter *next;
+	struct vt_waiter *fire_next; /* clock thread's expiry batch */
+	pthread_cond_t *cond;
+	pthread_mutex_t *lock;
+	uint64_t deadline;           /* UINT64_MAX = none */
+	uint32_t pins;               /* clock thread still needs the record */
+	bool woken;                  /* no longer counted as blocked */
+	bool signaled;
+	bool fired;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t clock_cond; /* blocked count reached threads */
+	pthread_cond_t unpin;
+	pthread_once_t once;
+	uint64_t now;              /* microseconds */
+	uint32_t threads;          /* participants, main thread included */
+	uint32_t blocked;          /* participants parked in a wait */
+	struct vt_waiter *waiters;
+} vt = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.clock_cond = PTHREAD_COND_INITIALIZER,
+	.unpin = PTHREAD_COND_INITIALIZER,
+	.once = PTHREAD_ONCE_INIT,
+	.threads = 1,
+};
+
+/* Gate for eai_osal_mutex_t waiters, see osal_vt_mutex_lock() */
+static pthread_mutex_t mutex_gate = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mutex_released = PTHREAD_COND_INITIALIZER;
+
+/* Earliest deadline among blocked waiters, or UINT64_MAX. Holds vt.lock. */
+static uint64_t earliest(void)
+{
+	uint64_t min = UINT64_MAX;
+
+	for (struct vt_waiter *w = vt.waiters; w != NULL; w = w->next) {
+		if (!w->woken && w->deadline < min) {
+			min = w->deadline;
+		}
+	}
+	return min;
+}
+
+static void *clock_thread(void *arg)
+{
+	(void)arg;
+
+	pthread_mutex_lock(&vt.lock);
+	for (;;) {
+		uint64_t next = earliest();
+
+		if (vt.blocked < vt.threads || next == UINT64_MAX) {
+			pthread_cond_wait(&vt.clock_cond, &vt.lock);
+			continue;
+		}
+
+		if (next > vt.now) {
+			vt.now = next;
+		}
+
+		struct vt_waiter *batch = NULL;
+
+		for (struct vt_waiter *w = vt.waiters; w != NULL; w = w->next) {
+			if (!w->woken && w->deadline <= vt.now) {
+				w->woken = true;
+				w->fired = true;
+				w->pins++;
+				vt.blocked--;
+				w->fire_next = batch;
+				batch = w;
+			}
+		}
+		pthread_mutex_unlock(&vt.lock);
+
+		/* The waiter holds its mutex until it sleeps on the cond */
+		for (struct vt_waiter *w = batch; w != NULL; w = w->fire_next) {
+			pthread_mutex_lock(w->lock);
+			pthread_cond_broadcast(w->cond);
+			pthread_mutex_unlock(w->lock);
+		}
+
+		pthread_mutex_lock(&vt.lock);
+		while (batch != NULL) {
+			struct vt_waiter *w = batch;
+
+			batch = w->fire_next;
+			w->pins--;
+		}
+		pthread_cond_broadcast(&vt.unpin);
+	}
+	return NULL;
+}
+
+static void clock_start(void)
+{
+	pthread_t thread;
+
+	if (pthread_create(&thread, NULL, clock_thread, NULL) != 0) {
+		abort();
+	}
+	pthread_detach(thread);
+}
+
+uint64_t osal_vt_now(void)
+{
+	pthread_mutex_lock(&vt.lock);
+	uint64_t now = vt.now;
+	pthread_mutex_unlock(&vt.lock);
+
+	return now;
+}
+
+int osal_vt_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock,
+		      uint64_t deadline_us)
+{
+	struct vt_waiter w = {
+		.cond = cond,
+		.lock = lock,
+		.deadline = deadline_us,
+	};
+
+	pthread_once(&vt.once, clock_start);
+
+	pthread_mutex_lock(&vt.lock);
+	if (deadline_us <= vt.now) {
+		pthread_mutex_unlock(&vt.lock);
+		return ETIMEDOUT;
+	}
+	w.next = vt.waiters;
+	vt.waiters = &w;
+	if (++vt.blocked >= vt.threads) {
+		pthread_cond_signal(&vt.clock_cond);
+	}
+	pthread_mutex_unlock(&vt.lock);
+
+	for (;;) {
+		pthread_cond_wait(cond, lock);
+		pthread_mutex_lock(&vt.lock);
+		if (w.woken) {
+			break;
+		}
+		/* Another waiter's wakeup, or spurious — still blocked */
+		pthread_mutex_unlock(&vt.lock);
+	}
+
+	struct vt_waiter **pp = &vt.waiters;
+
+	while (*pp != &w) {
+		pp = &(*pp)->next;
+	}
+	*pp = w.next;
+
+	if (w.pins != 0) {
+		/* The clock thread is about to take our mutex */
+		pthread_mutex_unlock(lock);
+		while (w.pins != 0) {
+			pthread_cond_wait(&vt.unpin, &vt.lock);
+		}
+		pthread_mutex_unlock(&vt.lock);
+		pthread_mutex_lock(lock);
+	} else {
+		pthread_mutex_unlock(&vt.lock);
+	}
+
+	return w.fired && !w.signaled ? ETIMEDOUT : 0;
+}
+
+void osal_vt_cond_broadcast(pthread_cond_t *cond)
+{
+	pthread_mutex_lock(&vt.lock);
+	for (struct vt_waiter *w = vt.waiters; w != NULL; w = w->next) {
+		if (w->cond == cond && !w->woken) {
+			w->woken = true;
+			w->signaled = true;
+			vt.blocked--;
+		}
+	}
+	pthread_mutex_unlock(&vt.lock);
+
+	pthread_cond_broadcast(cond);
+}
+
+/*
+ * OSAL mutexes: trylock under the gate, otherwise wait on the gate's cond
+ * for any eai_osal_mutex_unlock(). The unlocker broadcasts under the gate
+ * after releasing, so a release cannot fall between trylock and wait.
+ */
+int osal_vt_mutex_lock(pthread_mutex_t *mutex, uint64_t deadline_us)
+{
+	int rc = 0;
+
+	pthread_mutex_lock(&mutex_gate);
+	while (pthread_mutex_trylock(mutex) != 0) {
+		if (osal_vt_cond_wait(&mutex_released, &mutex_gate,
+				      deadline_us) == ETIMEDOUT) {
+			rc = pthread_mutex_trylock(mutex) == 0 ? 0 : ETIMEDOUT;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&mutex_gate);
+	return rc;
+}
+
+void osal_vt_mutex_unlock(pthread_mutex_t *mutex)
+{
+	(void)mutex;
+
+	pthread_mutex_lock(&mutex_gate);
+	osal_vt_cond_broadcast(&mutex_released);
+	pthread_mutex_unlock(&mutex_gate);
+}
+
+void osal_vt_sleep(uint64_t us)
+{
+	pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+	pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+	uint64_t deadline = osal_vt_now() + us;
+
+	/* Nobody else knows the cond, so only the deadline ends the wait */
+	pthread_mutex_lock(&lock);
+	osal_vt_cond_wait(&cond, &lock, deadline);
+	pthread_mutex_unlock(&lock);
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&lock);
+}
+
+struct vt_start {
+	void *(*entry)(void *);
+	void *arg;
+};
+
+static void *participant(void *arg)
+{
+	struct vt_start start = *(struct vt_start *)arg;
+
+	free(arg);
+	void *ret = start.entry(start.arg);
+
+	pthread_mutex_lock(&vt.lock);
+	if (--vt.threads <= vt.blocked) {
+		pthread_cond_signal(&vt.clock_cond);
+	}
+	pthread_mutex_unlock(&vt.lock);
+	return ret;
+}
+
+/* Counted before it exists, so its creator cannot advance time past it */
+int osal_vt_pthread_create(pthread_t *thread, const pthread_attr_t *attr,
+			   void *(*entry)(void *), void *arg)
+{
+	struct vt_start *start = malloc(sizeof(*start));
+
+	if (start == NULL) {
+		return ENOMEM;
+	}
+	start->entry = entry;
+	start->arg = arg;
+
+	pthread_mutex_lock(&vt.lock);
+	vt.threads++;
+	pthread_mutex_unlock(&vt.lock);
+
+	int rc = pthread_create(thread, attr, participant, start);
+
+	if (rc != 0) {
+		free(start);
+		pthread_mutex_lock(&vt.lock);
+		if (--vt.threads <= vt.blocked) {
+			pthread_cond_signal(&vt.clock_cond);
+		}
+		pthread_mutex_unlock(&vt.lock);
+	}
+	return rc;
+}
+
+#endif /* EAI_OSAL_POSIX_VTIME */
@@ -1,65 +1,241 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_setaffinity_np */
+#endif
+
 #include <eai_osal/workqueue.h>
-#include <eai_osal/queue.h>
+#include <eai_osal/time.h>
 #include "internal.h"
+#include "deadline.h"
 #include <string.h>
 
 /*
  * POSIX work queue implementation.
  *
- * Same pattern as FreeRTOS: a thread blocks on an internal OSAL queue,
- * processing {callback, arg} pairs. System work queue is lazily initialized.
- * Delayed work uses a timer thread that enqueues on expiry.
+ * Same pattern as FreeRTOS: a thread blocks on bounded FIFOs of work item
+ * pointers. System work queue is lazily initialized.
+ *
+ * A queue has one or more priority lanes carved out of one buffer; the
+ * thread always takes the oldest item of the highest non-empty lane, so
+ * urgent items overtake a backlog of slow ones. Each lane records its
+ * high-water mark at submit time, under the same lock.
+ *
+ * Work items follow k_work semantics. _state records whether an item is
+ * queued, running, or still referenced by a queue slot, so submitting an
+ * item that is already queued is a no-op and a queue never holds more
+ * entries than there are distinct items. Cancel only clears QUEUED; the
+ * stale slot is skipped when dequeued (or reused by a resubmit), and
+ * cancel_sync waits for that slot to drain so the item can be freed.
+ *
+ * Delayed work is parked in a per-queue deadline heap. One timer thread per
+ * work queue (started on first delayed submit) sleeps until the earliest
+ * deadline and enqueues expired items, so submit/cancel/reschedule are heap
+ * operations with no thread lifecycle. All heaps share dwork_lock.
+ *
+ * A pool runs N workers, each draining its own bounded deque oldest-first.
+ * Submits from outside the pool are spread round-robin; submits from a
+ * worker go to that worker's own deque. A worker whose deque is empty
+ * steals the newest item from a sibling before going to sleep, so a burst
+ * landing on one worker is picked up by the idle ones.
  */
 
-#define WQ_DEPTH 16
+#define WQ_DELAYED_STACK_SIZE 65536
+#define WQ_POOL_STACK_SIZE 65536
+
+#define DWORK_OF(node) \
+	((eai_osal_dwork_t *)((uint8_t *)(node) - offsetof(eai_osal_dwork_t, _node)))
 
-struct wq_item {
-	eai_osal_work_cb_t cb;
-	void *arg;
-};
+/* Flush/cancel_sync waiters; only touched when WORK_WAITED is set */
+static pthread_mutex_t work_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+
+/* Item whose callback runs on the calling thread, if any */
+static __thread eai_osal_work_t *current_work;
 
 /* ── System work queue (lazy init) ────────────────────────────────────── */
 
 static eai_osal_workqueue_t sys_wq;
 static bool sys_wq_ready;
 
+static void work_wake(uint32_t old_state)
+{
+	if (old_state & WORK_WAITED) {
+		pthread_mutex_lock(&work_lock);
+		osal_cond_broadcast(&work_cond);
+		pthread_mutex_unlock(&work_lock);
+	}
+}
+
+/* Run a dequeued item, or drop it if it was cancelled while queued. */
+static void work_run(eai_osal_workqueue_t *wq, eai_osal_work_t *work)
+{
+	uint32_t old = __atomic_load_n(&work->_state, __ATOMIC_ACQUIRE);
+	uint32_t next;
+
+	do {
+		next = old & ~(WORK_QUEUED | WORK_INQ);
+		next = (old & WORK_QUEUED) ? (next | WORK_RUNNING)
+					   : (next & ~WORK_WAITED);
+	} while (!__atomic_compare_exchange_n(&work->_state, &old, next, false,
+					      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+	if (!(old & WORK_QUEUED)) {
+		work_wake(old);
+		return;
+	}
+
+	current_work = work;
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_START, work, 0);
+#if EAI_OSAL_STATS
+	uint32_t start = osal_stats_cycles();
+#endif
+	work->_cb(work->_cb_arg);
+#if EAI_OSAL_STATS
+	osal_stats_executed(&wq->_stats, osal_stats_cycles() - start);
+#else
+	(void)wq;
+#endif
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_END, work, 0);
+	current_work = NULL;
+
+	work_wake(__atomic_fetch_and(&work->_state, ~(WORK_RUNNING | WORK_WAITED),
+				     __ATOMIC_ACQ_REL));
+}
+
+/* Wait until none of mask is set in work->_state. */
+static void work_wait(eai_osal_work_t *work, uint32_t mask)
+{
+	/* From the item's own callback, RUNNING never clears */
+	if (current_work == work) {
+		mask &= ~WORK_RUNNING;
+	}
+
+	pthread_mutex_lock(&work_lock);
+	while (__atomic_fetch_or(&work->_state, WORK_WAITED,
+				 __ATOMIC_ACQ_REL) & mask) {
+		osal_cond_wait(&work_cond, &work_lock);
+	}
+	pthread_mutex_unlock(&work_lock);
+}
+
+/* Oldest item of the highest non-empty lane. Caller holds wq->_lock. */
+static eai_osal_work_t *lanes_pop(eai_osal_workqueue_t *wq)
+{
+	for (int i = wq->_n_lanes - 1; i >= 0; i--) {
+		struct eai_osal_wq_lane *lane = &wq->_lanes[i];
+
+		if (lane->_head != lane->_tail) {
+			eai_osal_work_t *work = lane->_slots[lane->_head % wq->_depth];
+
+			lane->_head++;
+			return work;
+		}
+	}
+	return NULL;
+}
+
+static eai_osal_status_t lanes_push(eai_osal_workqueue_t *wq,
+				    eai_osal_work_t *work)
+{
+	uint8_t idx = work->_lane < wq->_n_lanes ? work->_lane : wq->_n_lanes - 1;
+	struct eai_osal_wq_lane *lane = &wq->_lanes[idx];
+
+	pthread_mutex_lock(&wq->_lock);
+	uint32_t fill = lane->_tail - lane->_head;
+
+	if (fill == wq->_depth) {
+		pthread_mutex_unlock(&wq->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	lane->_slots[lane->_tail % wq->_depth] = work;
+	lane->_tail++;
+	if (fill + 1 > lane->_hwm) {
+		lane->_hwm = fill + 1;
+	}
+#if EAI_OSAL_STATS
+	uint32_t pending = 0;
+
+	for (uint8_t i = 0; i < wq->_n_lanes; i++) {
+		pending += wq->_lanes[i]._tail - wq->_lanes[i]._head;
+	}
+	osal_stats_depth(&wq->_stats, pending);
+#endif
+	osal_cond_signal(&wq->_cond);
+	pthread_mutex_unlock(&wq->_lock);
+	return EAI_OSAL_OK;
+}
+
 static void *wq_task(void *arg)
 {
 	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)arg;
-	struct wq_item item;
 
 	for (;;) {
-		if (eai_osal_queue_recv(&wq->_queue, &item,
-					EAI_OSAL_WAIT_FOREVER) == EAI_OSAL_OK) {
-			if (item.cb != NULL) {
-				item.cb(item.arg);
-			}
+		eai_osal_work_t *work;
+
+		pthread_mutex_lock(&wq->_lock);
+		while ((work = lanes_pop(wq)) == NULL) {
+			osal_cond_wait(&wq->_cond, &wq->_lock);
 		}
+		pthread_mutex_unlock(&wq->_lock);
+
+		work_run(wq, work);
 	}
 	return NULL;
 }
 
-static eai_osal_workqueue_t *get_sys_wq(void)
+static pthread_mutex_t dwork_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static eai_osal_status_t wq_init_delayed(eai_osal_workqueue_t *wq)
 {
-	if (!sys_wq_ready) {
-		eai_osal_status_t ret = eai_osal_queue_create(
-			&sys_wq._queue, sizeof(struct wq_item),
-			WQ_DEPTH, sys_wq._buf);
-		if (ret != EAI_OSAL_OK) {
-			return NULL;
-		}
+	osal_deadline_heap_init(&wq->_delayed);
+	wq->_delayed_started = false;
+	return osal_cond_init_monotonic(&wq->_delayed_cond) == 0
+		? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
 
-		pthread_attr_t attr;
-		pthread_attr_init(&attr);
-		pthread_attr_setstacksize(&attr, 65536);
+/* Set up lanes and the delayed heap, then start the queue thread. */
+static eai_osal_status_t wq_start(eai_osal_workqueue_t *wq, size_t stack_size,
+				  void *buf, uint32_t depth, uint8_t n_lanes)
+{
+	memset(wq, 0, sizeof(*wq));
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+	wq->_depth = depth;
+	wq->_n_lanes = n_lanes;
+	for (uint8_t i = 0; i < n_lanes; i++) {
+		wq->_lanes[i]._slots = (eai_osal_work_t **)buf + (size_t)i * depth;
+	}
 
-		int rc = pthread_create(&sys_wq._thread, &attr, wq_task, &sys_wq);
-		pthread_attr_destroy(&attr);
+	if (wq_init_delayed(wq) != EAI_OSAL_OK) {
+		return EAI_OSAL_ERROR;
+	}
+	pthread_mutex_init(&wq->_lock, NULL);
+	pthread_cond_init(&wq->_cond, NULL);
 
-		if (rc != 0) {
-			eai_osal_queue_destroy(&sys_wq._queue);
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
+
+	int rc = osal_pthread_create(&wq->_thread, &attr, wq_task, wq);
+	pthread_attr_destroy(&attr);
+
+	if (rc != 0) {
+		pthread_cond_destroy(&wq->_cond);
+		pthread_mutex_destroy(&wq->_lock);
+		pthread_cond_destroy(&wq->_delayed_cond);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+static eai_osal_workqueue_t *get_sys_wq(void)
+{
+	if (!sys_wq_ready) {
+		if (wq_start(&sys_wq, 65536, sys_wq._buf, EAI_OSAL_WQ_DEPTH,
+			     1) != EAI_OSAL_OK) {
 			return NULL;
 		}
+		EAI_OSAL_STATS_REGISTER(&sys_wq, "sysworkq");
 		sys_wq_ready = true;
 	}
 	return &sys_wq;
@@ -76,15 +252,44 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+	work->_state = 0;
+	work->_lane = 0;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_set_lane(eai_osal_work_t *work, uint8_t lane)
+{
+	if (work == NULL || lane >= EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	work->_lane = lane;
 	return EAI_OSAL_OK;
 }
 
-static eai_osal_status_t submit_to_queue(eai_osal_queue_t *q,
-					 eai_osal_work_cb_t cb, void *arg)
+static eai_osal_status_t pool_submit(eai_osal_workqueue_t *wq,
+				     eai_osal_work_t *work);
+
+/* Queue work on wq unless it is already queued (k_work_submit semantics). */
+static eai_osal_status_t submit_to_queue(eai_osal_workqueue_t *wq,
+					 eai_osal_work_t *work)
 {
-	struct wq_item item = { .cb = cb, .arg = arg };
+	uint32_t old = __atomic_fetch_or(&work->_state, WORK_QUEUED | WORK_INQ,
+					 __ATOMIC_ACQ_REL);
 
-	return eai_osal_queue_send(q, &item, EAI_OSAL_NO_WAIT);
+	/* Already queued, or a cancelled slot is still there to reuse */
+	if (old & (WORK_QUEUED | WORK_INQ)) {
+		return EAI_OSAL_OK;
+	}
+
+	eai_osal_status_t ret = wq->_workers != NULL
+		? pool_submit(wq, work)
+		: lanes_push(wq, work);
+
+	if (ret != EAI_OSAL_OK) {
+		__atomic_fetch_and(&work->_state, ~(WORK_QUEUED | WORK_INQ),
+				   __ATOMIC_ACQ_REL);
+	}
+	return ret;
 }
 
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
@@ -97,7 +302,7 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 	if (wq == NULL) {
 		return EAI_OSAL_ERROR;
 	}
-	return submit_to_queue(&wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work);
 }
 
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
@@ -106,39 +311,115 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return submit_to_queue(&wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work);
+}
+
+bool eai_osal_work_is_pending(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return false;
+	}
+	return (__atomic_load_n(&work->_state, __ATOMIC_ACQUIRE) &
+		(WORK_QUEUED | WORK_RUNNING)) != 0;
+}
+
+eai_osal_status_t eai_osal_work_flush(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	work_wait(work, WORK_QUEUED | WORK_RUNNING);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	__atomic_fetch_and(&work->_state, ~WORK_QUEUED, __ATOMIC_ACQ_REL);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel_sync(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	__atomic_fetch_and(&work->_state, ~WORK_QUEUED, __ATOMIC_ACQ_REL);
+	work_wait(work, WORK_RUNNING | WORK_INQ);
+	return EAI_OSAL_OK;
 }
 
 /* ── Delayed work ─────────────────────────────────────────────────────── */
 
 static void *dwork_timer_thread(void *arg)
 {
-	eai_osal_dwork_t *dwork = (eai_osal_dwork_t *)arg;
+	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)arg;
 
-	pthread_mutex_lock(&dwork->_lock);
-	struct timespec ts = osal_timespec(dwork->_delay_ms);
-	pthread_cond_timedwait(&dwork->_cond, &dwork->_lock, &ts);
+	pthread_mutex_lock(&dwork_lock);
 
-	bool cancelled = dwork->_cancel;
-	eai_osal_work_cb_t cb = dwork->_cb;
-	void *cb_arg = dwork->_cb_arg;
-	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)dwork->_target_wq;
-	dwork->_pending = false;
-	dwork->_thread_alive = false;
-	pthread_mutex_unlock(&dwork->_lock);
+	for (;;) {
+		struct eai_osal_deadline *next = osal_deadline_peek(&wq->_delayed);
 
-	if (!cancelled) {
-		if (wq == NULL) {
-			wq = get_sys_wq();
+		if (next == NULL) {
+			osal_cond_wait(&wq->_delayed_cond, &dwork_lock);
+			continue;
 		}
-		if (wq != NULL) {
-			submit_to_queue(&wq->_queue, cb, cb_arg);
+
+		uint64_t now = eai_osal_time_get_ticks();
+
+		if (next->_deadline > now) {
+			osal_cond_wait_until(&wq->_delayed_cond, &dwork_lock,
+					     next->_deadline);
+			continue;
 		}
+
+		/*
+		 * Enqueue under dwork_lock so cancel() never races with an
+		 * expiry. The send is non-blocking, so the hold time is short.
+		 */
+		eai_osal_dwork_t *dwork = DWORK_OF(osal_deadline_pop(&wq->_delayed));
+
+		dwork->_wq = NULL;
+		submit_to_queue(wq, &dwork->_work);
 	}
 
 	return NULL;
 }
 
+/* Caller holds dwork_lock. */
+static eai_osal_status_t dwork_ensure_timer(eai_osal_workqueue_t *wq)
+{
+	if (wq->_delayed_started) {
+		return EAI_OSAL_OK;
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, WQ_DELAYED_STACK_SIZE);
+
+	int rc = osal_pthread_create(&wq->_delayed_thread, &attr,
+				     dwork_timer_thread, wq);
+	pthread_attr_destroy(&attr);
+
+	if (rc != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	pthread_detach(wq->_delayed_thread);
+	wq->_delayed_started = true;
+	return EAI_OSAL_OK;
+}
+
+/* Caller holds dwork_lock. */
+static void dwork_unlink(eai_osal_dwork_t *dwork)
+{
+	if (dwork->_wq != NULL) {
+		osal_deadline_remove(&dwork->_wq->_delayed, &dwork->_node);
+		dwork->_wq = NULL;
+	}
+}
+
 eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 				      eai_osal_work_cb_t callback,
 				      void *arg)
@@ -146,53 +427,42 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || callback == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_cb = callback;
-	dwork->_cb_arg = arg;
-	dwork->_target_wq = NULL;
-	dwork->_pending = false;
-	dwork->_cancel = false;
-	dwork->_thread_alive = false;
-
-	if (pthread_mutex_init(&dwork->_lock, NULL) != 0) {
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&dwork->_cond, NULL) != 0) {
-		pthread_mutex_destroy(&dwork->_lock);
-		return EAI_OSAL_ERROR;
-	}
-	return EAI_OSAL_OK;
+	dwork->_node._linked = false;
+	dwork->_wq = NULL;
+	return eai_osal_work_init(&dwork->_work, callback, arg);
 }
 
-static eai_osal_status_t dwork_start(eai_osal_dwork_t *dwork, uint32_t delay_ms)
+/* Schedule (or reschedule) dwork on wq. A pending submit is replaced. */
+static eai_osal_status_t dwork_start(eai_osal_dwork_t *dwork,
+				     eai_osal_workqueue_t *wq,
+				     uint32_t delay_ms)
 {
-	pthread_mutex_lock(&dwork->_lock);
+	eai_osal_status_t ret;
+
+	pthread_mutex_lock(&dwork_lock);
+	dwork_unlink(dwork);
 
-	/* If a timer thread is still alive from a previous submit, join it */
-	if (dwork->_thread_alive) {
-		pthread_t old = dwork->_timer_thread;
-		dwork->_cancel = true;
-		pthread_cond_signal(&dwork->_cond);
-		pthread_mutex_unlock(&dwork->_lock);
-		pthread_join(old, NULL);
-		pthread_mutex_lock(&dwork->_lock);
+	if (delay_ms == 0) {
+		ret = submit_to_queue(wq, &dwork->_work);
+		pthread_mutex_unlock(&dwork_lock);
+		return ret;
 	}
 
-	dwork->_delay_ms = delay_ms;
-	dwork->_pending = true;
-	dwork->_cancel = false;
+	ret = dwork_ensure_timer(wq);
+	if (ret == EAI_OSAL_OK) {
+		dwork->_wq = wq;
+		osal_deadline_insert(&wq->_delayed, &dwork->_node,
+				     eai_osal_time_get_ticks() +
+				     (uint64_t)delay_ms * 1000);
 
-	pthread_t thread;
-	int ret = pthread_create(&thread, NULL, dwork_timer_thread, dwork);
-	if (ret != 0) {
-		dwork->_pending = false;
-		pthread_mutex_unlock(&dwork->_lock);
-		return EAI_OSAL_ERROR;
+		/* Only wake the timer thread if its next deadline moved */
+		if (osal_deadline_peek(&wq->_delayed) == &dwork->_node) {
+			osal_cond_signal(&wq->_delayed_cond);
+		}
 	}
-	dwork->_timer_thread = thread;
-	dwork->_thread_alive = true;
-	pthread_detach(thread);
-	pthread_mutex_unlock(&dwork->_lock);
-	return EAI_OSAL_OK;
+
+	pthread_mutex_unlock(&dwork_lock);
+	return ret;
 }
 
 eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
@@ -201,8 +471,12 @@ eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_target_wq = NULL;
-	return dwork_start(dwork, delay_ms);
+	eai_osal_workqueue_t *wq = get_sys_wq();
+
+	if (wq == NULL) {
+		return EAI_OSAL_ERROR;
+	}
+	return dwork_start(dwork, wq, delay_ms);
 }
 
 eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
@@ -212,8 +486,7 @@ eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_target_wq = wq;
-	return dwork_start(dwork, delay_ms);
+	return dwork_start(dwork, wq, delay_ms);
 }
 
 eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
@@ -221,11 +494,11 @@ eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	pthread_mutex_lock(&dwork->_lock);
-	dwork->_cancel = true;
-	pthread_cond_signal(&dwork->_cond);
-	pthread_mutex_unlock(&dwork->_lock);
-	return EAI_OSAL_OK;
+	pthread_mutex_lock(&dwork_lock);
+	dwork_unlink(dwork);
+	pthread_mutex_unlock(&dwork_lock);
+	/* Already expired onto the queue but not yet running */
+	return eai_osal_work_cancel(&dwork->_work);
 }
 
 /* ── Custom work queue ────────────────────────────────────────────────── */
@@ -242,24 +515,286 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 	if (wq == NULL || stack == NULL || stack_size == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	return wq_start(wq, stack_size, wq->_buf, EAI_OSAL_WQ_DEPTH, 1);
+}
 
-	eai_osal_status_t ret = eai_osal_queue_create(
-		&wq->_queue, sizeof(struct wq_item), WQ_DEPTH, wq->_buf);
-	if (ret != EAI_OSAL_OK) {
-		return ret;
+eai_osal_status_t eai_osal_workqueue_create_lanes(eai_osal_workqueue_t *wq,
+						  const char *name,
+						  void *stack,
+						  size_t stack_size,
+						  uint8_t priority,
+						  void *buf,
+						  uint32_t depth,
+						  uint8_t n_lanes)
+{
+	(void)name;
+	(void)priority;
+
+	if (wq == NULL || stack == NULL || stack_size == 0 || buf == NULL ||
+	    depth == 0 || n_lanes == 0 || n_lanes > EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
 	}
+	return wq_start(wq, stack_size, buf, depth, n_lanes);
+}
 
-	pthread_attr_t attr;
-	pthread_attr_init(&attr);
-	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
+uint32_t eai_osal_workqueue_high_water(eai_osal_workqueue_t *wq, uint8_t lane)
+{
+	if (wq == NULL) {
+		return 0;
+	}
+	if (wq->_workers != NULL) {
+		return lane == 0 ? __atomic_load_n(&wq->_lanes[0]._hwm,
+						   __ATOMIC_RELAXED) : 0;
+	}
+	if (lane >= wq->_n_lanes) {
+		return 0;
+	}
+	pthread_mutex_lock(&wq->_lock);
+	uint32_t hwm = wq->_lanes[lane]._hwm;
+	pthread_mutex_unlock(&wq->_lock);
+	return hwm;
+}
 
-	int rc = pthread_create(&wq->_thread, &attr, wq_task, wq);
-	pthread_attr_destroy(&attr);
+/* ── Work queue pool ──────────────────────────────────────────────────── */
 
-	if (rc != 0) {
-		eai_osal_queue_destroy(&wq->_queue);
+/* Worker running on the calling thread, NULL outside any pool */
+static __thread eai_osal_wq_worker_t *current_worker;
+
+static bool deque_push(eai_osal_wq_worker_t *w, eai_osal_work_t *work)
+{
+	bool ok = false;
+
+	pthread_mutex_lock(&w->_lock);
+	if (w->_tail - w->_head < EAI_OSAL_WQ_POOL_DEPTH) {
+		w->_items[w->_tail % EAI_OSAL_WQ_POOL_DEPTH] = work;
+		w->_tail++;
+		ok = true;
+	}
+	pthread_mutex_unlock(&w->_lock);
+	return ok;
+}
+
+/* Owner end: oldest first, so one worker still runs its items in order */
+static bool deque_pop(eai_osal_wq_worker_t *w, eai_osal_work_t **work)
+{
+	bool ok = false;
+
+	pthread_mutex_lock(&w->_lock);
+	if (w->_tail != w->_head) {
+		*work = w->_items[w->_head % EAI_OSAL_WQ_POOL_DEPTH];
+		w->_head++;
+		ok = true;
+	}
+	pthread_mutex_unlock(&w->_lock);
+	return ok;
+}
+
+/* Thief end: newest first, away from the owner's end */
+static bool deque_steal(eai_osal_wq_worker_t *w, eai_osal_work_t **work)
+{
+	bool ok = false;
+
+	pthread_mutex_lock(&w->_lock);
+	if (w->_tail != w->_head) {
+		w->_tail--;
+		*work = w->_items[w->_tail % EAI_OSAL_WQ_POOL_DEPTH];
+		ok = true;
+	}
+	pthread_mutex_unlock(&w->_lock);
+	return ok;
+}
+
+static eai_osal_status_t pool_submit(eai_osal_workqueue_t *wq,
+				     eai_osal_work_t *work)
+{
+	uint32_t n = wq->_n_workers;
+	uint32_t start;
+
+	if (current_worker != NULL && current_worker->_wq == wq) {
+		start = (uint32_t)(current_worker - wq->_workers);
+	} else {
+		start = __atomic_fetch_add(&wq->_rr, 1, __ATOMIC_RELAXED) % n;
+	}
+
+	/*
+	 * Count the item before a worker can see it, so the worker's
+	 * decrement never runs first and wraps _queued.
+	 */
+	uint32_t queued = __atomic_add_fetch(&wq->_queued, 1, __ATOMIC_SEQ_CST);
+
+	/* Preferred worker first, then any deque with room */
+	uint32_t k;
+
+	for (k = 0; k < n; k++) {
+		if (deque_push(&wq->_workers[(start + k) % n], work)) {
+			break;
+		}
+	}
+	if (k == n) {
+		__atomic_fetch_sub(&wq->_queued, 1, __ATOMIC_SEQ_CST);
+		return EAI_OSAL_ERROR;
+	}
+
+	/*
+	 * Then check for sleepers. A worker about to sleep bumps _sleepers,
+	 * then re-checks _queued, so one side always sees the other (both
+	 * seq_cst).
+	 */
+	if (__atomic_load_n(&wq->_sleepers, __ATOMIC_SEQ_CST) != 0) {
+		pthread_mutex_lock(&wq->_pool_lock);
+		osal_cond_signal(&wq->_pool_cond);
+		pthread_mutex_unlock(&wq->_pool_lock);
+	}
+
+	/* A pool has no lanes; its high-water mark counts every deque */
+	uint32_t hwm = __atomic_load_n(&wq->_lanes[0]._hwm, __ATOMIC_RELAXED);
+
+	while (queued > hwm &&
+	       !__atomic_compare_exchange_n(&wq->_lanes[0]._hwm, &hwm, queued,
+					    true, __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED)) {
+	}
+#if EAI_OSAL_STATS
+	osal_stats_depth(&wq->_stats, queued);
+#endif
+	return EAI_OSAL_OK;
+}
+
+static bool pool_take(eai_osal_wq_worker_t *self, eai_osal_work_t **work)
+{
+	eai_osal_workqueue_t *wq = self->_wq;
+	uint32_t n = wq->_n_workers;
+	uint32_t me = (uint32_t)(self - wq->_workers);
+
+	if (deque_pop(self, work)) {
+		return true;
+	}
+	for (uint32_t k = 1; k < n; k++) {
+		if (deque_steal(&wq->_workers[(me + k) % n], work)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void *pool_worker(void *arg)
+{
+	eai_osal_wq_worker_t *self = (eai_osal_wq_worker_t *)arg;
+	eai_osal_workqueue_t *wq = self->_wq;
+	eai_osal_work_t *work;
+
+	current_worker = self;
+
+	for (;;) {
+		if (pool_take(self, &work)) {
+			__atomic_fetch_sub(&wq->_queued, 1, __ATOMIC_SEQ_CST);
+			work_run(wq, work);
+			continue;
+		}
+
+		pthread_mutex_lock(&wq->_pool_lock);
+		__atomic_fetch_add(&wq->_sleepers, 1, __ATOMIC_SEQ_CST);
+		while (__atomic_load_n(&wq->_queued, __ATOMIC_SEQ_CST) == 0 &&
+		       !wq->_pool_stop) {
+			osal_cond_wait(&wq->_pool_cond, &wq->_pool_lock);
+		}
+		__atomic_fetch_sub(&wq->_sleepers, 1, __ATOMIC_SEQ_CST);
+		bool stop = wq->_pool_stop;
+		pthread_mutex_unlock(&wq->_pool_lock);
+
+		if (stop) {
+			break;
+		}
+	}
+	return NULL;
+}
+
+/* Undo a failed pool_create(): stop and join the first n_started workers */
+static void pool_abort(eai_osal_workqueue_t *wq, uint32_t n_started)
+{
+	pthread_mutex_lock(&wq->_pool_lock);
+	wq->_pool_stop = true;
+	osal_cond_broadcast(&wq->_pool_cond);
+	pthread_mutex_unlock(&wq->_pool_lock);
+
+	for (uint32_t i = 0; i < n_started; i++) {
+		pthread_join(wq->_workers[i]._thread, NULL);
+	}
+	for (uint32_t i = 0; i < wq->_n_workers; i++) {
+		pthread_mutex_destroy(&wq->_workers[i]._lock);
+	}
+	pthread_cond_destroy(&wq->_pool_cond);
+	pthread_mutex_destroy(&wq->_pool_lock);
+	pthread_cond_destroy(&wq->_delayed_cond);
+}
+
+static void pool_pin(eai_osal_wq_worker_t *w)
+{
+#if defined(__linux__)
+	if (w->_cpu >= 0) {
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		CPU_SET(w->_cpu, &set);
+		pthread_setaffinity_np(w->_thread, sizeof(set), &set);
+	}
+#else
+	/* No portable thread affinity API (e.g. macOS) — workers float */
+	(void)w;
+#endif
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_t *wq,
+						 const char *name,
+						 eai_osal_wq_worker_t *workers,
+						 uint32_t n_workers,
+						 uint8_t priority,
+						 const int *cpus)
+{
+	(void)name;
+	(void)priority;
+
+	if (wq == NULL || workers == NULL || n_workers == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	memset(wq, 0, sizeof(*wq));
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+	wq->_workers = workers;
+	wq->_n_workers = n_workers;
+
+	if (wq_init_delayed(wq) != EAI_OSAL_OK) {
 		return EAI_OSAL_ERROR;
 	}
+	pthread_mutex_init(&wq->_pool_lock, NULL);
+	pthread_cond_init(&wq->_pool_cond, NULL);
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		eai_osal_wq_worker_t *w = &workers[i];
+
+		memset(w, 0, sizeof(*w));
+		w->_wq = wq;
+		w->_cpu = cpus != NULL ? cpus[i] : -1;
+		pthread_mutex_init(&w->_lock, NULL);
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, WQ_POOL_STACK_SIZE);
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		if (osal_pthread_create(&workers[i]._thread, &attr, pool_worker,
+					&workers[i]) != 0) {
+			/* The caller may reuse wq/workers: nothing may outlive this */
+			pthread_attr_destroy(&attr);
+			pool_abort(wq, i);
+			return EAI_OSAL_ERROR;
+		}
+		pool_pin(&workers[i]);
+	}
+	pthread_attr_destroy(&attr);
 
 	return EAI_OSAL_OK;
 }
@@ -0,0 +1,92 @@
+#include <eai_osal/seqlock.h>
+
+/*
+ * Backend-independent seqlock.
+ *
+ * Writer: seq += 1 (odd), release fence, data stores, seq += 1 (release).
+ * Reader: seq load (acquire), data loads, acquire fence, seq reload.
+ * The fences order the relaxed data accesses against the sequence
+ * updates on both sides, which is what makes a matching even sequence
+ * before and after the copy mean "no write overlapped".
+ */
+
+void eai_osal_seqlock_init(eai_osal_seqlock_t *sl)
+{
+	__atomic_store_n(&sl->_seq, 0, __ATOMIC_RELAXED);
+}
+
+void eai_osal_seqlock_write_begin(eai_osal_seqlock_t *sl)
+{
+	uint32_t seq = __atomic_load_n(&sl->_seq, __ATOMIC_RELAXED);
+
+	__atomic_store_n(&sl->_seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void eai_osal_seqlock_write_end(eai_osal_seqlock_t *sl)
+{
+	uint32_t seq = __atomic_load_n(&sl->_seq, __ATOMIC_RELAXED);
+
+	__atomic_store_n(&sl->_seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t eai_osal_seqlock_read_begin(const eai_osal_seqlock_t *sl)
+{
+	uint32_t seq;
+
+	while ((seq = __atomic_load_n(&sl->_seq, __ATOMIC_ACQUIRE)) & 1) {
+	}
+	return seq;
+}
+
+bool eai_osal_seqlock_read_retry(const eai_osal_seqlock_t *sl, uint32_t seq)
+{
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	return __atomic_load_n(&sl->_seq, __ATOMIC_RELAXED) != seq;
+}
+
+/* Word-wise when both sides are 4-byte aligned, else byte-wise */
+static void copy_relaxed(void *dst, const void *src, size_t size)
+{
+	size_t i = 0;
+
+	if (((uintptr_t)dst | (uintptr_t)src) % sizeof(uint32_t) == 0) {
+		uint32_t *d = dst;
+		const uint32_t *s = src;
+
+		for (; i + sizeof(uint32_t) <= size; i += sizeof(uint32_t)) {
+			__atomic_store_n(d++, __atomic_load_n(s++, __ATOMIC_RELAXED),
+					 __ATOMIC_RELAXED);
+		}
+	}
+	for (; i < size; i++) {
+		__atomic_store_n((uint8_t *)dst + i,
+				 __atomic_load_n((const uint8_t *)src + i,
+						 __ATOMIC_RELAXED),
+				 __ATOMIC_RELAXED);
+	}
+}
+
+void eai_osal_seqlock_write(eai_osal_seqlock_t *sl, void *data,
+			    const void *src, size_t size)
+{
+	eai_osal_seqlock_write_begin(sl);
+	copy_relaxed(data, src, size);
+	eai_osal_seqlock_write_end(sl);
+}
+
+uint32_t eai_osal_seqlock_read(const eai_osal_seqlock_t *sl, void *dst,
+			       const void *data, size_t size)
+{
+	uint32_t retries = 0;
+	uint32_t seq;
+
+	for (;;) {
+		seq = eai_osal_seqlock_read_begin(sl);
+		copy_relaxed(dst, data, size);
+		if (!eai_osal_seqlock_read_retry(sl, seq)) {
+			return retries;
+		}
+		retries++;
+	}
+}
@@ -0,0 +1,317 @@
+#include <eai_osal/spsc_ring.h>
+#include <eai_osal/semaphore.h>
+#include <eai_osal/time.h>
+#include <string.h>
+
+/*
+ * Backend-independent SPSC ring.
+ *
+ * head and tail are free-running uint32 counters; the element index is
+ * counter & mask, and head - tail is the fill level even across wrap.
+ * Each side caches the other's last published index so the shared cache
+ * line is only re-read when the cached view says full (or empty).
+ *
+ * Blocking handshake (Dekker style): the waiter publishes its waiting
+ * flag, fences, then re-checks the ring; the other side publishes its
+ * index, fences, then checks the flag. At least one of them sees the
+ * other's store, so a wakeup is never lost.
+ */
+
+#define LOAD_ACQ(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_REL(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define FENCE()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static uint32_t capacity(const eai_osal_spsc_ring_t *ring)
+{
+	return ring->_mask + 1;
+}
+
+static void wake(eai_osal_spsc_ring_t *ring, uint32_t *waiting,
+		 eai_osal_sem_t *sem)
+{
+	if (!ring->_blocking) {
+		return;
+	}
+	FENCE();
+	if (__atomic_load_n(waiting, __ATOMIC_RELAXED) != 0) {
+		eai_osal_sem_give(sem);
+	}
+}
+
+eai_osal_status_t eai_osal_spsc_ring_init(eai_osal_spsc_ring_t *ring,
+					  void *buffer, size_t elem_size,
+					  uint32_t capacity, bool blocking)
+{
+	if (ring == NULL || buffer == NULL || elem_size == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+	    capacity > (1U << 31)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	memset(ring, 0, sizeof(*ring));
+	ring->_buf = (uint8_t *)buffer;
+	ring->_elem_size = elem_size;
+	ring->_mask = capacity - 1;
+	ring->_blocking = blocking;
+
+	if (blocking) {
+		if (eai_osal_sem_create(&ring->_readable, 0, 1) != EAI_OSAL_OK) {
+			return EAI_OSAL_ERROR;
+		}
+		if (eai_osal_sem_create(&ring->_writable, 0, 1) != EAI_OSAL_OK) {
+			eai_osal_sem_destroy(&ring->_readable);
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_spsc_ring_destroy(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (ring->_blocking) {
+		eai_osal_sem_destroy(&ring->_writable);
+		eai_osal_sem_destroy(&ring->_readable);
+		ring->_blocking = false;
+	}
+	return EAI_OSAL_OK;
+}
+
+uint32_t eai_osal_spsc_ring_push_n(eai_osal_spsc_ring_t *ring,
+				   const void *elems, uint32_t n)
+{
+	if (ring == NULL || elems == NULL || n == 0) {
+		return 0;
+	}
+
+	uint32_t head = ring->_prod.head;
+	uint32_t cap = capacity(ring);
+	uint32_t space = cap - (head - ring->_prod.tail_cache);
+
+	if (space < n) {
+		ring->_prod.tail_cache = LOAD_ACQ(&ring->_cons.tail);
+		space = cap - (head - ring->_prod.tail_cache);
+	}
+	if (n > space) {
+		n = space;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	size_t es = ring->_elem_size;
+	uint32_t off = head & ring->_mask;
+	uint32_t first = cap - off;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(ring->_buf + off * es, elems, first * es);
+	if (n > first) {
+		memcpy(ring->_buf, (const uint8_t *)elems + first * es,
+		       (n - first) * es);
+	}
+
+	STORE_REL(&ring->_prod.head, head + n);
+	wake(ring, &ring->_cons.waiting, &ring->_readable);
+	return n;
+}
+
+uint32_t eai_osal_spsc_ring_pop_n(eai_osal_spsc_ring_t *ring,
+				  void *elems, uint32_t n)
+{
+	if (ring == NULL || elems == NULL || n == 0) {
+		return 0;
+	}
+
+	uint32_t tail = ring->_cons.tail;
+	uint32_t avail = ring->_cons.head_cache - tail;
+
+	if (avail < n) {
+		ring->_cons.head_cache = LOAD_ACQ(&ring->_prod.head);
+		avail = ring->_cons.head_cache - tail;
+	}
+	if (n > avail) {
+		n = avail;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	size_t es = ring->_elem_size;
+	uint32_t cap = capacity(ring);
+	uint32_t off = tail & ring->_mask;
+	uint32_t first = cap - off;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(elems, ring->_buf + off * es, first * es);
+	if (n > first) {
+		memcpy((uint8_t *)elems + first * es, ring->_buf,
+		       (n - first) * es);
+	}
+
+	STORE_REL(&ring->_cons.tail, tail + n);
+	wake(ring, &ring->_prod.waiting, &ring->_writable);
+	return n;
+}
+
+uint32_t eai_osal_spsc_ring_peek(eai_osal_spsc_ring_t *ring,
+				 const void **elems, uint32_t max)
+{
+	if (ring == NULL || elems == NULL || max == 0) {
+		return 0;
+	}
+
+	uint32_t tail = ring->_cons.tail;
+	uint32_t avail = ring->_cons.head_cache - tail;
+
+	if (avail < max) {
+		ring->_cons.head_cache = LOAD_ACQ(&ring->_prod.head);
+		avail = ring->_cons.head_cache - tail;
+	}
+
+	uint32_t off = tail & ring->_mask;
+	uint32_t n = capacity(ring) - off;
+
+	if (n > avail) {
+		n = avail;
+	}
+	if (n > max) {
+		n = max;
+	}
+	*elems = ring->_buf + off * ring->_elem_size;
+	return n;
+}
+
+void eai_osal_spsc_ring_release(eai_osal_spsc_ring_t *ring, uint32_t n)
+{
+	if (ring == NULL || n == 0) {
+		return;
+	}
+	STORE_REL(&ring->_cons.tail, ring->_cons.tail + n);
+	wake(ring, &ring->_prod.waiting, &ring->_writable);
+}
+
+eai_osal_status_t eai_osal_spsc_ring_push(eai_osal_spsc_ring_t *ring,
+					  const void *elem)
+{
+	if (ring == NULL || elem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return eai_osal_spsc_ring_push_n(ring, elem, 1) == 1
+		? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_spsc_ring_pop(eai_osal_spsc_ring_t *ring,
+					 void *elem)
+{
+	if (ring == NULL || elem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return eai_osal_spsc_ring_pop_n(ring, elem, 1) == 1
+		? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+uint32_t eai_osal_spsc_ring_count(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return 0;
+	}
+	uint32_t tail = LOAD_ACQ(&ring->_cons.tail);
+
+	return LOAD_ACQ(&ring->_prod.head) - tail;
+}
+
+uint32_t eai_osal_spsc_ring_space(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return 0;
+	}
+	return capacity(ring) - eai_osal_spsc_ring_count(ring);
+}
+
+/*
+ * Park on sem until ready() holds. *waiting is the flag the other side
+ * checks after publishing its index.
+ */
+static eai_osal_status_t wait_until(eai_osal_spsc_ring_t *ring,
+				    bool (*ready)(eai_osal_spsc_ring_t *),
+				    uint32_t *waiting, eai_osal_sem_t *sem,
+				    uint32_t timeout_ms)
+{
+	if (!ring->_blocking) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	for (;;) {
+		if (ready(ring)) {
+			return EAI_OSAL_OK;
+		}
+		if (timeout_ms == EAI_OSAL_NO_WAIT) {
+			return EAI_OSAL_TIMEOUT;
+		}
+
+		uint32_t remaining = EAI_OSAL_WAIT_FOREVER;
+
+		if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+			uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+			if (elapsed >= timeout_ms) {
+				return EAI_OSAL_TIMEOUT;
+			}
+			remaining = timeout_ms - elapsed;
+		}
+
+		__atomic_store_n(waiting, 1, __ATOMIC_RELAXED);
+		FENCE();
+		if (ready(ring)) {
+			__atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+			return EAI_OSAL_OK;
+		}
+
+		eai_osal_status_t rc = eai_osal_sem_take(sem, remaining);
+
+		__atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+		if (rc != EAI_OSAL_OK) {
+			return ready(ring) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+		}
+	}
+}
+
+static bool readable(eai_osal_spsc_ring_t *ring)
+{
+	return LOAD_ACQ(&ring->_prod.head) != ring->_cons.tail;
+}
+
+static bool writable(eai_osal_spsc_ring_t *ring)
+{
+	return ring->_prod.head - LOAD_ACQ(&ring->_cons.tail) < capacity(ring);
+}
+
+eai_osal_status_t eai_osal_spsc_ring_wait_readable(eai_osal_spsc_ring_t *ring,
+						   uint32_t timeout_ms)
+{
+	if (ring == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return wait_until(ring, readable, &ring->_cons.waiting,
+			  &ring->_readable, timeout_ms);
+}
+
+eai_osal_status_t eai_osal_spsc_ring_wait_writable(eai_osal_spsc_ring_t *ring,
+						   uint32_t timeout_ms)
+{
+	if (ring == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return wait_until(ring, writable, &ring->_prod.waiting,
+			  &ring->_writable, timeout_ms);
+}
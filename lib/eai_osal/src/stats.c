@@ -0,0 +1,224 @@
+#include <eai_osal/stats.h>
+#include <eai_osal/spinlock.h>
+#include "stats_internal.h"
+#include <string.h>
+
+#if EAI_OSAL_STATS
+
+/*
+ * Backend-independent part of the statistics layer.
+ *
+ * Counters are updated with relaxed atomics from whatever thread (or ISR)
+ * touches the object; readers take field-by-field snapshots, so a
+ * snapshot may be a few events stale but never holds a torn value.
+ *
+ * The registry is an intrusive list under a spinlock. foreach copies one
+ * entry at a time under the lock and calls back without it, so a callback
+ * may block and objects may be destroyed between calls.
+ */
+
+static eai_osal_spinlock_t registry_lock = EAI_OSAL_SPINLOCK_INITIALIZER;
+static eai_osal_stats_t *registry;
+
+static const uint32_t bucket_limit_us[EAI_OSAL_STATS_HIST_BUCKETS] = {
+	10, 100, 1000, 10000, 100000, UINT32_MAX,
+};
+
+static void max_relaxed(uint32_t *field, uint32_t value)
+{
+	uint32_t cur = __atomic_load_n(field, __ATOMIC_RELAXED);
+
+	while (value > cur &&
+	       !__atomic_compare_exchange_n(field, &cur, value, true,
+					    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+}
+
+static void record_time(eai_osal_stats_t *stats, uint32_t us)
+{
+	uint32_t i = 0;
+
+	while (us >= bucket_limit_us[i]) {
+		i++;
+	}
+	__atomic_fetch_add(&stats->count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&stats->hist[i], 1, __ATOMIC_RELAXED);
+	max_relaxed(&stats->max_us, us);
+}
+
+/* Counters only; name, kind and link are left alone */
+static void clear_counters(eai_osal_stats_t *stats)
+{
+	__atomic_store_n(&stats->count, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats->contended, 0, __ATOMIC_RELAXED);
+	for (int i = 0; i < EAI_OSAL_STATS_HIST_BUCKETS; i++) {
+		__atomic_store_n(&stats->hist[i], 0, __ATOMIC_RELAXED);
+	}
+	__atomic_store_n(&stats->max_us, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&stats->high_water, 0, __ATOMIC_RELAXED);
+}
+
+static void snapshot(eai_osal_stats_t *out, const eai_osal_stats_t *stats)
+{
+	out->name = stats->name;
+	out->kind = stats->kind;
+	out->count = __atomic_load_n(&stats->count, __ATOMIC_RELAXED);
+	out->contended = __atomic_load_n(&stats->contended, __ATOMIC_RELAXED);
+	for (int i = 0; i < EAI_OSAL_STATS_HIST_BUCKETS; i++) {
+		out->hist[i] = __atomic_load_n(&stats->hist[i], __ATOMIC_RELAXED);
+	}
+	out->max_us = __atomic_load_n(&stats->max_us, __ATOMIC_RELAXED);
+	out->high_water = __atomic_load_n(&stats->high_water, __ATOMIC_RELAXED);
+	out->_next = NULL;
+}
+
+/* ── Backend hooks ─────────────────────────────────────────────────────── */
+
+void osal_stats_init(eai_osal_stats_t *stats, eai_osal_stats_kind_t kind)
+{
+	stats->name = NULL;
+	stats->kind = kind;
+	stats->_next = NULL;
+	clear_counters(stats);
+}
+
+void osal_stats_unregister(eai_osal_stats_t *stats)
+{
+	eai_osal_spinlock_key_t key = eai_osal_spin_lock(&registry_lock);
+
+	if (stats->name != NULL) {
+		for (eai_osal_stats_t **p = &registry; *p != NULL; p = &(*p)->_next) {
+			if (*p == stats) {
+				*p = stats->_next;
+				break;
+			}
+		}
+		stats->name = NULL;
+		stats->_next = NULL;
+	}
+	eai_osal_spin_unlock(&registry_lock, key);
+}
+
+void osal_stats_acquired(eai_osal_stats_t *stats, bool contended,
+			 uint32_t wait_cycles)
+{
+	if (contended) {
+		__atomic_fetch_add(&stats->contended, 1, __ATOMIC_RELAXED);
+		record_time(stats, osal_stats_cycles_to_us(wait_cycles));
+	} else {
+		record_time(stats, 0);
+	}
+}
+
+void osal_stats_depth(eai_osal_stats_t *stats, uint32_t depth)
+{
+	max_relaxed(&stats->high_water, depth);
+}
+
+void osal_stats_executed(eai_osal_stats_t *stats, uint32_t exec_cycles)
+{
+	record_time(stats, osal_stats_cycles_to_us(exec_cycles));
+}
+
+/* ── Public API ────────────────────────────────────────────────────────── */
+
+void eai_osal_stats_register(eai_osal_stats_t *stats, const char *name)
+{
+	if (stats == NULL || name == NULL) {
+		return;
+	}
+
+	eai_osal_spinlock_key_t key = eai_osal_spin_lock(&registry_lock);
+
+	if (stats->name == NULL) {
+		stats->_next = registry;
+		registry = stats;
+	}
+	stats->name = name;
+	eai_osal_spin_unlock(&registry_lock, key);
+}
+
+uint32_t eai_osal_stats_foreach(eai_osal_stats_cb_t cb, void *arg)
+{
+	if (cb == NULL) {
+		return 0;
+	}
+
+	uint32_t visited = 0;
+
+	for (;;) {
+		eai_osal_stats_t snap;
+		eai_osal_stats_t *stats;
+		eai_osal_spinlock_key_t key = eai_osal_spin_lock(&registry_lock);
+
+		/* Re-walk from the head: the list may have changed meanwhile */
+		stats = registry;
+		for (uint32_t i = 0; stats != NULL && i < visited; i++) {
+			stats = stats->_next;
+		}
+		if (stats != NULL) {
+			snapshot(&snap, stats);
+		}
+		eai_osal_spin_unlock(&registry_lock, key);
+
+		if (stats == NULL) {
+			return visited;
+		}
+		cb(&snap, arg);
+		visited++;
+	}
+}
+
+eai_osal_status_t eai_osal_stats_get(const char *name, eai_osal_stats_t *out)
+{
+	if (name == NULL || out == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_ERROR;
+	eai_osal_spinlock_key_t key = eai_osal_spin_lock(&registry_lock);
+
+	for (eai_osal_stats_t *stats = registry; stats != NULL;
+	     stats = stats->_next) {
+		if (strcmp(stats->name, name) == 0) {
+			snapshot(out, stats);
+			ret = EAI_OSAL_OK;
+			break;
+		}
+	}
+	eai_osal_spin_unlock(&registry_lock, key);
+	return ret;
+}
+
+void eai_osal_stats_reset(void)
+{
+	eai_osal_spinlock_key_t key = eai_osal_spin_lock(&registry_lock);
+
+	for (eai_osal_stats_t *stats = registry; stats != NULL;
+	     stats = stats->_next) {
+		clear_counters(stats);
+	}
+	eai_osal_spin_unlock(&registry_lock, key);
+}
+
+const char *eai_osal_stats_kind_name(eai_osal_stats_kind_t kind)
+{
+	switch (kind) {
+	case EAI_OSAL_STATS_MUTEX:
+		return "mutex";
+	case EAI_OSAL_STATS_SEM:
+		return "sem";
+	case EAI_OSAL_STATS_QUEUE:
+		return "queue";
+	case EAI_OSAL_STATS_WORKQUEUE:
+		return "workqueue";
+	}
+	return "?";
+}
+
+uint32_t eai_osal_stats_bucket_limit_us(uint32_t i)
+{
+	return i < EAI_OSAL_STATS_HIST_BUCKETS ? bucket_limit_us[i] : UINT32_MAX;
+}
+
+#endif /* EAI_OSAL_STATS */
@@ -0,0 +1,38 @@
+#ifndef EAI_OSAL_STATS_INTERNAL_H
+#define EAI_OSAL_STATS_INTERNAL_H
+
+/*
+ * Backend hooks for eai_osal/stats.h. Only used with EAI_OSAL_STATS.
+ *
+ * Blocking calls are instrumented the same way everywhere: one
+ * EAI_OSAL_NO_WAIT attempt, recorded as uncontended if it succeeds, then
+ * the caller's timeout, timed and recorded as contended.
+ */
+
+#include <eai_osal/stats.h>
+
+#if EAI_OSAL_STATS
+
+/* Free-running backend counter and its conversion, in <backend>/time.c */
+uint32_t osal_stats_cycles(void);
+uint32_t osal_stats_cycles_to_us(uint32_t cycles);
+
+/* Zero the counters and set the kind; called by create */
+void osal_stats_init(eai_osal_stats_t *stats, eai_osal_stats_kind_t kind);
+
+/* Drop from the registry if registered; called by destroy */
+void osal_stats_unregister(eai_osal_stats_t *stats);
+
+/* One successful acquisition; cycles spent waiting if contended */
+void osal_stats_acquired(eai_osal_stats_t *stats, bool contended,
+			 uint32_t wait_cycles);
+
+/* Raise high_water to depth if deeper */
+void osal_stats_depth(eai_osal_stats_t *stats, uint32_t depth);
+
+/* One work item run, taking exec_cycles */
+void osal_stats_executed(eai_osal_stats_t *stats, uint32_t exec_cycles);
+
+#endif /* EAI_OSAL_STATS */
+
+#endif /* EAI_OSAL_STATS_INTERNAL_H */
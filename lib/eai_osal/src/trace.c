@@ -0,0 +1,211 @@
+#include <eai_osal/trace.h>
+#include <eai_osal/time.h>
+#include "trace_internal.h"
+#include <string.h>
+
+#if EAI_OSAL_TRACE
+
+/*
+ * Backend-independent part of the trace layer.
+ *
+ * Each CPU has its own ring so cores never share a cache line on the hot
+ * path; the ring is still multi-producer, since threads and ISRs on one
+ * CPU preempt each other. A writer claims a slot with a fetch_add on the
+ * head, then publishes it seqlock-style through the record's own seq
+ * word: 0 (in progress), release fence, relaxed field stores, then the
+ * slot's position with release. The dumper accepts a slot only if seq
+ * holds the expected position before and after copying it; anything else
+ * was in flight or overwritten and goes out as EAI_OSAL_TRACE_NONE. It
+ * never waits on a writer, so dumping is safe from any priority.
+ *
+ * Two writers only meet on one slot if the ring wraps completely while
+ * the first is preempted mid-record; the later one then wins and the dump
+ * may show one garbled record.
+ */
+
+#ifndef EAI_OSAL_TRACE_RING_SIZE
+#if defined(CONFIG_EAI_OSAL_TRACE_RING_SIZE)
+#define EAI_OSAL_TRACE_RING_SIZE CONFIG_EAI_OSAL_TRACE_RING_SIZE
+#else
+#define EAI_OSAL_TRACE_RING_SIZE 1024
+#endif
+#endif
+
+#ifndef EAI_OSAL_TRACE_CPUS
+#if defined(CONFIG_MP_MAX_NUM_CPUS)
+#define EAI_OSAL_TRACE_CPUS CONFIG_MP_MAX_NUM_CPUS
+#elif defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+#define EAI_OSAL_TRACE_CPUS portNUM_PROCESSORS
+#else
+#define EAI_OSAL_TRACE_CPUS 4 /* host CPUs fold onto these */
+#endif
+#endif
+
+_Static_assert((EAI_OSAL_TRACE_RING_SIZE & (EAI_OSAL_TRACE_RING_SIZE - 1)) == 0,
+	       "EAI_OSAL_TRACE_RING_SIZE must be a power of two");
+_Static_assert(sizeof(eai_osal_trace_rec_t) == 24, "trace record layout");
+
+#define REC_WORDS (sizeof(eai_osal_trace_rec_t) / sizeof(uint32_t))
+#define SEQ_WORD  (offsetof(eai_osal_trace_rec_t, seq) / sizeof(uint32_t))
+#define DUMP_BATCH 8
+
+struct trace_ring {
+	uint32_t head; /* slots claimed so far */
+	bool full;     /* head has passed EAI_OSAL_TRACE_RING_SIZE once */
+	eai_osal_trace_rec_t recs[EAI_OSAL_TRACE_RING_SIZE];
+} __attribute__((aligned(64)));
+
+static struct trace_ring rings[EAI_OSAL_TRACE_CPUS];
+static bool trace_on = true;
+
+void eai_osal_trace_record(uint8_t event, const void *obj, uint16_t arg)
+{
+	if (!__atomic_load_n(&trace_on, __ATOMIC_RELAXED)) {
+		return;
+	}
+
+	uint32_t cpu = osal_trace_cpu() % EAI_OSAL_TRACE_CPUS;
+	struct trace_ring *ring = &rings[cpu];
+	uint32_t pos = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED);
+	uint32_t *slot = (uint32_t *)&ring->recs[pos & (EAI_OSAL_TRACE_RING_SIZE - 1)];
+	eai_osal_trace_rec_t rec = {
+		.ts = eai_osal_time_get_ticks(),
+		.seq = pos + 1,
+		.thread = osal_trace_thread(),
+		.obj = (uint32_t)(uintptr_t)obj,
+		.arg = arg,
+		.event = event,
+		.cpu = (uint8_t)cpu,
+	};
+	uint32_t words[REC_WORDS];
+
+	if (pos + 1 == EAI_OSAL_TRACE_RING_SIZE) {
+		__atomic_store_n(&ring->full, true, __ATOMIC_RELAXED);
+	}
+
+	memcpy(words, &rec, sizeof(words));
+	__atomic_store_n(&slot[SEQ_WORD], 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	for (uint32_t i = 0; i < REC_WORDS; i++) {
+		if (i != SEQ_WORD) {
+			__atomic_store_n(&slot[i], words[i], __ATOMIC_RELAXED);
+		}
+	}
+	__atomic_store_n(&slot[SEQ_WORD], words[SEQ_WORD], __ATOMIC_RELEASE);
+}
+
+void eai_osal_trace_thread_switched_in(void)
+{
+	eai_osal_trace_record(EAI_OSAL_TRACE_THREAD_SWITCH, NULL, 0);
+}
+
+void eai_osal_trace_enable(bool enable)
+{
+	__atomic_store_n(&trace_on, enable, __ATOMIC_RELAXED);
+}
+
+void eai_osal_trace_clear(void)
+{
+	for (uint32_t cpu = 0; cpu < EAI_OSAL_TRACE_CPUS; cpu++) {
+		struct trace_ring *ring = &rings[cpu];
+
+		for (uint32_t i = 0; i < EAI_OSAL_TRACE_RING_SIZE; i++) {
+			__atomic_store_n(&ring->recs[i].seq, 0, __ATOMIC_RELAXED);
+		}
+		__atomic_store_n(&ring->full, false, __ATOMIC_RELAXED);
+		__atomic_store_n(&ring->head, 0, __ATOMIC_RELEASE);
+	}
+}
+
+/* Copy the record at position pos into out; false if it is not there */
+static bool read_slot(struct trace_ring *ring, uint32_t pos,
+		      eai_osal_trace_rec_t *out)
+{
+	const uint32_t *slot =
+		(const uint32_t *)&ring->recs[pos & (EAI_OSAL_TRACE_RING_SIZE - 1)];
+	uint32_t words[REC_WORDS];
+
+	if (__atomic_load_n(&slot[SEQ_WORD], __ATOMIC_ACQUIRE) != pos + 1) {
+		return false;
+	}
+	for (uint32_t i = 0; i < REC_WORDS; i++) {
+		words[i] = __atomic_load_n(&slot[i], __ATOMIC_RELAXED);
+	}
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if (__atomic_load_n(&slot[SEQ_WORD], __ATOMIC_RELAXED) != pos + 1 ||
+	    words[SEQ_WORD] != pos + 1) {
+		return false;
+	}
+	memcpy(out, words, sizeof(*out));
+	return true;
+}
+
+/* Timestamp rate from the backend's tick/ms conversion */
+static uint32_t ticks_hz(void)
+{
+	const uint64_t ticks = 1000000;
+	uint32_t ms = eai_osal_time_ticks_to_ms(ticks);
+
+	return ms == 0 ? 0 : (uint32_t)((ticks * 1000 + ms / 2) / ms);
+}
+
+uint32_t eai_osal_trace_dump(eai_osal_trace_write_t write, void *ctx)
+{
+	if (write == NULL) {
+		return 0;
+	}
+
+	uint32_t start[EAI_OSAL_TRACE_CPUS];
+	uint32_t end[EAI_OSAL_TRACE_CPUS];
+	eai_osal_trace_hdr_t hdr = {
+		.magic = EAI_OSAL_TRACE_MAGIC,
+		.version = EAI_OSAL_TRACE_VERSION,
+		.rec_size = sizeof(eai_osal_trace_rec_t),
+		.ticks_hz = ticks_hz(),
+		.count = 0,
+	};
+
+	/* Fix the range per CPU first so the header count is exact */
+	for (uint32_t cpu = 0; cpu < EAI_OSAL_TRACE_CPUS; cpu++) {
+		uint32_t head = __atomic_load_n(&rings[cpu].head, __ATOMIC_ACQUIRE);
+		bool full = __atomic_load_n(&rings[cpu].full, __ATOMIC_RELAXED);
+		uint32_t n = (full || head >= EAI_OSAL_TRACE_RING_SIZE) ?
+			     EAI_OSAL_TRACE_RING_SIZE : head;
+
+		start[cpu] = head - n;
+		end[cpu] = head;
+		hdr.count += n;
+	}
+	if (write(&hdr, sizeof(hdr), ctx) != 0) {
+		return 0;
+	}
+
+	eai_osal_trace_rec_t batch[DUMP_BATCH];
+	uint32_t fill = 0;
+	uint32_t written = 0;
+
+	for (uint32_t cpu = 0; cpu < EAI_OSAL_TRACE_CPUS; cpu++) {
+		for (uint32_t pos = start[cpu]; pos != end[cpu]; pos++) {
+			eai_osal_trace_rec_t *rec = &batch[fill];
+
+			if (!read_slot(&rings[cpu], pos, rec)) {
+				memset(rec, 0, sizeof(*rec));
+				rec->seq = pos + 1;
+				rec->cpu = (uint8_t)cpu;
+			}
+			if (++fill == DUMP_BATCH) {
+				if (write(batch, sizeof(batch), ctx) != 0) {
+					return written;
+				}
+				written += fill;
+				fill = 0;
+			}
+		}
+	}
+	if (fill > 0 && write(batch, fill * sizeof(batch[0]), ctx) == 0) {
+		written += fill;
+	}
+	return written;
+}
+
+#endif /* EAI_OSAL_TRACE */
@@ -0,0 +1,18 @@
+#ifndef EAI_OSAL_TRACE_INTERNAL_H
+#define EAI_OSAL_TRACE_INTERNAL_H
+
+/*
+ * Backend hooks for eai_osal/trace.h. Only used with EAI_OSAL_TRACE.
+ */
+
+#include <eai_osal/trace.h>
+
+#if EAI_OSAL_TRACE
+
+/* Current CPU index and thread id, in <backend>/thread.c */
+uint32_t osal_trace_cpu(void);
+uint32_t osal_trace_thread(void);
+
+#endif /* EAI_OSAL_TRACE */
+
+#endif /* EAI_OSAL_TRACE_INTERNAL_H */
@@ -7,6 +7,9 @@ eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_event_init(&event->_impl);
+#ifdef CONFIG_EAI_OSAL_POLL
+	k_poll_signal_init(&event->_signal);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -24,6 +27,9 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_event_post(&event->_impl, bits);
+#ifdef CONFIG_EAI_OSAL_POLL
+	k_poll_signal_raise(&event->_signal, 0);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -32,4 +32,7 @@ static inline eai_osal_status_t osal_status(int ret)
 	return EAI_OSAL_ERROR;
 }
 
+#include "../stats_internal.h"
+#include "../trace_internal.h"
+
 #endif /* EAI_OSAL_ZEPHYR_INTERNAL_H */
@@ -0,0 +1,87 @@
+#include <eai_osal/mempool.h>
+#include "internal.h"
+
+/*
+ * Fixed-block pool — a k_mem_slab. The kernel keeps in-use counts; the
+ * peak and failure counters are kept here so they do not depend on
+ * CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION.
+ */
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  void *buffer, size_t block_size,
+					  uint32_t num_blocks)
+{
+	if (pool == NULL || buffer == NULL || num_blocks == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (block_size == 0 || block_size % EAI_OSAL_MEMPOOL_ALIGN != 0 ||
+	    (uintptr_t)buffer % EAI_OSAL_MEMPOOL_ALIGN != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_set(&pool->_peak, 0);
+	atomic_set(&pool->_failed, 0);
+	return osal_status(k_mem_slab_init(&pool->_impl, buffer, block_size,
+					   num_blocks));
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool,
+					 void **block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (k_mem_slab_alloc(&pool->_impl, block, K_NO_WAIT) != 0) {
+		atomic_inc(&pool->_failed);
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	atomic_val_t used = (atomic_val_t)k_mem_slab_num_used_get(&pool->_impl);
+	atomic_val_t peak = atomic_get(&pool->_peak);
+
+	while (used > peak && !atomic_cas(&pool->_peak, peak, used)) {
+		peak = atomic_get(&pool->_peak);
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool,
+					void *block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct k_mem_slab *slab = &pool->_impl;
+	uintptr_t off = (uintptr_t)block - (uintptr_t)slab->buffer;
+
+	if ((uintptr_t)block < (uintptr_t)slab->buffer ||
+	    off >= (uintptr_t)slab->info.block_size * slab->info.num_blocks ||
+	    off % slab->info.block_size != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mem_slab_free(slab, block);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	stats->num_blocks = pool->_impl.info.num_blocks;
+	stats->in_use = k_mem_slab_num_used_get(&pool->_impl);
+	stats->peak = (uint32_t)atomic_get(&pool->_peak);
+	stats->failed = (uint32_t)atomic_get(&pool->_failed);
+	return EAI_OSAL_OK;
+}
@@ -6,6 +6,9 @@ eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_init(&mutex->_stats, EAI_OSAL_STATS_MUTEX);
+#endif
 	return osal_status(k_mutex_init(&mutex->_impl));
 }
 
@@ -14,6 +17,9 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&mutex->_stats);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -22,7 +28,24 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	int ret = k_mutex_lock(&mutex->_impl, K_NO_WAIT);
+
+	if (ret == 0) {
+		osal_stats_acquired(&mutex->_stats, false, 0);
+	} else if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint32_t start = osal_stats_cycles();
+
+		ret = k_mutex_lock(&mutex->_impl, osal_timeout(timeout_ms));
+		if (ret == 0) {
+			osal_stats_acquired(&mutex->_stats, true,
+					    osal_stats_cycles() - start);
+		}
+	}
+	return osal_status(ret);
+#else
 	return osal_status(k_mutex_lock(&mutex->_impl, osal_timeout(timeout_ms)));
+#endif
 }
 
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
@@ -0,0 +1,95 @@
+#include <eai_osal/poll.h>
+#include "internal.h"
+
+/*
+ * Queues and semaphores map straight onto k_poll event types. Events
+ * poll their k_poll_signal, which is raised on every set whatever the
+ * bits, so a signalled event is re-tested against the descriptor mask.
+ * The signal is reset before that test: a set that lands afterwards
+ * raises it again and k_poll returns at once.
+ *
+ * k_poll only says "was ready"; another thread may consume the item
+ * first. Readiness is therefore always re-read before returning.
+ */
+
+static bool scan(eai_osal_poll_event_t *events, uint32_t n)
+{
+	bool any = false;
+
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_poll_event_t *ev = &events[i];
+
+		switch (ev->type) {
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			ev->ready = k_msgq_num_used_get(&ev->obj.queue->_impl) > 0;
+			break;
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			ev->ready = k_sem_count_get(&ev->obj.sem->_impl) > 0;
+			break;
+		default:
+			k_poll_signal_reset(&ev->obj.event->_signal);
+			ev->ready = k_event_wait(&ev->obj.event->_impl, ev->bits,
+						 false, K_NO_WAIT) != 0;
+			break;
+		}
+		any |= ev->ready;
+	}
+	return any;
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, uint32_t n,
+				uint32_t timeout_ms)
+{
+	struct k_poll_event kev[EAI_OSAL_POLL_MAX_EVENTS];
+
+	if (events == NULL || n == 0 || n > EAI_OSAL_POLL_MAX_EVENTS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_poll_event_t *ev = &events[i];
+
+		if (ev->obj.queue == NULL) {
+			return EAI_OSAL_INVALID_PARAM;
+		}
+		switch (ev->type) {
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			k_poll_event_init(&kev[i], K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+					  K_POLL_MODE_NOTIFY_ONLY,
+					  &ev->obj.queue->_impl);
+			break;
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			k_poll_event_init(&kev[i], K_POLL_TYPE_SEM_AVAILABLE,
+					  K_POLL_MODE_NOTIFY_ONLY,
+					  &ev->obj.sem->_impl);
+			break;
+		case EAI_OSAL_POLL_EVENT_BITS:
+			if (ev->bits == 0) {
+				return EAI_OSAL_INVALID_PARAM;
+			}
+			k_poll_event_init(&kev[i], K_POLL_TYPE_SIGNAL,
+					  K_POLL_MODE_NOTIFY_ONLY,
+					  &ev->obj.event->_signal);
+			break;
+		default:
+			return EAI_OSAL_INVALID_PARAM;
+		}
+	}
+
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+
+	for (;;) {
+		if (scan(events, n)) {
+			return EAI_OSAL_OK;
+		}
+
+		int rc = k_poll(kev, n, sys_timepoint_timeout(end));
+
+		if (rc == -EAGAIN) {
+			return scan(events, n) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+		}
+		for (uint32_t i = 0; i < n; i++) {
+			kev[i].state = K_POLL_STATE_NOT_READY;
+		}
+	}
+}
@@ -8,6 +8,12 @@ eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_msgq_init(&queue->_impl, (char *)buffer, msg_size, max_msgs);
+	atomic_ptr_clear(&queue->_stage);
+	queue->_tx_timeout = EAI_OSAL_NO_WAIT;
+	atomic_clear(&queue->_busy);
+#if EAI_OSAL_STATS
+	osal_stats_init(&queue->_stats, EAI_OSAL_STATS_QUEUE);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -16,7 +22,11 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&queue->_stats);
+#endif
 	k_msgq_purge(&queue->_impl);
+	k_free(atomic_ptr_clear(&queue->_stage));
 	return EAI_OSAL_OK;
 }
 
@@ -26,7 +36,34 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_msgq_put(&queue->_impl, msg, osal_timeout(timeout_ms)));
+
+	int ret;
+
+#if EAI_OSAL_STATS
+	ret = k_msgq_put(&queue->_impl, msg, K_NO_WAIT);
+
+	if (ret == 0) {
+		osal_stats_acquired(&queue->_stats, false, 0);
+	} else if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint32_t start = osal_stats_cycles();
+
+		ret = k_msgq_put(&queue->_impl, msg, osal_timeout(timeout_ms));
+		if (ret == 0) {
+			osal_stats_acquired(&queue->_stats, true,
+					    osal_stats_cycles() - start);
+		}
+	}
+	if (ret == 0) {
+		osal_stats_depth(&queue->_stats,
+				 k_msgq_num_used_get(&queue->_impl));
+	}
+#else
+	ret = k_msgq_put(&queue->_impl, msg, osal_timeout(timeout_ms));
+#endif
+	if (ret == 0) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+	}
+	return osal_status(ret);
 }
 
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
@@ -35,5 +72,191 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_msgq_get(&queue->_impl, msg, osal_timeout(timeout_ms)));
+
+	int ret = k_msgq_get(&queue->_impl, msg, osal_timeout(timeout_ms));
+
+	if (ret == 0) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, 1);
+	}
+	return osal_status(ret);
+}
+
+/*
+ * k_msgq has no batch put/get. Wait for the first message only, then move
+ * the rest with K_NO_WAIT under k_sched_lock() so a woken peer runs once
+ * after the whole batch instead of once per message.
+ */
+uint32_t eai_osal_queue_send_many(eai_osal_queue_t *queue, const void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	const uint8_t *src = msgs;
+	size_t msg_size = queue->_impl.msg_size;
+	uint32_t sent = 0;
+
+	k_sched_lock();
+	if (k_msgq_num_free_get(&queue->_impl) == 0) {
+		/* Must be able to block: wait with preemption enabled */
+		k_sched_unlock();
+		if (k_msgq_put(&queue->_impl, src, osal_timeout(timeout_ms)) != 0) {
+			return 0;
+		}
+		sent = 1;
+		k_sched_lock();
+	}
+	while (sent < n &&
+	       k_msgq_put(&queue->_impl, src + sent * msg_size, K_NO_WAIT) == 0) {
+		sent++;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, (uint16_t)sent);
+#if EAI_OSAL_STATS
+	osal_stats_depth(&queue->_stats, k_msgq_num_used_get(&queue->_impl));
+#endif
+	k_sched_unlock();
+	return sent;
+}
+
+uint32_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+				  uint32_t n, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || n == 0) {
+		return 0;
+	}
+
+	uint8_t *dst = msgs;
+	size_t msg_size = queue->_impl.msg_size;
+	uint32_t received = 0;
+
+	k_sched_lock();
+	if (k_msgq_num_used_get(&queue->_impl) == 0) {
+		k_sched_unlock();
+		if (k_msgq_get(&queue->_impl, dst, osal_timeout(timeout_ms)) != 0) {
+			return 0;
+		}
+		received = 1;
+		k_sched_lock();
+	}
+	while (received < n &&
+	       k_msgq_get(&queue->_impl, dst + received * msg_size, K_NO_WAIT) == 0) {
+		received++;
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, (uint16_t)received);
+	k_sched_unlock();
+	return received;
+}
+
+/*
+ * Zero-copy emulation — k_msgq owns its ring, so reserve/peek hand out a
+ * staging message (tx half, rx half) and commit/peek do the one copy.
+ */
+
+#define OSAL_QUEUE_TX BIT(0)
+#define OSAL_QUEUE_RX BIT(1)
+
+static uint8_t *stage(eai_osal_queue_t *queue, atomic_val_t side)
+{
+	uint8_t *buf = atomic_ptr_get(&queue->_stage);
+
+	if (buf == NULL) {
+		buf = k_malloc(2 * queue->_impl.msg_size);
+		if (buf == NULL) {
+			return NULL;
+		}
+		/* Lost a race with the other side — use the winner's buffer */
+		if (!atomic_ptr_cas(&queue->_stage, NULL, buf)) {
+			k_free(buf);
+			buf = atomic_ptr_get(&queue->_stage);
+		}
+	}
+	return side == OSAL_QUEUE_TX ? buf : buf + queue->_impl.msg_size;
+}
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (atomic_or(&queue->_busy, OSAL_QUEUE_TX) & OSAL_QUEUE_TX) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint8_t *buf = stage(queue, OSAL_QUEUE_TX);
+
+	if (buf == NULL) {
+		atomic_and(&queue->_busy, ~OSAL_QUEUE_TX);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT && k_msgq_num_free_get(&queue->_impl) == 0) {
+		atomic_and(&queue->_busy, ~OSAL_QUEUE_TX);
+		return EAI_OSAL_TIMEOUT;
+	}
+	queue->_tx_timeout = timeout_ms;
+	*slot = buf;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!(atomic_get(&queue->_busy) & OSAL_QUEUE_TX)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	int ret = k_msgq_put(&queue->_impl, atomic_ptr_get(&queue->_stage),
+			     osal_timeout(queue->_tx_timeout));
+
+	atomic_and(&queue->_busy, ~OSAL_QUEUE_TX);
+	if (ret == 0) {
+#if EAI_OSAL_STATS
+		osal_stats_depth(&queue->_stats,
+				 k_msgq_num_used_get(&queue->_impl));
+#endif
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_SEND, queue, 1);
+	}
+	return osal_status(ret);
+}
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **msg,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || msg == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (atomic_or(&queue->_busy, OSAL_QUEUE_RX) & OSAL_QUEUE_RX) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint8_t *buf = stage(queue, OSAL_QUEUE_RX);
+
+	if (buf == NULL) {
+		atomic_and(&queue->_busy, ~OSAL_QUEUE_RX);
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	int ret = k_msgq_get(&queue->_impl, buf, osal_timeout(timeout_ms));
+
+	if (ret != 0) {
+		atomic_and(&queue->_busy, ~OSAL_QUEUE_RX);
+		return osal_status(ret);
+	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_QUEUE_RECV, queue, 1);
+	*msg = buf;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue)
+{
+	if (queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!(atomic_and(&queue->_busy, ~OSAL_QUEUE_RX) & OSAL_QUEUE_RX)) {
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
 }
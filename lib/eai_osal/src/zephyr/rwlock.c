@@ -0,0 +1,122 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+
+/* Writer-preferring rwlock on a k_mutex and two k_condvars */
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	lock->_readers = 0;
+	lock->_writers_waiting = 0;
+	lock->_writer = false;
+	k_mutex_init(&lock->_lock);
+	k_condvar_init(&lock->_read_ok);
+	k_condvar_init(&lock->_write_ok);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *lock,
+					    uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+
+	k_mutex_lock(&lock->_lock, K_FOREVER);
+	while (lock->_writer || lock->_writers_waiting > 0) {
+		if (k_condvar_wait(&lock->_read_ok, &lock->_lock,
+				   sys_timepoint_timeout(end)) != 0) {
+			if (!lock->_writer && lock->_writers_waiting == 0) {
+				break; /* freed just as the wait expired */
+			}
+			k_mutex_unlock(&lock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	lock->_readers++;
+	k_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mutex_lock(&lock->_lock, K_FOREVER);
+	if (lock->_readers == 0) {
+		k_mutex_unlock(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (--lock->_readers == 0 && lock->_writers_waiting > 0) {
+		k_condvar_signal(&lock->_write_ok);
+	}
+	k_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *lock,
+					     uint32_t timeout_ms)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+
+	k_mutex_lock(&lock->_lock, K_FOREVER);
+	lock->_writers_waiting++;
+	while (lock->_writer || lock->_readers > 0) {
+		if (k_condvar_wait(&lock->_write_ok, &lock->_lock,
+				   sys_timepoint_timeout(end)) != 0) {
+			if (!lock->_writer && lock->_readers == 0) {
+				break;
+			}
+			/* Readers held back only by this writer may go now */
+			if (--lock->_writers_waiting == 0 && !lock->_writer) {
+				k_condvar_broadcast(&lock->_read_ok);
+			}
+			k_mutex_unlock(&lock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	lock->_writers_waiting--;
+	lock->_writer = true;
+	k_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *lock)
+{
+	if (lock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mutex_lock(&lock->_lock, K_FOREVER);
+	if (!lock->_writer) {
+		k_mutex_unlock(&lock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	lock->_writer = false;
+	if (lock->_writers_waiting > 0) {
+		k_condvar_signal(&lock->_write_ok);
+	} else {
+		k_condvar_broadcast(&lock->_read_ok);
+	}
+	k_mutex_unlock(&lock->_lock);
+	return EAI_OSAL_OK;
+}
@@ -7,6 +7,9 @@ eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 	if (sem == NULL || limit == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_init(&sem->_stats, EAI_OSAL_STATS_SEM);
+#endif
 	return osal_status(k_sem_init(&sem->_impl, initial, limit));
 }
 
@@ -15,6 +18,9 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	osal_stats_unregister(&sem->_stats);
+#endif
 	return EAI_OSAL_OK;
 }
 
@@ -23,6 +29,7 @@ eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_GIVE, sem, 0);
 	k_sem_give(&sem->_impl);
 	return EAI_OSAL_OK;
 }
@@ -32,5 +39,28 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_sem_take(&sem->_impl, osal_timeout(timeout_ms)));
+
+	int ret;
+
+#if EAI_OSAL_STATS
+	ret = k_sem_take(&sem->_impl, K_NO_WAIT);
+
+	if (ret == 0) {
+		osal_stats_acquired(&sem->_stats, false, 0);
+	} else if (timeout_ms != EAI_OSAL_NO_WAIT) {
+		uint32_t start = osal_stats_cycles();
+
+		ret = k_sem_take(&sem->_impl, osal_timeout(timeout_ms));
+		if (ret == 0) {
+			osal_stats_acquired(&sem->_stats, true,
+					    osal_stats_cycles() - start);
+		}
+	}
+#else
+	ret = k_sem_take(&sem->_impl, osal_timeout(timeout_ms));
+#endif
+	if (ret == 0) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_SEM_TAKE, sem, 0);
+	}
+	return osal_status(ret);
 }
@@ -8,7 +8,9 @@ BUILD_ASSERT(CONFIG_NUM_PREEMPT_PRIORITIES >= 32,
 static void thread_trampoline(void *entry, void *arg, void *unused)
 {
 	ARG_UNUSED(unused);
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_START, entry, 0);
 	((eai_osal_thread_entry_t)entry)(arg);
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_THREAD_EXIT, entry, 0);
 }
 
 eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
@@ -59,6 +61,37 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return osal_status(k_thread_join(&thread->_impl, osal_timeout(timeout_ms)));
 }
 
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (cpu_mask == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+#if defined(CONFIG_SCHED_CPU_MASK)
+	k_tid_t tid = thread != NULL ? &thread->_impl : k_current_get();
+
+	/* CPU masks can only change while the thread cannot run */
+	if (tid == k_current_get()) {
+		return EAI_OSAL_ERROR;
+	}
+
+	k_thread_suspend(tid);
+	int ret = k_thread_cpu_mask_clear(tid);
+
+	for (unsigned int cpu = 0; ret == 0 && cpu < arch_num_cpus(); cpu++) {
+		if (cpu_mask & BIT(cpu)) {
+			ret = k_thread_cpu_mask_enable(tid, cpu);
+		}
+	}
+	k_thread_resume(tid);
+	return osal_status(ret);
+#else
+	/* No CPU masks: only CPU 0 is schedulable */
+	ARG_UNUSED(thread);
+	return (cpu_mask & BIT(0)) ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+#endif
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
 	k_msleep(ms);
@@ -68,3 +101,25 @@ void eai_osal_thread_yield(void)
 {
 	k_yield();
 }
+
+#if EAI_OSAL_TRACE
+uint32_t osal_trace_cpu(void)
+{
+	return arch_curr_cpu()->id;
+}
+
+uint32_t osal_trace_thread(void)
+{
+	return (uint32_t)(uintptr_t)k_current_get();
+}
+
+#if defined(CONFIG_EAI_OSAL_TRACE_SWITCH)
+#include <tracing_user.h>
+
+/* CONFIG_TRACING_USER hook, called by the scheduler with IRQs locked */
+void sys_trace_thread_switched_in_user(void)
+{
+	eai_osal_trace_thread_switched_in();
+}
+#endif
+#endif
@@ -1,5 +1,6 @@
 #include <eai_osal/time.h>
 #include <zephyr/kernel.h>
+#include "../stats_internal.h"
 
 uint32_t eai_osal_time_get_ms(void)
 {
@@ -15,3 +16,16 @@ uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)k_ticks_to_ms_floor64(ticks);
 }
+
+#if EAI_OSAL_STATS
+/* Stats clock: the hardware cycle counter, for sub-tick waits */
+uint32_t osal_stats_cycles(void)
+{
+	return k_cycle_get_32();
+}
+
+uint32_t osal_stats_cycles_to_us(uint32_t cycles)
+{
+	return k_cyc_to_us_floor32(cycles);
+}
+#endif
@@ -1,10 +1,32 @@
 #include <eai_osal/timer.h>
 #include "internal.h"
 
+/*
+ * k_timer periodic expiries are computed from the previous deadline, so
+ * they are already drift-free. The only overrun left is a deferred
+ * dispatch whose previous k_work is still queued: k_work merges the two.
+ */
+
+static void timer_work_handler(struct k_work *zwork)
+{
+	eai_osal_timer_t *timer = CONTAINER_OF(zwork, eai_osal_timer_t, _work);
+
+	if (timer->_cb != NULL) {
+		timer->_cb(timer->_cb_arg);
+	}
+}
+
 static void timer_trampoline(struct k_timer *ztimer)
 {
 	eai_osal_timer_t *timer = CONTAINER_OF(ztimer, eai_osal_timer_t, _impl);
 
+	EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_TIMER_FIRE, timer, 0);
+	if (timer->_wq != NULL) {
+		if (k_work_submit_to_queue(timer->_wq, &timer->_work) == 0) {
+			atomic_inc(&timer->_overruns);
+		}
+		return;
+	}
 	if (timer->_cb != NULL) {
 		timer->_cb(timer->_cb_arg);
 	}
@@ -19,6 +41,9 @@ eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 	}
 	timer->_cb = callback;
 	timer->_cb_arg = arg;
+	timer->_wq = NULL;
+	atomic_clear(&timer->_overruns);
+	k_work_init(&timer->_work, timer_work_handler);
 	k_timer_init(&timer->_impl, timer_trampoline, NULL);
 	return EAI_OSAL_OK;
 }
@@ -28,7 +53,11 @@ eai_osal_status_t eai_osal_timer_destroy(eai_osal_timer_t *timer)
 	if (timer == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+
+	struct k_work_sync sync;
+
 	k_timer_stop(&timer->_impl);
+	k_work_cancel_sync(&timer->_work, &sync);
 	return EAI_OSAL_OK;
 }
 
@@ -39,6 +68,7 @@ eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
 	if (timer == NULL || initial_ms == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	atomic_clear(&timer->_overruns);
 	k_timer_start(&timer->_impl, K_MSEC(initial_ms),
 		      period_ms > 0 ? K_MSEC(period_ms) : K_NO_WAIT);
 	return EAI_OSAL_OK;
@@ -60,3 +90,31 @@ bool eai_osal_timer_is_running(eai_osal_timer_t *timer)
 	}
 	return k_timer_remaining_get(&timer->_impl) > 0;
 }
+
+uint32_t eai_osal_timer_get_overruns(eai_osal_timer_t *timer)
+{
+	if (timer == NULL) {
+		return 0;
+	}
+	return (uint32_t)atomic_get(&timer->_overruns);
+}
+
+eai_osal_status_t eai_osal_timer_set_dispatch(eai_osal_timer_t *timer,
+					      eai_osal_timer_dispatch_t mode,
+					      eai_osal_workqueue_t *wq)
+{
+	if (timer == NULL || mode > EAI_OSAL_TIMER_DISPATCH_WORKQUEUE) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (mode == EAI_OSAL_TIMER_DISPATCH_INLINE) {
+		timer->_wq = NULL;
+	} else if (wq == NULL) {
+		timer->_wq = &k_sys_work_q;
+	} else if (wq->_workers != NULL) {
+		/* One k_work can only be queued once; a fixed worker is enough */
+		timer->_wq = &wq->_workers[0]._q;
+	} else {
+		timer->_wq = &wq->_impl;
+	}
+	return EAI_OSAL_OK;
+}
@@ -9,33 +9,97 @@
 
 #include <zephyr/kernel.h>
 
-typedef struct { struct k_mutex _impl; } eai_osal_mutex_t;
-typedef struct { struct k_sem _impl; } eai_osal_sem_t;
+typedef struct {
+	struct k_mutex _impl;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
+} eai_osal_mutex_t;
+
+typedef struct {
+	struct k_sem _impl;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
+} eai_osal_sem_t;
+
 typedef struct { struct k_thread _impl; } eai_osal_thread_t;
-typedef struct { struct k_msgq _impl; } eai_osal_queue_t;
+typedef struct {
+	struct k_msgq _impl;
+	atomic_ptr_t _stage;  /* reserve/peek staging, 2 * msg_size, lazy */
+	uint32_t _tx_timeout; /* timeout passed to reserve, used by commit */
+	atomic_t _busy;       /* OSAL_QUEUE_TX / OSAL_QUEUE_RX outstanding */
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
+} eai_osal_queue_t;
 
 typedef struct {
 	struct k_timer _impl;
+	struct k_work _work;     /* deferred dispatch */
+	struct k_work_q *_wq;    /* NULL = inline (ISR) dispatch */
 	eai_osal_timer_cb_t _cb;
 	void *_cb_arg;
+	atomic_t _overruns;      /* deferred expiries merged since start */
 } eai_osal_timer_t;
 
-typedef struct { struct k_event _impl; } eai_osal_event_t;
+typedef struct {
+	struct k_event _impl;
+#ifdef CONFIG_EAI_OSAL_POLL
+	struct k_poll_signal _signal; /* raised on every set, for k_poll */
+#endif
+} eai_osal_event_t;
 typedef unsigned int eai_osal_critical_key_t;
 
+/* Reader-writer lock — writer-preferring, see src/zephyr/rwlock.c */
+typedef struct {
+	struct k_mutex _lock;
+	struct k_condvar _read_ok;  /* no writer holds or wants the lock */
+	struct k_condvar _write_ok; /* last reader or writer left */
+	uint32_t _readers;
+	uint32_t _writers_waiting;
+	bool _writer;
+} eai_osal_rwlock_t;
+
+typedef struct {
+	struct k_mem_slab _impl;
+	atomic_t _peak;   /* k_mem_slab only tracks this with a Kconfig */
+	atomic_t _failed;
+} eai_osal_mempool_t;
+
 typedef struct {
 	struct k_work _impl;
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t *_wq_stats; /* queue submitted to, charged for _cb */
+#endif
 } eai_osal_work_t;
 
 typedef struct {
 	struct k_work_delayable _impl;
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
+#if EAI_OSAL_STATS
+	eai_osal_stats_t *_wq_stats;
+#endif
 } eai_osal_dwork_t;
 
-typedef struct { struct k_work_q _impl; } eai_osal_workqueue_t;
+/* Pool worker — one k_work_q with an embedded kernel stack */
+typedef struct {
+	struct k_work_q _q;
+	K_KERNEL_STACK_MEMBER(_stack, CONFIG_EAI_OSAL_WQ_POOL_STACK_SIZE);
+} eai_osal_wq_worker_t;
+
+typedef struct {
+	struct k_work_q _impl;
+	eai_osal_wq_worker_t *_workers; /* pool mode, NULL otherwise */
+	uint32_t _n_workers;
+	atomic_t _rr;                   /* round-robin submit cursor */
+#if EAI_OSAL_STATS
+	eai_osal_stats_t _stats;
+#endif
+} eai_osal_workqueue_t;
 
 #define EAI_OSAL_THREAD_STACK_DEFINE(name, size) K_THREAD_STACK_DEFINE(name, size)
 #define EAI_OSAL_THREAD_STACK_SIZEOF(name)       K_THREAD_STACK_SIZEOF(name)
@@ -1,6 +1,50 @@
 #include <eai_osal/workqueue.h>
 #include "internal.h"
 
+#if EAI_OSAL_STATS
+#include <zephyr/init.h>
+
+/*
+ * Items record the queue they were submitted to, and the trampolines
+ * charge their callback time to it. k_sys_work_q is not an
+ * eai_osal_workqueue_t, so its counters live here. k_work_q keeps no
+ * queue depth, so high_water stays 0 on this backend.
+ */
+static eai_osal_stats_t sys_wq_stats;
+
+static int sys_wq_stats_init(void)
+{
+	osal_stats_init(&sys_wq_stats, EAI_OSAL_STATS_WORKQUEUE);
+	eai_osal_stats_register(&sys_wq_stats, "sysworkq");
+	return 0;
+}
+
+SYS_INIT(sys_wq_stats_init, APPLICATION, 0);
+
+static void run_timed(eai_osal_stats_t *stats, eai_osal_work_cb_t cb,
+		      void *arg)
+{
+	uint32_t start = osal_stats_cycles();
+
+	cb(arg);
+	if (stats != NULL) {
+		osal_stats_executed(stats, osal_stats_cycles() - start);
+	}
+}
+#endif
+
+/* Queue a submit lands on: the queue itself, or the next pool worker */
+static struct k_work_q *target_queue(eai_osal_workqueue_t *wq)
+{
+	if (wq->_workers == NULL) {
+		return &wq->_impl;
+	}
+
+	uint32_t i = (uint32_t)atomic_inc(&wq->_rr) % wq->_n_workers;
+
+	return &wq->_workers[i]._q;
+}
+
 /* ── Work item trampoline ──────────────────────────────────────────────── */
 
 static void work_trampoline(struct k_work *zwork)
@@ -8,7 +52,13 @@ static void work_trampoline(struct k_work *zwork)
 	eai_osal_work_t *work = CONTAINER_OF(zwork, eai_osal_work_t, _impl);
 
 	if (work->_cb != NULL) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_START, work, 0);
+#if EAI_OSAL_STATS
+		run_timed(work->_wq_stats, work->_cb, work->_cb_arg);
+#else
 		work->_cb(work->_cb_arg);
+#endif
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_END, work, 0);
 	}
 }
 
@@ -21,15 +71,30 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+#if EAI_OSAL_STATS
+	work->_wq_stats = NULL;
+#endif
 	k_work_init(&work->_impl, work_trampoline);
 	return EAI_OSAL_OK;
 }
 
+eai_osal_status_t eai_osal_work_set_lane(eai_osal_work_t *work, uint8_t lane)
+{
+	if (work == NULL || lane >= EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* k_work_q is a single FIFO — lanes are accepted and ignored */
+	return EAI_OSAL_OK;
+}
+
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 {
 	if (work == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	work->_wq_stats = &sys_wq_stats;
+#endif
 	int ret = k_work_submit(&work->_impl);
 
 	/* k_work_submit returns: 1 = queued, 2 = running/queued, 0 = already queued */
@@ -42,11 +107,60 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	int ret = k_work_submit_to_queue(&wq->_impl, &work->_impl);
+#if EAI_OSAL_STATS
+	work->_wq_stats = &wq->_stats;
+#endif
+	int ret = k_work_submit_to_queue(target_queue(wq), &work->_impl);
 
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
 }
 
+bool eai_osal_work_is_pending(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return false;
+	}
+	return k_work_is_pending(&work->_impl);
+}
+
+eai_osal_status_t eai_osal_work_flush(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	struct k_work_sync sync;
+
+	k_work_flush(&work->_impl, &sync);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	k_work_cancel(&work->_impl);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_cancel_sync(eai_osal_work_t *work)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* k_work_cancel_sync would wait forever on its own running handler */
+	if ((k_work_busy_get(&work->_impl) & K_WORK_RUNNING) &&
+	    k_current_get() == k_work_queue_thread_get(work->_impl.queue)) {
+		k_work_cancel(&work->_impl);
+		return EAI_OSAL_OK;
+	}
+
+	struct k_work_sync sync;
+
+	k_work_cancel_sync(&work->_impl, &sync);
+	return EAI_OSAL_OK;
+}
+
 /* ── Delayed work trampoline ───────────────────────────────────────────── */
 
 static void dwork_trampoline(struct k_work *zwork)
@@ -57,7 +171,13 @@ static void dwork_trampoline(struct k_work *zwork)
 	eai_osal_dwork_t *dwork = CONTAINER_OF(zdwork, eai_osal_dwork_t, _impl);
 
 	if (dwork->_cb != NULL) {
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_START, dwork, 0);
+#if EAI_OSAL_STATS
+		run_timed(dwork->_wq_stats, dwork->_cb, dwork->_cb_arg);
+#else
 		dwork->_cb(dwork->_cb_arg);
+#endif
+		EAI_OSAL_TRACE_EVENT(EAI_OSAL_TRACE_WORK_END, dwork, 0);
 	}
 }
 
@@ -70,6 +190,9 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 	}
 	dwork->_cb = callback;
 	dwork->_cb_arg = arg;
+#if EAI_OSAL_STATS
+	dwork->_wq_stats = NULL;
+#endif
 	k_work_init_delayable(&dwork->_impl, dwork_trampoline);
 	return EAI_OSAL_OK;
 }
@@ -80,6 +203,9 @@ eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+#if EAI_OSAL_STATS
+	dwork->_wq_stats = &sys_wq_stats;
+#endif
 	int ret = k_work_schedule(&dwork->_impl, K_MSEC(delay_ms));
 
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
@@ -92,7 +218,10 @@ eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	int ret = k_work_schedule_for_queue(&wq->_impl, &dwork->_impl,
+#if EAI_OSAL_STATS
+	dwork->_wq_stats = &wq->_stats;
+#endif
+	int ret = k_work_schedule_for_queue(target_queue(wq), &dwork->_impl,
 					    K_MSEC(delay_ms));
 
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
@@ -127,8 +256,91 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 		.name = name,
 	};
 
+	wq->_workers = NULL;
+	wq->_n_workers = 0;
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
 	k_work_queue_start(&wq->_impl, (k_thread_stack_t *)stack, stack_size,
 			   zephyr_prio, &cfg);
 
 	return EAI_OSAL_OK;
 }
+
+eai_osal_status_t eai_osal_workqueue_create_lanes(eai_osal_workqueue_t *wq,
+						  const char *name,
+						  void *stack,
+						  size_t stack_size,
+						  uint8_t priority,
+						  void *buf,
+						  uint32_t depth,
+						  uint8_t n_lanes)
+{
+	if (buf == NULL || depth == 0 || n_lanes == 0 ||
+	    n_lanes > EAI_OSAL_WQ_MAX_LANES) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* Intrusive, unbounded k_work_q: buf and depth are not needed */
+	return eai_osal_workqueue_create(wq, name, stack, stack_size, priority);
+}
+
+uint32_t eai_osal_workqueue_high_water(eai_osal_workqueue_t *wq, uint8_t lane)
+{
+	(void)wq;
+	(void)lane;
+	return 0;
+}
+
+/* ── Work queue pool ───────────────────────────────────────────────────── */
+
+/*
+ * One k_work_q per worker, submits spread round-robin. A k_work item is
+ * owned by the queue it was submitted to, so there is no stealing here.
+ */
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_t *wq,
+						 const char *name,
+						 eai_osal_wq_worker_t *workers,
+						 uint32_t n_workers,
+						 uint8_t priority,
+						 const int *cpus)
+{
+	if (wq == NULL || workers == NULL || n_workers == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	int zephyr_prio = 31 - (priority > 31 ? 31 : priority);
+
+	struct k_work_queue_config cfg = {
+		.name = name,
+	};
+
+	wq->_workers = workers;
+	wq->_n_workers = n_workers;
+	atomic_clear(&wq->_rr);
+#if EAI_OSAL_STATS
+	osal_stats_init(&wq->_stats, EAI_OSAL_STATS_WORKQUEUE);
+#endif
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		eai_osal_wq_worker_t *w = &workers[i];
+
+		k_work_queue_start(&w->_q, w->_stack,
+				   K_KERNEL_STACK_SIZEOF(w->_stack),
+				   zephyr_prio, &cfg);
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		if (cpus != NULL && cpus[i] >= 0) {
+			/* CPU masks can only change while the thread is not runnable */
+			k_tid_t tid = k_work_queue_thread_get(&w->_q);
+
+			k_thread_suspend(tid);
+			k_thread_cpu_pin(tid, cpus[i]);
+			k_thread_resume(tid);
+		}
+#else
+		ARG_UNUSED(cpus);
+#endif
+	}
+
+	return EAI_OSAL_OK;
+}
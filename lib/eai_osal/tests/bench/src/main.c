@@ -0,0 +1,437 @@
+/*
+ * OSAL microbenchmarks — one source for every backend.
+ *
+ * Measures queue ping-pong latency and throughput across message sizes,
+ * semaphore handoff, mutex cost with and without contention, periodic
+ * timer jitter and work submit-to-execute latency, then prints a single
+ * JSON document so per-backend results can be diffed between runs:
+ *
+ *   {"backend": "posix", "results": [
+ *     {"name": "queue_pingpong", "msg_size": 4, "iters": 1000,
+ *      "ns_per_op": 5120, "p50_ns": 4980, "p99_ns": 9100, "max_ns": 31000},
+ *     ...]}
+ *
+ * ns_per_op is the mean cost of one operation (one-way trip for the
+ * ping-pong tests, one period for the timer). p50/p99/max are per-sample
+ * latencies (timer: deviation from the nominal period). msgs_per_s is
+ * reported by the throughput test only.
+ *
+ * Builds as:
+ *   native   osal_bench (tests/native/CMakeLists.txt)
+ *   Zephyr   this directory, e.g. west build -b qemu_cortex_m3 .
+ *   ESP-IDF  esp-idf/osal_bench
+ *
+ * Times come from CLOCK_MONOTONIC on POSIX, the cycle counter on Zephyr
+ * and esp_timer on ESP-IDF (microsecond resolution, but the same clock on
+ * both cores).
+ */
+
+#include <eai_osal/eai_osal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
+#include <zephyr/kernel.h>
+#define BACKEND "zephyr"
+#elif defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+#include "esp_timer.h"
+#define BACKEND "freertos"
+#else
+#include <time.h>
+#define BACKEND "posix"
+#endif
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_POSIX)
+#define ITERS 100000u /* throughput and cost loops */
+#else
+#define ITERS 10000u
+#endif
+#define SAMPLES      1000u /* latency tests: one sample per round */
+#define TIMER_PERIOD 1u    /* ms */
+#define BENCH_PRIO   10
+#define QUEUE_DEPTH  16
+#define MAX_MSG      256
+
+static const uint32_t msg_sizes[] = { 4, 32, 128, MAX_MSG };
+
+/* ── Clock ──────────────────────────────────────────────────────────────── */
+
+/* Free-running 32-bit timestamp; only differences are meaningful */
+static uint32_t now(void)
+{
+#if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
+	return k_cycle_get_32();
+#elif defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+	return (uint32_t)esp_timer_get_time();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+static uint64_t to_ns(uint32_t delta)
+{
+#if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
+	return k_cyc_to_ns_floor64(delta);
+#elif defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+	return (uint64_t)delta * 1000u;
+#else
+	return delta;
+#endif
+}
+
+/* Longer loops are timed in milliseconds so the 32-bit clock can't wrap */
+static uint64_t elapsed_ns(uint32_t start, uint64_t start_ms)
+{
+	uint64_t ms = eai_osal_time_get_ms() - start_ms;
+
+	return ms >= 1000 ? ms * 1000000u : to_ns(now() - start);
+}
+
+/* ── Reporting ──────────────────────────────────────────────────────────── */
+
+struct result {
+	const char *name;
+	uint32_t msg_size;   /* 0: not applicable */
+	uint32_t iters;
+	uint32_t ns_per_op;
+	uint32_t msgs_per_s; /* 0: not applicable */
+	bool lat;            /* p50/p99/max below are valid */
+	uint32_t p50_ns;
+	uint32_t p99_ns;
+	uint32_t max_ns;
+};
+
+static uint32_t samples[SAMPLES];
+static bool first_result = true;
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return x < y ? -1 : (x > y);
+}
+
+/* Fill r's percentiles from the first n entries of samples (sorts them) */
+static void percentiles(struct result *r, uint32_t n)
+{
+	qsort(samples, n, sizeof(samples[0]), cmp_u32);
+	r->lat = true;
+	r->p50_ns = samples[n / 2];
+	r->p99_ns = samples[(n * 99) / 100];
+	r->max_ns = samples[n - 1];
+}
+
+static void emit(const struct result *r)
+{
+	printf("%s    {\"name\": \"%s\"", first_result ? "" : ",\n", r->name);
+	first_result = false;
+	if (r->msg_size != 0) {
+		printf(", \"msg_size\": %u", (unsigned)r->msg_size);
+	}
+	printf(", \"iters\": %u, \"ns_per_op\": %u", (unsigned)r->iters,
+	       (unsigned)r->ns_per_op);
+	if (r->msgs_per_s != 0) {
+		printf(", \"msgs_per_s\": %u", (unsigned)r->msgs_per_s);
+	}
+	if (r->lat) {
+		printf(", \"p50_ns\": %u, \"p99_ns\": %u, \"max_ns\": %u",
+		       (unsigned)r->p50_ns, (unsigned)r->p99_ns,
+		       (unsigned)r->max_ns);
+	}
+	printf("}");
+}
+
+/* ── Peer thread ────────────────────────────────────────────────────────── */
+
+static eai_osal_thread_t peer;
+EAI_OSAL_THREAD_STACK_DEFINE(peer_stack, 4096);
+static eai_osal_thread_t peer2;
+EAI_OSAL_THREAD_STACK_DEFINE(peer2_stack, 4096);
+
+static void start_peer(eai_osal_thread_t *thread, void *stack, size_t size,
+		       eai_osal_thread_entry_t entry, void *arg)
+{
+	eai_osal_thread_create(thread, "bench_peer", entry, arg, stack, size,
+			       BENCH_PRIO);
+}
+
+#define START_PEER(entry, arg) \
+	start_peer(&peer, peer_stack, EAI_OSAL_THREAD_STACK_SIZEOF(peer_stack), \
+		   (entry), (arg))
+
+/* ── Mutex ──────────────────────────────────────────────────────────────── */
+
+static eai_osal_mutex_t mtx;
+static uint32_t mtx_counter;
+
+static void bench_mutex_uncontended(void)
+{
+	struct result r = { .name = "mutex_uncontended", .iters = ITERS };
+
+	eai_osal_mutex_create(&mtx);
+	uint64_t start_ms = eai_osal_time_get_ms();
+	uint32_t start = now();
+
+	for (uint32_t i = 0; i < ITERS; i++) {
+		eai_osal_mutex_lock(&mtx, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_mutex_unlock(&mtx);
+	}
+	r.ns_per_op = (uint32_t)(elapsed_ns(start, start_ms) / ITERS);
+	eai_osal_mutex_destroy(&mtx);
+	emit(&r);
+}
+
+static void mutex_hammer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < ITERS / 2; i++) {
+		eai_osal_mutex_lock(&mtx, EAI_OSAL_WAIT_FOREVER);
+		mtx_counter++;
+		eai_osal_mutex_unlock(&mtx);
+	}
+}
+
+/* Two threads at equal priority; on one core they contend by preemption */
+static void bench_mutex_contended(void)
+{
+	struct result r = { .name = "mutex_contended", .iters = ITERS };
+
+	eai_osal_mutex_create(&mtx);
+	uint64_t start_ms = eai_osal_time_get_ms();
+	uint32_t start = now();
+
+	START_PEER(mutex_hammer, NULL);
+	start_peer(&peer2, peer2_stack, EAI_OSAL_THREAD_STACK_SIZEOF(peer2_stack),
+		   mutex_hammer, NULL);
+	eai_osal_thread_join(&peer, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_join(&peer2, EAI_OSAL_WAIT_FOREVER);
+	r.ns_per_op = (uint32_t)(elapsed_ns(start, start_ms) / ITERS);
+	eai_osal_mutex_destroy(&mtx);
+	emit(&r);
+}
+
+/* ── Semaphore handoff ─────────────────────────────────────────────────── */
+
+static eai_osal_sem_t ping, pong;
+
+static void sem_peer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		eai_osal_sem_take(&ping, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_sem_give(&pong);
+	}
+}
+
+static void bench_sem_handoff(void)
+{
+	struct result r = { .name = "sem_handoff", .iters = SAMPLES };
+	uint64_t total = 0;
+
+	eai_osal_sem_create(&ping, 0, 1);
+	eai_osal_sem_create(&pong, 0, 1);
+	START_PEER(sem_peer, NULL);
+
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		uint32_t start = now();
+
+		eai_osal_sem_give(&ping);
+		eai_osal_sem_take(&pong, EAI_OSAL_WAIT_FOREVER);
+		samples[i] = (uint32_t)(to_ns(now() - start) / 2);
+		total += samples[i];
+	}
+	eai_osal_thread_join(&peer, EAI_OSAL_WAIT_FOREVER);
+	r.ns_per_op = (uint32_t)(total / SAMPLES);
+	percentiles(&r, SAMPLES);
+	eai_osal_sem_destroy(&ping);
+	eai_osal_sem_destroy(&pong);
+	emit(&r);
+}
+
+/* ── Queues ─────────────────────────────────────────────────────────────── */
+
+static eai_osal_queue_t q_ping, q_pong;
+static uint8_t q_ping_buf[QUEUE_DEPTH * MAX_MSG] __attribute__((aligned(8)));
+static uint8_t q_pong_buf[QUEUE_DEPTH * MAX_MSG] __attribute__((aligned(8)));
+static uint8_t peer_msg[MAX_MSG] __attribute__((aligned(8)));
+static uint8_t main_msg[MAX_MSG] __attribute__((aligned(8)));
+
+static void queue_echo(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		eai_osal_queue_recv(&q_ping, peer_msg, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_queue_send(&q_pong, peer_msg, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void bench_queue_pingpong(uint32_t size)
+{
+	struct result r = { .name = "queue_pingpong", .msg_size = size,
+			    .iters = SAMPLES };
+	uint64_t total = 0;
+
+	eai_osal_queue_create(&q_ping, size, 1, q_ping_buf);
+	eai_osal_queue_create(&q_pong, size, 1, q_pong_buf);
+	START_PEER(queue_echo, NULL);
+
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		uint32_t start = now();
+
+		eai_osal_queue_send(&q_ping, main_msg, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_queue_recv(&q_pong, main_msg, EAI_OSAL_WAIT_FOREVER);
+		samples[i] = (uint32_t)(to_ns(now() - start) / 2);
+		total += samples[i];
+	}
+	eai_osal_thread_join(&peer, EAI_OSAL_WAIT_FOREVER);
+	r.ns_per_op = (uint32_t)(total / SAMPLES);
+	percentiles(&r, SAMPLES);
+	eai_osal_queue_destroy(&q_ping);
+	eai_osal_queue_destroy(&q_pong);
+	emit(&r);
+}
+
+static void queue_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < ITERS; i++) {
+		eai_osal_queue_send(&q_ping, peer_msg, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void bench_queue_throughput(uint32_t size)
+{
+	struct result r = { .name = "queue_throughput", .msg_size = size,
+			    .iters = ITERS };
+
+	eai_osal_queue_create(&q_ping, size, QUEUE_DEPTH, q_ping_buf);
+	uint64_t start_ms = eai_osal_time_get_ms();
+	uint32_t start = now();
+
+	START_PEER(queue_producer, NULL);
+	for (uint32_t i = 0; i < ITERS; i++) {
+		eai_osal_queue_recv(&q_ping, main_msg, EAI_OSAL_WAIT_FOREVER);
+	}
+
+	uint64_t ns = elapsed_ns(start, start_ms);
+
+	eai_osal_thread_join(&peer, EAI_OSAL_WAIT_FOREVER);
+	r.ns_per_op = (uint32_t)(ns / ITERS);
+	r.msgs_per_s = ns ? (uint32_t)((uint64_t)ITERS * 1000000000u / ns) : 0;
+	eai_osal_queue_destroy(&q_ping);
+	emit(&r);
+}
+
+/* ── Timer jitter ───────────────────────────────────────────────────────── */
+
+static uint32_t fire_at[SAMPLES + 1];
+static volatile uint32_t fires;
+static eai_osal_sem_t timer_done;
+
+static void jitter_cb(void *arg)
+{
+	(void)arg;
+	if (fires <= SAMPLES) {
+		fire_at[fires] = now();
+		if (++fires == SAMPLES + 1) {
+			eai_osal_sem_give(&timer_done);
+		}
+	}
+}
+
+static void bench_timer_jitter(void)
+{
+	struct result r = { .name = "timer_jitter", .iters = SAMPLES };
+	eai_osal_timer_t timer;
+	uint64_t total = 0;
+	const uint32_t period_ns = TIMER_PERIOD * 1000000u;
+
+	fires = 0;
+	eai_osal_sem_create(&timer_done, 0, 1);
+	eai_osal_timer_create(&timer, jitter_cb, NULL);
+	eai_osal_timer_start(&timer, TIMER_PERIOD, TIMER_PERIOD);
+	eai_osal_sem_take(&timer_done, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_timer_stop(&timer);
+
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		uint32_t interval = (uint32_t)to_ns(fire_at[i + 1] - fire_at[i]);
+
+		total += interval;
+		samples[i] = interval > period_ns ? interval - period_ns
+						  : period_ns - interval;
+	}
+	r.ns_per_op = (uint32_t)(total / SAMPLES);
+	percentiles(&r, SAMPLES);
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&timer_done);
+	emit(&r);
+}
+
+/* ── Work submit-to-execute ─────────────────────────────────────────────── */
+
+static uint32_t submitted_at;
+static uint32_t work_lat;
+
+static void latency_work(void *arg)
+{
+	(void)arg;
+	work_lat = now() - submitted_at;
+}
+
+static void bench_work_latency(void)
+{
+	struct result r = { .name = "work_latency", .iters = SAMPLES };
+	eai_osal_work_t work;
+	uint64_t total = 0;
+
+	eai_osal_work_init(&work, latency_work, NULL);
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		submitted_at = now();
+		eai_osal_work_submit(&work);
+		eai_osal_work_flush(&work);
+		samples[i] = (uint32_t)to_ns(work_lat);
+		total += samples[i];
+	}
+	r.ns_per_op = (uint32_t)(total / SAMPLES);
+	percentiles(&r, SAMPLES);
+	emit(&r);
+}
+
+/* ── Runner ─────────────────────────────────────────────────────────────── */
+
+static void bench_run(void)
+{
+	printf("{\"backend\": \"%s\", \"results\": [\n", BACKEND);
+
+	bench_mutex_uncontended();
+	bench_mutex_contended();
+	bench_sem_handoff();
+	for (size_t i = 0; i < sizeof(msg_sizes) / sizeof(msg_sizes[0]); i++) {
+		bench_queue_pingpong(msg_sizes[i]);
+	}
+	for (size_t i = 0; i < sizeof(msg_sizes) / sizeof(msg_sizes[0]); i++) {
+		bench_queue_throughput(msg_sizes[i]);
+	}
+	bench_timer_jitter();
+	bench_work_latency();
+
+	printf("\n]}\n");
+}
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_FREERTOS)
+void app_main(void)
+{
+	bench_run();
+}
+#else
+int main(void)
+{
+	bench_run();
+	return 0;
+}
+#endif
@@ -0,0 +1,173 @@
+/*
+ * SPSC ring vs eai_osal_queue_t — producer/consumer contention benchmark.
+ *
+ * One producer thread streams ITEMS sequence numbers to the main thread
+ * through each transport; the consumer verifies ordering. Reports
+ * throughput and ns/item.
+ *
+ * Usage: osal_bench_spsc [items]
+ */
+
+#include <eai_osal/eai_osal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_ITEMS 2000000u
+#define DEPTH         256u
+#define BATCH         32u
+
+static uint32_t items = DEFAULT_ITEMS;
+
+static uint32_t queue_buf[DEPTH];
+static uint32_t ring_buf[DEPTH];
+static eai_osal_queue_t queue;
+static eai_osal_spsc_ring_t ring;
+
+EAI_OSAL_THREAD_STACK_DEFINE(producer_stack, 16384);
+
+/* ── Producers ──────────────────────────────────────────────────────────── */
+
+static void queue_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < items; i++) {
+		eai_osal_queue_send(&queue, &i, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void ring_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < items; i++) {
+		while (eai_osal_spsc_ring_push(&ring, &i) != EAI_OSAL_OK) {
+			eai_osal_spsc_ring_wait_writable(&ring, EAI_OSAL_WAIT_FOREVER);
+		}
+	}
+}
+
+static void ring_bulk_producer(void *arg)
+{
+	(void)arg;
+	uint32_t batch[BATCH];
+	uint32_t next = 0;
+
+	while (next < items) {
+		uint32_t n = items - next < BATCH ? items - next : BATCH;
+
+		for (uint32_t k = 0; k < n; k++) {
+			batch[k] = next + k;
+		}
+		uint32_t done = 0;
+
+		while (done < n) {
+			uint32_t pushed = eai_osal_spsc_ring_push_n(&ring, batch + done,
+								    n - done);
+			if (pushed == 0) {
+				eai_osal_spsc_ring_wait_writable(&ring,
+								 EAI_OSAL_WAIT_FOREVER);
+			}
+			done += pushed;
+		}
+		next += n;
+	}
+}
+
+/* ── Consumers ──────────────────────────────────────────────────────────── */
+
+static int queue_consume(void)
+{
+	uint32_t v;
+
+	for (uint32_t i = 0; i < items; i++) {
+		eai_osal_queue_recv(&queue, &v, EAI_OSAL_WAIT_FOREVER);
+		if (v != i) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int ring_consume(void)
+{
+	uint32_t v;
+
+	for (uint32_t i = 0; i < items; i++) {
+		while (eai_osal_spsc_ring_pop(&ring, &v) != EAI_OSAL_OK) {
+			eai_osal_spsc_ring_wait_readable(&ring, EAI_OSAL_WAIT_FOREVER);
+		}
+		if (v != i) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int ring_bulk_consume(void)
+{
+	uint32_t batch[BATCH];
+	uint32_t expect = 0;
+
+	while (expect < items) {
+		uint32_t n = eai_osal_spsc_ring_pop_n(&ring, batch, BATCH);
+
+		if (n == 0) {
+			eai_osal_spsc_ring_wait_readable(&ring, EAI_OSAL_WAIT_FOREVER);
+			continue;
+		}
+		for (uint32_t k = 0; k < n; k++) {
+			if (batch[k] != expect++) {
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+/* ── Runner ─────────────────────────────────────────────────────────────── */
+
+static int run(const char *name, eai_osal_thread_entry_t producer,
+	       int (*consume)(void))
+{
+	eai_osal_thread_t thread;
+
+	uint64_t start = eai_osal_time_get_ticks();
+
+	eai_osal_thread_create(&thread, "producer", producer, NULL,
+			       producer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(producer_stack), 10);
+	int rc = consume();
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	uint64_t us = eai_osal_time_get_ticks() - start;
+	double ns_per = (double)us * 1000.0 / items;
+	double mops = us ? (double)items / (double)us : 0.0;
+
+	printf("%-22s %10u items %8.1f ms %8.1f ns/item %8.2f Mitems/s %s\n",
+	       name, items, us / 1000.0, ns_per, mops,
+	       rc == 0 ? "" : "ORDER ERROR");
+	return rc;
+}
+
+int main(int argc, char **argv)
+{
+	int rc = 0;
+
+	if (argc > 1) {
+		items = (uint32_t)strtoul(argv[1], NULL, 0);
+	}
+
+	eai_osal_queue_create(&queue, sizeof(uint32_t), DEPTH, queue_buf);
+	rc |= run("eai_osal_queue", queue_producer, queue_consume);
+	eai_osal_queue_destroy(&queue);
+
+	eai_osal_spsc_ring_init(&ring, ring_buf, sizeof(uint32_t), DEPTH, true);
+	rc |= run("spsc_ring push/pop", ring_producer, ring_consume);
+	eai_osal_spsc_ring_destroy(&ring);
+
+	eai_osal_spsc_ring_init(&ring, ring_buf, sizeof(uint32_t), DEPTH, true);
+	rc |= run("spsc_ring push_n/pop_n", ring_bulk_producer, ring_bulk_consume);
+	eai_osal_spsc_ring_destroy(&ring);
+
+	return rc == 0 ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/*
+ * Semaphore / event cost — uncontended fast path and two-thread handoff.
+ *
+ * Uncontended: one thread give+take (or set+wait+clear) with nobody
+ * parked, i.e. the cost every kick path pays when the consumer is busy.
+ * Handoff: two threads bounce a token through a pair of semaphores (or
+ * event bits), so every operation wakes a parked thread.
+ *
+ * Built twice on Linux: osal_bench_sync uses the futex backend,
+ * osal_bench_sync_condvar forces the mutex + condvar fallback.
+ *
+ * Usage: osal_bench_sync [iterations]
+ */
+
+#include <eai_osal/eai_osal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_ITERS 1000000u
+#define HANDOFF_DIV   10u /* handoff rounds = iterations / HANDOFF_DIV */
+
+static uint32_t iters = DEFAULT_ITERS;
+
+static eai_osal_sem_t ping, pong;
+static eai_osal_event_t ev_ping, ev_pong;
+
+EAI_OSAL_THREAD_STACK_DEFINE(peer_stack, 16384);
+
+static void report(const char *name, uint32_t ops, uint64_t us)
+{
+	printf("%-26s %10u ops %8.1f ms %8.1f ns/op\n", name, ops, us / 1000.0,
+	       ops ? (double)us * 1000.0 / ops : 0.0);
+}
+
+/* ── Uncontended ────────────────────────────────────────────────────────── */
+
+static void bench_sem_uncontended(void)
+{
+	eai_osal_sem_t sem;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	uint64_t start = eai_osal_time_get_ticks();
+
+	for (uint32_t i = 0; i < iters; i++) {
+		eai_osal_sem_give(&sem);
+		eai_osal_sem_take(&sem, EAI_OSAL_WAIT_FOREVER);
+	}
+	report("sem give+take", iters, eai_osal_time_get_ticks() - start);
+	eai_osal_sem_destroy(&sem);
+}
+
+static void bench_event_uncontended(void)
+{
+	eai_osal_event_t event;
+
+	eai_osal_event_create(&event);
+	uint64_t start = eai_osal_time_get_ticks();
+
+	for (uint32_t i = 0; i < iters; i++) {
+		eai_osal_event_set(&event, 0x01);
+		eai_osal_event_wait(&event, 0x01, false, NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+		eai_osal_event_clear(&event, 0x01);
+	}
+	report("event set+wait+clear", iters, eai_osal_time_get_ticks() - start);
+	eai_osal_event_destroy(&event);
+}
+
+/* ── Handoff ────────────────────────────────────────────────────────────── */
+
+static void sem_peer(void *arg)
+{
+	uint32_t rounds = *(uint32_t *)arg;
+
+	for (uint32_t i = 0; i < rounds; i++) {
+		eai_osal_sem_take(&ping, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_sem_give(&pong);
+	}
+}
+
+static void event_peer(void *arg)
+{
+	uint32_t rounds = *(uint32_t *)arg;
+
+	for (uint32_t i = 0; i < rounds; i++) {
+		eai_osal_event_wait(&ev_ping, 0x01, false, NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+		eai_osal_event_clear(&ev_ping, 0x01);
+		eai_osal_event_set(&ev_pong, 0x01);
+	}
+}
+
+static void bench_sem_handoff(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t rounds = iters / HANDOFF_DIV;
+
+	eai_osal_sem_create(&ping, 0, 1);
+	eai_osal_sem_create(&pong, 0, 1);
+	eai_osal_thread_create(&thread, "peer", sem_peer, &rounds, peer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(peer_stack), 10);
+
+	uint64_t start = eai_osal_time_get_ticks();
+
+	for (uint32_t i = 0; i < rounds; i++) {
+		eai_osal_sem_give(&ping);
+		eai_osal_sem_take(&pong, EAI_OSAL_WAIT_FOREVER);
+	}
+	/* Two handoffs per round */
+	report("sem handoff", rounds * 2, eai_osal_time_get_ticks() - start);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&ping);
+	eai_osal_sem_destroy(&pong);
+}
+
+static void bench_event_handoff(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t rounds = iters / HANDOFF_DIV;
+
+	eai_osal_event_create(&ev_ping);
+	eai_osal_event_create(&ev_pong);
+	eai_osal_thread_create(&thread, "peer", event_peer, &rounds, peer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(peer_stack), 10);
+
+	uint64_t start = eai_osal_time_get_ticks();
+
+	for (uint32_t i = 0; i < rounds; i++) {
+		eai_osal_event_set(&ev_ping, 0x01);
+		eai_osal_event_wait(&ev_pong, 0x01, false, NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+		eai_osal_event_clear(&ev_pong, 0x01);
+	}
+	report("event handoff", rounds * 2, eai_osal_time_get_ticks() - start);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_event_destroy(&ev_ping);
+	eai_osal_event_destroy(&ev_pong);
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1) {
+		iters = (uint32_t)strtoul(argv[1], NULL, 0);
+	}
+
+	bench_sem_uncontended();
+	bench_event_uncontended();
+	bench_sem_handoff();
+	bench_event_handoff();
+	return 0;
+}
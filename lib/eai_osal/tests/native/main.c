@@ -1,17 +1,30 @@
 /*
  * OSAL POSIX backend tests — ported from ESP-IDF Unity tests.
  *
- * 44 tests across 9 suites: mutex, semaphore, thread, queue, timer,
- * event, critical, time, work.
+ * 88 tests across 16 suites: mutex, semaphore, thread, queue, timer,
+ * event, critical, time, work, spsc ring, poll, mempool, arena, rwlock,
+ * seqlock, atomic/spinlock. The osal_tests_stats build (EAI_OSAL_STATS=1)
+ * runs them all instrumented, plus 4 stats tests; osal_tests_trace
+ * (EAI_OSAL_TRACE=1) does the same with trace points, plus 4 trace tests.
  *
  * FreeRTOS-specific helpers replaced with OSAL semaphores (since
  * the semaphore is tested before any test that uses it as a helper).
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_getaffinity_np */
+#endif
+
 #include "unity.h"
 #include <eai_osal/eai_osal.h>
+#include <pthread.h>
+#include <sched.h>
 #include <string.h>
+#include <sys/resource.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 /* Unity requires setUp/tearDown */
 void setUp(void) {}
@@ -102,7 +115,7 @@ static void test_mutex_null_param(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Semaphore tests (5)
+ * Semaphore tests (6)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static void test_sem_create_destroy(void)
@@ -155,8 +168,49 @@ static void test_sem_give_at_limit(void)
 	eai_osal_sem_destroy(&sem);
 }
 
+/* Two threads bounce a token through a pair of semaphores */
+#define HANDOFF_ROUNDS 20000
+
+static eai_osal_sem_t ping_sem, pong_sem;
+
+static void pong_entry(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < HANDOFF_ROUNDS; i++) {
+		eai_osal_sem_take(&ping_sem, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_sem_give(&pong_sem);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(pong_stack, 4096);
+
+static void test_sem_handoff(void)
+{
+	eai_osal_thread_t thread;
+	int done = 0;
+
+	eai_osal_sem_create(&ping_sem, 0, 1);
+	eai_osal_sem_create(&pong_sem, 0, 1);
+	eai_osal_thread_create(&thread, "pong", pong_entry, NULL, pong_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(pong_stack), 5);
+
+	for (int i = 0; i < HANDOFF_ROUNDS; i++) {
+		eai_osal_sem_give(&ping_sem);
+		if (eai_osal_sem_take(&pong_sem, 1000) != EAI_OSAL_OK) {
+			break;
+		}
+		done++;
+	}
+	TEST_ASSERT_EQUAL(HANDOFF_ROUNDS, done);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER));
+
+	eai_osal_sem_destroy(&ping_sem);
+	eai_osal_sem_destroy(&pong_sem);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Thread tests (4)
+ * Thread tests (6)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static volatile int thread_counter;
@@ -203,7 +257,8 @@ static void test_thread_yield(void)
 
 /*
  * Priority test — adapted for POSIX.
- * POSIX SCHED_OTHER doesn't guarantee priority ordering without root.
+ * Without CAP_SYS_NICE threads fall back to nice values, which don't
+ * guarantee priority ordering.
  * Instead of checking FreeRTOS priority values, just verify both threads
  * execute at different OSAL priority levels.
  */
@@ -249,8 +304,79 @@ static void test_thread_priority(void)
 	eai_osal_sem_destroy(&prio_gate);
 }
 
+static int sched_policy_seen;
+static int sched_level_seen;
+
+static void sched_probe_entry(void *arg)
+{
+	(void)arg;
+	struct sched_param sp;
+
+	pthread_getschedparam(pthread_self(), &sched_policy_seen, &sp);
+	if (sched_policy_seen == SCHED_OTHER) {
+#if defined(__linux__)
+		sched_level_seen = getpriority(PRIO_PROCESS,
+					       (id_t)syscall(SYS_gettid));
+#endif
+	} else {
+		sched_level_seen = sp.sched_priority;
+	}
+}
+
+static void test_thread_sched_applied(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_thread_create(&thread, "sched", sched_probe_entry, NULL,
+			       prio_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_a), 5);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	/* Real-time level 1 + 5 when permitted, else nice 16 - 5 */
+	if (sched_policy_seen == SCHED_FIFO) {
+		TEST_ASSERT_EQUAL(sched_get_priority_min(SCHED_FIFO) + 5,
+				  sched_level_seen);
+	} else {
+		TEST_ASSERT_EQUAL(SCHED_OTHER, sched_policy_seen);
+#if defined(__linux__)
+		TEST_ASSERT_EQUAL(11, sched_level_seen);
+#endif
+	}
+}
+
+static void test_thread_set_affinity(void)
+{
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_thread_set_affinity(NULL, 0));
+#if defined(__linux__)
+	cpu_set_t before, after;
+
+	int cpu = 0;
+
+	/* The cpuset may exclude CPU 0 (e.g. docker --cpuset-cpus=2-3) */
+	TEST_ASSERT_EQUAL(0, pthread_getaffinity_np(pthread_self(),
+						    sizeof(before), &before));
+	while (cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &before)) {
+		cpu++;
+	}
+	if (cpu >= 32) {
+		TEST_IGNORE_MESSAGE("no CPU below 32 in the affinity mask");
+	}
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_thread_set_affinity(NULL, 1U << cpu));
+	pthread_getaffinity_np(pthread_self(), sizeof(after), &after);
+	TEST_ASSERT_EQUAL(1, CPU_COUNT(&after));
+	TEST_ASSERT_TRUE(CPU_ISSET(cpu, &after));
+
+	pthread_setaffinity_np(pthread_self(), sizeof(before), &before);
+#else
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_thread_set_affinity(NULL, 0x1));
+#endif
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Queue tests (5)
+ * Queue tests (9)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static uint8_t __attribute__((aligned(4))) queue_buf_4[4 * sizeof(int)];
@@ -329,8 +455,117 @@ static void test_queue_empty_timeout(void)
 	eai_osal_queue_destroy(&queue);
 }
 
+static void test_queue_reserve_commit(void)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+	int msg;
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_commit(&queue));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	/* Only one reservation at a time */
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	*(int *)slot = 77;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(77, msg);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_peek_release(void)
+{
+	eai_osal_queue_t queue;
+	void *msg;
+	int vals[] = {5, 6};
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_release(&queue));
+
+	eai_osal_queue_send(&queue, &vals[0], EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &vals[1], EAI_OSAL_NO_WAIT);
+
+	for (int i = 0; i < 2; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(vals[i], *(int *)msg);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue));
+	}
+
+	eai_osal_queue_destroy(&queue);
+}
+
+/* In-place slots: reservation blocks the slot, pointers walk the ring */
+static void test_queue_zero_copy_in_place(void)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+	void *msg;
+	int val = 1;
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	for (int i = 0; i < 5; i++) {
+		eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT);
+		TEST_ASSERT_EQUAL_PTR(queue_buf_2 + (i % 2) * sizeof(int), slot);
+
+		/* send waits behind the outstanding reservation */
+		TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+				  eai_osal_queue_send(&queue, &val, EAI_OSAL_NO_WAIT));
+		*(int *)slot = i;
+		eai_osal_queue_commit(&queue);
+
+		eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT);
+		TEST_ASSERT_EQUAL_PTR(slot, msg);
+		TEST_ASSERT_EQUAL(i, *(int *)msg);
+		eai_osal_queue_release(&queue);
+	}
+
+	/* Full queue: reserve times out */
+	eai_osal_queue_send(&queue, &val, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &val, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_reserve(&queue, &slot, 20));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_recv_many(void)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[6] = {0};
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	/* Partial send: only 4 fit */
+	TEST_ASSERT_EQUAL(4, eai_osal_queue_send_many(&queue, in, 6, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, eai_osal_queue_send_many(&queue, in, 1, EAI_OSAL_NO_WAIT));
+
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_recv_many(&queue, out, 3, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+
+	/* Wraps around the end of the buffer */
+	TEST_ASSERT_EQUAL(2, eai_osal_queue_send_many(&queue, &in[4], 2, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_recv_many(&queue, out, 6, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_INT_ARRAY(&in[3], out, 3);
+
+	TEST_ASSERT_EQUAL(0, eai_osal_queue_recv_many(&queue, out, 6, 20));
+
+	eai_osal_queue_destroy(&queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Timer tests (5)
+ * Timer tests (10)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static eai_osal_sem_t timer_sem;
@@ -427,8 +662,179 @@ static void test_timer_is_running(void)
 	eai_osal_timer_destroy(&timer);
 }
 
+/* Many timers share one service thread — all must fire, earliest first */
+#define MANY_TIMERS 64
+
+static eai_osal_sem_t many_sem;
+static volatile int many_order[MANY_TIMERS];
+static volatile int many_fired;
+
+static void many_timer_callback(void *arg)
+{
+	int idx = __atomic_fetch_add(&many_fired, 1, __ATOMIC_SEQ_CST);
+
+	if (idx < MANY_TIMERS) {
+		many_order[idx] = (int)(intptr_t)arg;
+	}
+	eai_osal_sem_give(&many_sem);
+}
+
+static void test_timer_many_ordered(void)
+{
+	static eai_osal_timer_t timers[MANY_TIMERS];
+
+	many_fired = 0;
+	eai_osal_sem_create(&many_sem, 0, MANY_TIMERS);
+
+	/* Start in scrambled order; timer i expires at 20 + 3*i ms */
+	for (int n = 0; n < MANY_TIMERS; n++) {
+		int i = (n * 37) % MANY_TIMERS;
+
+		eai_osal_timer_create(&timers[i], many_timer_callback,
+				      (void *)(intptr_t)i);
+		eai_osal_timer_start(&timers[i], 20 + 3 * i, 0);
+	}
+
+	for (int n = 0; n < MANY_TIMERS; n++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&many_sem, 1000));
+	}
+	TEST_ASSERT_EQUAL(MANY_TIMERS, many_fired);
+	for (int n = 0; n < MANY_TIMERS; n++) {
+		TEST_ASSERT_EQUAL(n, many_order[n]);
+	}
+
+	for (int i = 0; i < MANY_TIMERS; i++) {
+		eai_osal_timer_destroy(&timers[i]);
+	}
+	eai_osal_sem_destroy(&many_sem);
+}
+
+static void test_timer_restart(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	eai_osal_sem_create(&timer_sem, 0, 10);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	eai_osal_timer_start(&timer, 500, 0);
+	eai_osal_timer_start(&timer, 30, 0); /* re-arm, not a second timer */
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 200));
+	test_sleep_ms(100);
+	TEST_ASSERT_EQUAL(1, timer_count);
+
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&timer_sem);
+}
+
+static void test_timer_dispatch_workqueue(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	eai_osal_sem_create(&timer_sem, 0, 10);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_timer_set_dispatch(&timer,
+						      EAI_OSAL_TIMER_DISPATCH_WORKQUEUE,
+						      NULL));
+	eai_osal_timer_start(&timer, 20, 0);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 200));
+	TEST_ASSERT_EQUAL(1, timer_count);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_timer_set_dispatch(&timer,
+						      (eai_osal_timer_dispatch_t)7,
+						      NULL));
+
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&timer_sem);
+}
+
+/* Periodic expiries stay on the start + n * period grid */
+#define GRID_FIRES 25
+
+static volatile uint64_t grid_first_us;
+static volatile uint64_t grid_last_us;
+
+static void grid_callback(void *arg)
+{
+	(void)arg;
+	uint64_t now = eai_osal_time_get_ticks();
+	int n = __atomic_add_fetch(&timer_count, 1, __ATOMIC_SEQ_CST);
+
+	if (n == 1) {
+		grid_first_us = now;
+	}
+	if (n == GRID_FIRES) {
+		grid_last_us = now;
+		eai_osal_sem_give(&timer_sem);
+	}
+	/* Callback time must not push later expiries back */
+	usleep(4000);
+}
+
+static void test_timer_periodic_no_drift(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	eai_osal_sem_create(&timer_sem, 0, 1);
+
+	eai_osal_timer_create(&timer, grid_callback, NULL);
+	eai_osal_timer_start(&timer, 10, 10);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 1000));
+	eai_osal_timer_stop(&timer);
+
+	uint64_t span = grid_last_us - grid_first_us;
+
+	TEST_ASSERT_GREATER_OR_EQUAL((GRID_FIRES - 1) * 10000 - 1000, span);
+	TEST_ASSERT_LESS_OR_EQUAL((GRID_FIRES - 1) * 10000 + 3000, span);
+	TEST_ASSERT_EQUAL(0, eai_osal_timer_get_overruns(&timer));
+
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&timer_sem);
+}
+
+static void stall_callback(void *arg)
+{
+	(void)arg;
+	if (__atomic_add_fetch(&timer_count, 1, __ATOMIC_SEQ_CST) == 1) {
+		usleep(35000); /* 20 ms slot fires late, 30 and 40 are skipped */
+	}
+	eai_osal_sem_give(&timer_sem);
+}
+
+static void test_timer_overruns(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+	eai_osal_sem_create(&timer_sem, 0, 10);
+
+	eai_osal_timer_create(&timer, stall_callback, NULL);
+	TEST_ASSERT_EQUAL(0, eai_osal_timer_get_overruns(NULL));
+	eai_osal_timer_start(&timer, 10, 10);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 200));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 200));
+	eai_osal_timer_stop(&timer);
+
+	uint32_t overruns = eai_osal_timer_get_overruns(&timer);
+
+	TEST_ASSERT_GREATER_OR_EQUAL(2, overruns);
+	TEST_ASSERT_LESS_OR_EQUAL(3, overruns);
+
+	/* Restart clears the count */
+	eai_osal_timer_start(&timer, 500, 0);
+	TEST_ASSERT_EQUAL(0, eai_osal_timer_get_overruns(&timer));
+
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&timer_sem);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Event tests (5)
+ * Event tests (6)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static void test_event_create_destroy(void)
@@ -507,6 +913,46 @@ static void test_event_timeout(void)
 	eai_osal_event_destroy(&event);
 }
 
+/* One set must release every thread parked on the bit */
+#define EVENT_WAITERS 3
+
+static eai_osal_event_t bcast_event;
+static int bcast_woken;
+
+static void bcast_waiter_entry(void *arg)
+{
+	(void)arg;
+	if (eai_osal_event_wait(&bcast_event, 0x04, false, NULL, 1000) ==
+	    EAI_OSAL_OK) {
+		__atomic_fetch_add(&bcast_woken, 1, __ATOMIC_SEQ_CST);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(bcast_stacks[EVENT_WAITERS], 4096);
+
+static void test_event_wakes_all_waiters(void)
+{
+	eai_osal_thread_t threads[EVENT_WAITERS];
+
+	bcast_woken = 0;
+	eai_osal_event_create(&bcast_event);
+	for (int i = 0; i < EVENT_WAITERS; i++) {
+		eai_osal_thread_create(&threads[i], "waiter", bcast_waiter_entry,
+				       NULL, bcast_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(bcast_stacks[i]),
+				       5);
+	}
+
+	test_sleep_ms(20); /* let them park */
+	eai_osal_event_set(&bcast_event, 0x04);
+
+	for (int i = 0; i < EVENT_WAITERS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+	TEST_ASSERT_EQUAL(EVENT_WAITERS, bcast_woken);
+	eai_osal_event_destroy(&bcast_event);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Critical section tests (2)
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -557,9 +1003,10 @@ static void test_time_tick_roundtrip(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Work queue tests (9)
+ * Work queue tests (17)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
+/* Work items are static: a queue references them until they have run */
 static eai_osal_sem_t work_sem;
 static volatile int work_counter;
 
@@ -572,13 +1019,13 @@ static void work_callback(void *arg)
 
 static void test_work_init(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_init(&work, work_callback, NULL));
 }
 
 static void test_work_init_null(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
 			  eai_osal_work_init(NULL, work_callback, NULL));
 	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
@@ -587,7 +1034,7 @@ static void test_work_init_null(void)
 
 static void test_work_submit(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	work_counter = 0;
 	eai_osal_sem_create(&work_sem, 0, 1);
 
@@ -610,7 +1057,7 @@ static void work_with_arg(void *arg)
 
 static void test_work_arg_passthrough(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	static int my_arg = 77;
 
 	work_arg_val = 0;
@@ -627,13 +1074,13 @@ static void test_work_arg_passthrough(void)
 
 static void test_dwork_init(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_init(&dwork, work_callback, NULL));
 }
 
 static void test_dwork_submit(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	eai_osal_sem_create(&work_sem, 0, 1);
 
@@ -653,7 +1100,7 @@ static void test_dwork_submit(void)
 
 static void test_dwork_cancel(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	eai_osal_sem_create(&work_sem, 0, 1);
 
@@ -669,6 +1116,31 @@ static void test_dwork_cancel(void)
 	eai_osal_sem_destroy(&work_sem);
 }
 
+static void test_dwork_reschedule(void)
+{
+	static eai_osal_dwork_t dwork;
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 1);
+
+	eai_osal_dwork_init(&dwork, work_callback, NULL);
+
+	/* Debounce pattern: many resubmits collapse into one execution */
+	for (int i = 0; i < 1000; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_submit(&dwork, 300));
+	}
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_submit(&dwork, 50));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 500));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_LESS_THAN(250, elapsed);
+	test_sleep_ms(350);
+	TEST_ASSERT_EQUAL(1, work_counter);
+
+	eai_osal_sem_destroy(&work_sem);
+}
+
 /* Custom work queue — static, persists across tests */
 EAI_OSAL_THREAD_STACK_DEFINE(custom_wq_stack, 2048);
 static eai_osal_workqueue_t test_wq;
@@ -687,7 +1159,7 @@ static void ensure_test_wq(void)
 
 static void test_custom_workqueue(void)
 {
-	eai_osal_work_t work;
+	static eai_osal_work_t work;
 	work_counter = 0;
 	eai_osal_sem_create(&work_sem, 0, 1);
 
@@ -704,7 +1176,7 @@ static void test_custom_workqueue(void)
 
 static void test_dwork_submit_to_queue(void)
 {
-	eai_osal_dwork_t dwork;
+	static eai_osal_dwork_t dwork;
 	work_counter = 0;
 	eai_osal_sem_create(&work_sem, 0, 1);
 
@@ -719,6 +1191,1501 @@ static void test_dwork_submit_to_queue(void)
 	eai_osal_sem_destroy(&work_sem);
 }
 
+/* Holds the test queue's worker until gate is given */
+static eai_osal_sem_t gate_sem;
+
+static void gate_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_take(&gate_sem, EAI_OSAL_WAIT_FOREVER);
+}
+
+static void test_work_resubmit_coalesces(void)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t work;
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 8);
+	eai_osal_sem_create(&gate_sem, 0, 1);
+
+	ensure_test_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&gate, &test_wq);
+
+	/* Queue depth is far smaller than 100; duplicates must not use slots */
+	for (int i = 0; i < 100; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&work, &test_wq));
+	}
+	TEST_ASSERT_TRUE(eai_osal_work_is_pending(&work));
+
+	eai_osal_sem_give(&gate_sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_flush(&work));
+	TEST_ASSERT_EQUAL(1, work_counter);
+	TEST_ASSERT_FALSE(eai_osal_work_is_pending(&work));
+
+	eai_osal_sem_destroy(&gate_sem);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+static volatile int slow_done;
+
+static void slow_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_thread_sleep(50);
+	slow_done = 1;
+}
+
+static void test_work_flush_waits(void)
+{
+	static eai_osal_work_t work;
+	slow_done = 0;
+
+	eai_osal_work_init(&work, slow_callback, NULL);
+	eai_osal_work_submit(&work);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_flush(&work));
+	TEST_ASSERT_EQUAL(1, slow_done);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_flush(&work));
+}
+
+static void test_work_cancel_sync(void)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t work;
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 1);
+	eai_osal_sem_create(&gate_sem, 0, 1);
+
+	ensure_test_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&gate, &test_wq);
+	eai_osal_work_submit_to(&work, &test_wq);
+
+	/* Cancel while queued behind the gate; then resubmit reuses the slot */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_cancel(&work));
+	TEST_ASSERT_FALSE(eai_osal_work_is_pending(&work));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&work, &test_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_cancel(&work));
+
+	eai_osal_sem_give(&gate_sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_cancel_sync(&work));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_flush(&gate));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&work_sem, 50));
+	TEST_ASSERT_EQUAL(0, work_counter);
+
+	eai_osal_sem_destroy(&gate_sem);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* Pool — static, persists across tests */
+#define POOL_WORKERS 4
+#define POOL_ITEMS   8
+
+EAI_OSAL_THREAD_STACK_DEFINE(lanes_wq_stack, 16384);
+EAI_OSAL_WQ_BUF_DEFINE(lanes_buf, 2, 4);
+static eai_osal_workqueue_t lanes_wq;
+static bool lanes_wq_started;
+static int lane_order[8];
+static volatile int lane_count;
+
+static void ensure_lanes_wq(void)
+{
+	if (!lanes_wq_started) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_workqueue_create_lanes(
+					  &lanes_wq, "lanes_wq", lanes_wq_stack,
+					  EAI_OSAL_THREAD_STACK_SIZEOF(lanes_wq_stack),
+					  10, lanes_buf, 4, 2));
+		lanes_wq_started = true;
+	}
+}
+
+static void lane_record(void *arg)
+{
+	lane_order[lane_count++] = (int)(intptr_t)arg;
+	eai_osal_sem_give(&work_sem);
+}
+
+static void test_workqueue_lanes_priority(void)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t low[2];
+	static eai_osal_work_t high;
+
+	lane_count = 0;
+	eai_osal_sem_create(&work_sem, 0, 3);
+	eai_osal_sem_create(&gate_sem, 0, 1);
+	ensure_lanes_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_submit_to(&gate, &lanes_wq);
+	eai_osal_thread_sleep(10);
+
+	/* Low lane first, urgent item last: it must still run first */
+	for (int i = 0; i < 2; i++) {
+		eai_osal_work_init(&low[i], lane_record, (void *)(intptr_t)(i + 1));
+		eai_osal_work_submit_to(&low[i], &lanes_wq);
+	}
+	eai_osal_work_init(&high, lane_record, (void *)(intptr_t)100);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_set_lane(&high, 1));
+	eai_osal_work_submit_to(&high, &lanes_wq);
+
+	eai_osal_sem_give(&gate_sem);
+	for (int i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 500));
+	}
+	TEST_ASSERT_EQUAL(100, lane_order[0]);
+	TEST_ASSERT_EQUAL(1, lane_order[1]);
+	TEST_ASSERT_EQUAL(2, lane_order[2]);
+
+	eai_osal_sem_destroy(&gate_sem);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+static void test_workqueue_lanes_depth_hwm(void)
+{
+	static eai_osal_workqueue_t bad;
+	static eai_osal_work_t gate;
+	static eai_osal_work_t items[5];
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_workqueue_create_lanes(
+				  &bad, "bad", lanes_wq_stack,
+				  EAI_OSAL_THREAD_STACK_SIZEOF(lanes_wq_stack),
+				  10, lanes_buf, 4, EAI_OSAL_WQ_MAX_LANES + 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_work_set_lane(&gate, EAI_OSAL_WQ_MAX_LANES));
+
+	lane_count = 0;
+	eai_osal_sem_create(&work_sem, 0, 4);
+	eai_osal_sem_create(&gate_sem, 0, 1);
+	ensure_lanes_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_submit_to(&gate, &lanes_wq);
+	eai_osal_thread_sleep(10);
+
+	/* Four slots per lane: the fifth distinct item is rejected */
+	for (int i = 0; i < 5; i++) {
+		eai_osal_work_init(&items[i], lane_record, NULL);
+		TEST_ASSERT_EQUAL(i < 4 ? EAI_OSAL_OK : EAI_OSAL_ERROR,
+				  eai_osal_work_submit_to(&items[i], &lanes_wq));
+	}
+	TEST_ASSERT_EQUAL(4, eai_osal_workqueue_high_water(&lanes_wq, 0));
+	TEST_ASSERT_EQUAL(0, eai_osal_workqueue_high_water(&lanes_wq, 2));
+
+	eai_osal_sem_give(&gate_sem);
+	for (int i = 0; i < 4; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 500));
+	}
+	TEST_ASSERT_FALSE(eai_osal_work_is_pending(&items[4]));
+
+	eai_osal_sem_destroy(&gate_sem);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+static eai_osal_wq_worker_t pool_workers[POOL_WORKERS];
+static eai_osal_workqueue_t test_pool;
+static bool test_pool_started;
+static pthread_t pool_ran_on[POOL_ITEMS];
+static int pool_slot;
+
+static void ensure_test_pool(void)
+{
+	if (!test_pool_started) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_workqueue_pool_create(&test_pool, "pool",
+								 pool_workers,
+								 POOL_WORKERS, 10,
+								 NULL));
+		test_pool_started = true;
+	}
+}
+
+static void pool_item(void *arg)
+{
+	(void)arg;
+	int i = __atomic_fetch_add(&pool_slot, 1, __ATOMIC_SEQ_CST);
+
+	pool_ran_on[i] = pthread_self();
+	test_sleep_ms(20);
+	__atomic_fetch_add(&work_counter, 1, __ATOMIC_SEQ_CST);
+	eai_osal_sem_give(&work_sem);
+}
+
+static int pool_distinct_threads(void)
+{
+	int distinct = 0;
+
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		int seen = 0;
+
+		for (int j = 0; j < i; j++) {
+			seen |= pthread_equal(pool_ran_on[i], pool_ran_on[j]);
+		}
+		distinct += !seen;
+	}
+	return distinct;
+}
+
+static void pool_wait_all(void)
+{
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 1000));
+	}
+	TEST_ASSERT_EQUAL(POOL_ITEMS, work_counter);
+}
+
+static void test_workqueue_pool(void)
+{
+	static eai_osal_work_t works[POOL_ITEMS];
+
+	work_counter = 0;
+	pool_slot = 0;
+	eai_osal_sem_create(&work_sem, 0, POOL_ITEMS);
+	ensure_test_pool();
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&works[i], pool_item, NULL);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to(&works[i], &test_pool));
+	}
+	pool_wait_all();
+
+	/* 8 x 20 ms on 4 workers: well under the 160 ms a single thread needs */
+	TEST_ASSERT_LESS_THAN(120, eai_osal_time_get_ms() - start);
+	TEST_ASSERT_EQUAL(POOL_WORKERS, pool_distinct_threads());
+
+	eai_osal_sem_destroy(&work_sem);
+}
+
+static eai_osal_work_t steal_works[POOL_ITEMS];
+
+/* Runs on one worker and queues everything on that worker's own deque */
+static void pool_spawner(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&steal_works[i], pool_item, NULL);
+		eai_osal_work_submit_to(&steal_works[i], &test_pool);
+	}
+}
+
+static void test_workqueue_pool_steal(void)
+{
+	static eai_osal_work_t spawner;
+
+	work_counter = 0;
+	pool_slot = 0;
+	eai_osal_sem_create(&work_sem, 0, POOL_ITEMS);
+	ensure_test_pool();
+
+	eai_osal_work_init(&spawner, pool_spawner, NULL);
+	eai_osal_work_submit_to(&spawner, &test_pool);
+	pool_wait_all();
+
+	/* Everything landed on one deque; idle workers must have stolen */
+	TEST_ASSERT_GREATER_THAN(1, pool_distinct_threads());
+
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC ring tests (4)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static uint32_t spsc_buf[8];
+
+static void test_spsc_init_rejects_non_pow2(void)
+{
+	eai_osal_spsc_ring_t ring;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t),
+						  6, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t),
+						  0, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t),
+						  8, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_spsc_ring_wait_readable(&ring, EAI_OSAL_NO_WAIT));
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+static void test_spsc_fifo_full_empty(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t v;
+
+	eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t), 8, false);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_spsc_ring_pop(&ring, &v));
+	for (uint32_t i = 0; i < 8; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_spsc_ring_push(&ring, &i));
+	}
+	v = 99;
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_spsc_ring_push(&ring, &v));
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_ring_count(&ring));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_ring_space(&ring));
+
+	for (uint32_t i = 0; i < 8; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_spsc_ring_pop(&ring, &v));
+		TEST_ASSERT_EQUAL(i, v);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_spsc_ring_pop(&ring, &v));
+
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+/* Bulk transfers that straddle the end of the buffer */
+static void test_spsc_bulk_wraparound(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[8];
+	uint32_t out[8];
+	uint32_t seq = 0;
+	uint32_t expect = 0;
+
+	eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t), 8, false);
+
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 5; i++) {
+			in[i] = seq++;
+		}
+		TEST_ASSERT_EQUAL(5, eai_osal_spsc_ring_push_n(&ring, in, 5));
+		TEST_ASSERT_EQUAL(5, eai_osal_spsc_ring_pop_n(&ring, out, 8));
+		for (int i = 0; i < 5; i++) {
+			TEST_ASSERT_EQUAL(expect++, out[i]);
+		}
+	}
+
+	/* Partial push when fewer slots than requested */
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_ring_push_n(&ring, in, 8));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_ring_push_n(&ring, in, 1));
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_ring_pop_n(&ring, out, 3));
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_ring_push_n(&ring, in, 5));
+
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+static void test_spsc_peek_release(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[6] = { 10, 11, 12, 13, 14, 15 };
+	uint32_t out[4];
+	const void *p;
+
+	eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t), 8, false);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_ring_peek(&ring, &p, 8));
+
+	/* Move the indices to 5 so the next 6 elements straddle the wrap */
+	TEST_ASSERT_EQUAL(5, eai_osal_spsc_ring_push_n(&ring, in, 5));
+	TEST_ASSERT_EQUAL(4, eai_osal_spsc_ring_pop_n(&ring, out, 4));
+	TEST_ASSERT_EQUAL(1, eai_osal_spsc_ring_peek(&ring, &p, 8));
+	TEST_ASSERT_EQUAL_PTR(&spsc_buf[4], p);
+	eai_osal_spsc_ring_release(&ring, 1);
+	TEST_ASSERT_EQUAL(6, eai_osal_spsc_ring_push_n(&ring, in, 6));
+
+	/* Contiguous up to the end of the buffer, then from the start */
+	TEST_ASSERT_EQUAL(2, eai_osal_spsc_ring_peek(&ring, &p, 2));
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_ring_peek(&ring, &p, 8));
+	TEST_ASSERT_EQUAL_PTR(&spsc_buf[5], p);
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(in, p, 3);
+	eai_osal_spsc_ring_release(&ring, 3);
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_ring_peek(&ring, &p, 8));
+	TEST_ASSERT_EQUAL_PTR(&spsc_buf[0], p);
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(&in[3], p, 3);
+
+	/* Peeking alone frees nothing */
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_ring_count(&ring));
+	eai_osal_spsc_ring_release(&ring, 3);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_ring_count(&ring));
+
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+#define SPSC_ITEMS 100000u
+
+static eai_osal_spsc_ring_t spsc_ring;
+EAI_OSAL_THREAD_STACK_DEFINE(spsc_stack, 4096);
+
+static void spsc_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < SPSC_ITEMS; i++) {
+		while (eai_osal_spsc_ring_push(&spsc_ring, &i) != EAI_OSAL_OK) {
+			eai_osal_spsc_ring_wait_writable(&spsc_ring,
+							 EAI_OSAL_WAIT_FOREVER);
+		}
+	}
+}
+
+static void test_spsc_threaded_blocking(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t v;
+	uint32_t errors = 0;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_spsc_ring_init(&spsc_ring, spsc_buf,
+						  sizeof(uint32_t), 8, true));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_spsc_ring_wait_readable(&spsc_ring, 10));
+
+	eai_osal_thread_create(&thread, "spsc", spsc_producer, NULL,
+			       spsc_stack, EAI_OSAL_THREAD_STACK_SIZEOF(spsc_stack),
+			       10);
+
+	for (uint32_t i = 0; i < SPSC_ITEMS; i++) {
+		while (eai_osal_spsc_ring_pop(&spsc_ring, &v) != EAI_OSAL_OK) {
+			TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+					  eai_osal_spsc_ring_wait_readable(&spsc_ring,
+									   1000));
+		}
+		if (v != i) {
+			errors++;
+		}
+	}
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(0, errors);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_ring_count(&spsc_ring));
+
+	eai_osal_spsc_ring_destroy(&spsc_ring);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests (4)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_poll_invalid_param(void)
+{
+	eai_osal_event_t event;
+	eai_osal_poll_event_t ev[] = { EAI_OSAL_POLL_EVENT(&event, 0) };
+	eai_osal_poll_event_t none[] = { EAI_OSAL_POLL_SEM(NULL) };
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_poll(NULL, 1, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_poll(ev, 0, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_poll(ev, 1, EAI_OSAL_NO_WAIT)); /* bits == 0 */
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_poll(none, 1, EAI_OSAL_NO_WAIT));
+}
+
+static void test_poll_ready_and_timeout(void)
+{
+	eai_osal_queue_t queue;
+	uint32_t buf[4];
+	eai_osal_sem_t sem;
+
+	eai_osal_queue_create(&queue, sizeof(uint32_t), 4, buf);
+	eai_osal_sem_create(&sem, 0, 1);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_QUEUE(&queue),
+		EAI_OSAL_POLL_SEM(&sem),
+	};
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(ev, 2, 50));
+	TEST_ASSERT_GREATER_OR_EQUAL(45, eai_osal_time_get_ms() - start);
+
+	/* Already ready: returns at once, and poll does not consume */
+	eai_osal_sem_give(&sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(ev, 2, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_FALSE(ev[0].ready);
+	TEST_ASSERT_TRUE(ev[1].ready);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT));
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_queue_destroy(&queue);
+}
+
+/* Helper posts to the second of two queues after a delay */
+static eai_osal_queue_t poll_queues[2];
+
+static void poll_sender_entry(void *arg)
+{
+	uint32_t v = 7;
+
+	(void)arg;
+	test_sleep_ms(20);
+	eai_osal_queue_send(&poll_queues[1], &v, EAI_OSAL_NO_WAIT);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(poll_stack, 4096);
+
+static void test_poll_wakes_on_queue(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t bufs[2][4];
+	uint32_t v = 0;
+
+	eai_osal_queue_create(&poll_queues[0], sizeof(uint32_t), 4, bufs[0]);
+	eai_osal_queue_create(&poll_queues[1], sizeof(uint32_t), 4, bufs[1]);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_QUEUE(&poll_queues[0]),
+		EAI_OSAL_POLL_QUEUE(&poll_queues[1]),
+	};
+
+	eai_osal_thread_create(&thread, "sender", poll_sender_entry, NULL,
+			       poll_stack, EAI_OSAL_THREAD_STACK_SIZEOF(poll_stack),
+			       5);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(ev, 2, 1000));
+	TEST_ASSERT_FALSE(ev[0].ready);
+	TEST_ASSERT_TRUE(ev[1].ready);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv(&poll_queues[1], &v, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(7, v);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_queue_destroy(&poll_queues[0]);
+	eai_osal_queue_destroy(&poll_queues[1]);
+}
+
+/* Bits outside the mask must not complete the poll */
+static eai_osal_event_t poll_event;
+
+static void poll_setter_entry(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(10);
+	eai_osal_event_set(&poll_event, 0x01);
+	test_sleep_ms(20);
+	eai_osal_event_set(&poll_event, 0x10);
+}
+
+static void test_poll_wakes_on_event_bits(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_event_create(&poll_event);
+
+	eai_osal_poll_event_t ev[] = { EAI_OSAL_POLL_EVENT(&poll_event, 0x30) };
+
+	eai_osal_thread_create(&thread, "setter", poll_setter_entry, NULL,
+			       poll_stack, EAI_OSAL_THREAD_STACK_SIZEOF(poll_stack),
+			       5);
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(ev, 1, 1000));
+	TEST_ASSERT_TRUE(ev[0].ready);
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_event_destroy(&poll_event);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define POOL_BLOCK  EAI_OSAL_MEMPOOL_BLOCK_SIZE(24)
+#define POOL_BLOCKS 8
+
+static uint64_t pool_buf[POOL_BLOCK * POOL_BLOCKS / sizeof(uint64_t)];
+
+static void test_mempool_invalid_param(void)
+{
+	eai_osal_mempool_t pool;
+	void *blk;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, pool_buf, 0, POOL_BLOCKS));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, pool_buf, 25, POOL_BLOCKS));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, (uint8_t *)pool_buf + 1,
+						  POOL_BLOCK, POOL_BLOCKS - 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK, 0));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK,
+						  POOL_BLOCKS));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_alloc(&pool, &blk));
+
+	/* Interior, out-of-range and foreign pointers are rejected */
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, (uint8_t *)blk + 8));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, (uint8_t *)pool_buf +
+							 sizeof(pool_buf)));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, &pool));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk));
+	eai_osal_mempool_destroy(&pool);
+}
+
+static void test_mempool_exhaust_and_stats(void)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *blk[POOL_BLOCKS];
+	void *extra;
+
+	eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK, POOL_BLOCKS);
+
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_alloc(&pool, &blk[i]));
+		memset(blk[i], i, POOL_BLOCK);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY, eai_osal_mempool_alloc(&pool, &extra));
+
+	/* Every block is distinct and inside the buffer */
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		uint8_t *p = blk[i];
+
+		TEST_ASSERT_TRUE(p >= (uint8_t *)pool_buf &&
+				 p < (uint8_t *)pool_buf + sizeof(pool_buf));
+		TEST_ASSERT_EQUAL(i, p[POOL_BLOCK - 1]);
+	}
+
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.num_blocks);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.in_use);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.peak);
+	TEST_ASSERT_EQUAL(1, st.failed);
+
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[i]));
+	}
+
+	/* LIFO — the last block freed comes back first */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_alloc(&pool, &extra));
+	TEST_ASSERT_EQUAL_PTR(blk[POOL_BLOCKS - 1], extra);
+	eai_osal_mempool_free(&pool, extra);
+
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.in_use);
+	TEST_ASSERT_EQUAL(POOL_BLOCKS, st.peak);
+	eai_osal_mempool_destroy(&pool);
+}
+
+#define POOL_THREADS 4
+#define POOL_ROUNDS  20000
+
+static eai_osal_mempool_t mt_pool;
+static uint32_t mt_errors;
+
+/* Stamp each block with the owner's id and check nobody else holds it */
+static void pool_churn_entry(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	void *held[2];
+
+	for (int i = 0; i < POOL_ROUNDS; i++) {
+		int n = 0;
+
+		for (int j = 0; j < 2; j++) {
+			if (eai_osal_mempool_alloc(&mt_pool, &held[n]) == EAI_OSAL_OK) {
+				/* Word 1 — word 0 is the free-list link */
+				__atomic_store_n((uint32_t *)held[n] + 1, id,
+						 __ATOMIC_RELAXED);
+				n++;
+			}
+		}
+		for (int j = 0; j < n; j++) {
+			if (__atomic_load_n((uint32_t *)held[j] + 1,
+					    __ATOMIC_RELAXED) != id) {
+				__atomic_fetch_add(&mt_errors, 1, __ATOMIC_RELAXED);
+			}
+			eai_osal_mempool_free(&mt_pool, held[j]);
+		}
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(pool_stack, 4096);
+
+static void test_mempool_threaded_churn(void)
+{
+	eai_osal_thread_t threads[POOL_THREADS];
+	eai_osal_mempool_stats_t st;
+	void *blk[POOL_BLOCKS];
+
+	mt_errors = 0;
+	eai_osal_mempool_create(&mt_pool, pool_buf, POOL_BLOCK, POOL_BLOCKS);
+
+	for (uint32_t i = 0; i < POOL_THREADS; i++) {
+		eai_osal_thread_create(&threads[i], "churn", pool_churn_entry,
+				       (void *)(uintptr_t)(i + 1), pool_stack,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stack), 5);
+	}
+	for (int i = 0; i < POOL_THREADS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(0, mt_errors);
+	eai_osal_mempool_get_stats(&mt_pool, &st);
+	TEST_ASSERT_EQUAL(0, st.in_use);
+	TEST_ASSERT_LESS_OR_EQUAL(POOL_BLOCKS, st.peak);
+
+	/* Free list is intact — every block can be taken again */
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_alloc(&mt_pool, &blk[i]));
+	}
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		for (int j = 0; j < i; j++) {
+			TEST_ASSERT_NOT_EQUAL(blk[j], blk[i]);
+		}
+	}
+	eai_osal_mempool_destroy(&mt_pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Arena tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static uint64_t arena_buf[32]; /* 256 bytes */
+
+static void test_arena_alignment(void)
+{
+	eai_osal_arena_t arena;
+	void *p;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_arena_init(&arena, arena_buf, 0));
+	/* Start off an 8-byte boundary to exercise absolute alignment */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_arena_init(&arena, (uint8_t *)arena_buf + 1,
+					      sizeof(arena_buf) - 1));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 3, 1, &p));
+	TEST_ASSERT_EQUAL_PTR((uint8_t *)arena_buf + 1, p);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 4, 0, &p));
+	TEST_ASSERT_EQUAL(0, (uintptr_t)p % EAI_OSAL_ARENA_ALIGN);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 1, 64, &p));
+	TEST_ASSERT_EQUAL(0, (uintptr_t)p % 64);
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_arena_alloc(&arena, 1, 24, &p));
+}
+
+static void test_arena_mark_release(void)
+{
+	eai_osal_arena_t arena;
+	eai_osal_arena_stats_t st;
+	void *a;
+	void *b;
+	void *c;
+
+	eai_osal_arena_init(&arena, arena_buf, sizeof(arena_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 32, 0, &a));
+
+	eai_osal_arena_mark_t m = eai_osal_arena_mark(&arena);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 100, 0, &b));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_release(&arena, m));
+
+	/* The space after the mark is handed out again */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 16, 0, &c));
+	TEST_ASSERT_EQUAL_PTR(b, c);
+
+	eai_osal_arena_get_stats(&arena, &st);
+	TEST_ASSERT_EQUAL(sizeof(arena_buf), st.size);
+	TEST_ASSERT_EQUAL(48, st.used);
+	TEST_ASSERT_EQUAL(132, st.high_water);
+
+	/* A mark beyond the current position is stale */
+	eai_osal_arena_reset(&arena);
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_arena_release(&arena, m));
+	eai_osal_arena_get_stats(&arena, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+	TEST_ASSERT_EQUAL(132, st.high_water);
+}
+
+static void test_arena_exhaustion(void)
+{
+	eai_osal_arena_t arena;
+	eai_osal_arena_stats_t st;
+	void *p;
+
+	eai_osal_arena_init(&arena, arena_buf, sizeof(arena_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_arena_alloc(&arena, sizeof(arena_buf) - 8, 0, &p));
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY, eai_osal_arena_alloc(&arena, 9, 0, &p));
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY,
+			  eai_osal_arena_alloc(&arena, SIZE_MAX, 0, &p));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_arena_alloc(&arena, 8, 0, &p));
+
+	eai_osal_arena_get_stats(&arena, &st);
+	TEST_ASSERT_EQUAL(sizeof(arena_buf), st.used);
+	TEST_ASSERT_EQUAL(2, st.failed);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Rwlock tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static eai_osal_rwlock_t rw;
+static eai_osal_sem_t rw_sem;
+static uint32_t rw_read_result;
+static uint32_t rw_write_result;
+
+static void rw_reader_entry(void *arg)
+{
+	(void)arg;
+	rw_read_result = eai_osal_rwlock_read_lock(&rw, 200);
+	if (rw_read_result == EAI_OSAL_OK) {
+		eai_osal_rwlock_read_unlock(&rw);
+	}
+	eai_osal_sem_give(&rw_sem);
+}
+
+static void rw_writer_entry(void *arg)
+{
+	(void)arg;
+	rw_write_result = eai_osal_rwlock_write_lock(&rw, 1000);
+	eai_osal_sem_give(&rw_sem);
+	if (rw_write_result == EAI_OSAL_OK) {
+		test_sleep_ms(30);
+		eai_osal_rwlock_write_unlock(&rw);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(rw_stack, 4096);
+
+static void test_rwlock_readers_share(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_rwlock_create(&rw);
+	eai_osal_sem_create(&rw_sem, 0, 1);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	eai_osal_thread_create(&thread, "reader", rw_reader_entry, NULL, rw_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 5);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&rw_sem, 1000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, rw_read_result);
+
+	/* A writer cannot get in while a reader holds the lock */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, 20));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_unlock(&rw));
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&rw_sem);
+	eai_osal_rwlock_destroy(&rw);
+}
+
+static void test_rwlock_writer_preference(void)
+{
+	eai_osal_thread_t writer;
+	eai_osal_thread_t reader;
+
+	eai_osal_rwlock_create(&rw);
+	eai_osal_sem_create(&rw_sem, 0, 1);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	eai_osal_thread_create(&writer, "writer", rw_writer_entry, NULL, rw_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 5);
+	test_sleep_ms(20); /* writer is now queued behind our read hold */
+
+	/* New readers wait behind the queued writer */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw, 20));
+
+	eai_osal_thread_create(&reader, "reader", rw_reader_entry, NULL, rw_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 5);
+	uint32_t start = eai_osal_time_get_ms();
+
+	eai_osal_rwlock_read_unlock(&rw);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&rw_sem, 1000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, rw_write_result);
+	eai_osal_thread_join(&writer, EAI_OSAL_WAIT_FOREVER);
+
+	/* The reader only got in once the writer's 30 ms hold ended */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&rw_sem, 1000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, rw_read_result);
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+
+	eai_osal_thread_join(&reader, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&rw_sem);
+	eai_osal_rwlock_destroy(&rw);
+}
+
+static void test_rwlock_unlock_errors(void)
+{
+	eai_osal_rwlock_create(&rw);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_write_unlock(&rw));
+
+	/* A writer that timed out must not keep readers out */
+	eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, 10));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	eai_osal_rwlock_read_unlock(&rw);
+	eai_osal_rwlock_read_unlock(&rw);
+	eai_osal_rwlock_destroy(&rw);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Seqlock tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+struct imu_sample {
+	uint32_t seq;
+	int32_t x, y, z;
+	uint8_t flags[3]; /* odd tail exercises the byte copy */
+};
+
+static eai_osal_seqlock_t sl;
+static struct imu_sample sl_shared;
+static bool sl_stop;
+
+static void test_seqlock_roundtrip(void)
+{
+	struct imu_sample in = { 7, -1, 2, -3, { 1, 2, 3 } };
+	struct imu_sample out;
+
+	eai_osal_seqlock_init(&sl);
+	eai_osal_seqlock_write(&sl, &sl_shared, &in, sizeof(in));
+	TEST_ASSERT_EQUAL(0, eai_osal_seqlock_read(&sl, &out, &sl_shared, sizeof(out)));
+	TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(in));
+
+	/* A read overlapping a write must retry */
+	uint32_t seq = eai_osal_seqlock_read_begin(&sl);
+
+	eai_osal_seqlock_write_begin(&sl);
+	eai_osal_seqlock_write_end(&sl);
+	TEST_ASSERT_TRUE(eai_osal_seqlock_read_retry(&sl, seq));
+	TEST_ASSERT_FALSE(eai_osal_seqlock_read_retry(&sl, eai_osal_seqlock_read_begin(&sl)));
+}
+
+static void sl_writer_entry(void *arg)
+{
+	(void)arg;
+	for (uint32_t n = 1; !__atomic_load_n(&sl_stop, __ATOMIC_RELAXED); n++) {
+		struct imu_sample s = {
+			n, (int32_t)n, -(int32_t)n, (int32_t)n * 2,
+			{ (uint8_t)n, (uint8_t)n, (uint8_t)n },
+		};
+
+		eai_osal_seqlock_write(&sl, &sl_shared, &s, sizeof(s));
+	}
+}
+
+static void test_seqlock_no_torn_reads(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t torn = 0;
+	uint32_t last = 0;
+	uint32_t backwards = 0;
+
+	eai_osal_seqlock_init(&sl);
+	memset(&sl_shared, 0, sizeof(sl_shared));
+	sl_stop = false;
+	eai_osal_thread_create(&thread, "sl_writer", sl_writer_entry, NULL,
+			       rw_stack, EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 5);
+
+	for (int i = 0; i < 200000; i++) {
+		struct imu_sample s;
+
+		eai_osal_seqlock_read(&sl, &s, &sl_shared, sizeof(s));
+		uint32_t n = s.seq;
+
+		if (s.x != (int32_t)n || s.y != -(int32_t)n || s.z != (int32_t)n * 2 ||
+		    s.flags[0] != (uint8_t)n || s.flags[2] != (uint8_t)n) {
+			torn++;
+		}
+		if (n < last) {
+			backwards++;
+		}
+		last = n;
+	}
+
+	__atomic_store_n(&sl_stop, true, __ATOMIC_RELAXED);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(0, torn);
+	TEST_ASSERT_EQUAL(0, backwards);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic / spinlock tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_atomic_ops(void)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+	eai_osal_atomic_val_t expected = 4;
+
+	TEST_ASSERT_EQUAL(5, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE));
+	TEST_ASSERT_EQUAL(5, eai_osal_atomic_fetch_add(&a, 3, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(8, eai_osal_atomic_fetch_sub(&a, 2, EAI_OSAL_ATOMIC_ACQ_REL));
+
+	/* A failed CAS reports the current value */
+	TEST_ASSERT_FALSE(eai_osal_atomic_cas(&a, &expected, 9, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(6, expected);
+	TEST_ASSERT_TRUE(eai_osal_atomic_cas(&a, &expected, 0x0F, EAI_OSAL_ATOMIC_RELEASE));
+
+	TEST_ASSERT_EQUAL(0x0F, eai_osal_atomic_fetch_and(&a, 0x3C, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(0x0C, eai_osal_atomic_fetch_or(&a, 0x01, EAI_OSAL_ATOMIC_SEQ_CST));
+	eai_osal_atomic_store(&a, -1, EAI_OSAL_ATOMIC_RELEASE);
+	TEST_ASSERT_EQUAL(-1, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_RELAXED));
+}
+
+#define SPIN_THREADS 4
+#define SPIN_ROUNDS  50000
+
+static eai_osal_atomic_t spin_atomic;
+static eai_osal_spinlock_t spin = EAI_OSAL_SPINLOCK_INITIALIZER;
+static uint32_t spin_plain[2]; /* guarded by spin */
+
+static void spin_entry(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < SPIN_ROUNDS; i++) {
+		eai_osal_atomic_fetch_add(&spin_atomic, 1, EAI_OSAL_ATOMIC_RELAXED);
+
+		eai_osal_spinlock_key_t key = eai_osal_spin_lock(&spin);
+
+		spin_plain[0]++;
+		spin_plain[1] += 2;
+		eai_osal_spin_unlock(&spin, key);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(spin_stacks[SPIN_THREADS], 4096);
+
+static void test_atomic_spinlock_contended(void)
+{
+	eai_osal_thread_t threads[SPIN_THREADS];
+
+	eai_osal_atomic_store(&spin_atomic, 0, EAI_OSAL_ATOMIC_RELAXED);
+	spin_plain[0] = 0;
+	spin_plain[1] = 0;
+
+	for (int i = 0; i < SPIN_THREADS; i++) {
+		eai_osal_thread_create(&threads[i], "spin", spin_entry, NULL,
+				       spin_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(spin_stacks[i]), 5);
+	}
+	for (int i = 0; i < SPIN_THREADS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(SPIN_THREADS * SPIN_ROUNDS,
+			  eai_osal_atomic_load(&spin_atomic, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(SPIN_THREADS * SPIN_ROUNDS, spin_plain[0]);
+	TEST_ASSERT_EQUAL(2 * SPIN_THREADS * SPIN_ROUNDS, spin_plain[1]);
+}
+
+/* Separate spinlocks do not exclude each other */
+static void test_spinlock_independent(void)
+{
+	eai_osal_spinlock_t a;
+	eai_osal_spinlock_t b;
+
+	eai_osal_spinlock_init(&a);
+	eai_osal_spinlock_init(&b);
+
+	eai_osal_spinlock_key_t ka = eai_osal_spin_lock(&a);
+	eai_osal_spinlock_key_t kb = eai_osal_spin_lock(&b);
+
+	eai_osal_spin_unlock(&b, kb);
+	eai_osal_spin_unlock(&a, ka);
+
+	/* Re-acquirable after release */
+	ka = eai_osal_spin_lock(&a);
+	eai_osal_spin_unlock(&a, ka);
+	TEST_PASS();
+}
+
+#if EAI_OSAL_STATS
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Stats tests (4) — only in the EAI_OSAL_STATS build (osal_tests_stats)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static eai_osal_mutex_t stats_mtx;
+
+static void stats_holder_entry(void *arg)
+{
+	eai_osal_sem_t *held = arg;
+
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_give(held);
+	test_sleep_ms(20);
+	eai_osal_mutex_unlock(&stats_mtx);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(stats_stack, 4096);
+
+static void test_stats_mutex_contention(void)
+{
+	eai_osal_thread_t thread;
+	eai_osal_sem_t held;
+	eai_osal_stats_t st;
+
+	eai_osal_mutex_create(&stats_mtx);
+	eai_osal_sem_create(&held, 0, 1);
+	EAI_OSAL_STATS_REGISTER(&stats_mtx, "test.mutex");
+
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&stats_mtx);
+
+	eai_osal_thread_create(&thread, "holder", stats_holder_entry, &held,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack), 5);
+	eai_osal_sem_take(&held, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER));
+	eai_osal_mutex_unlock(&stats_mtx);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_stats_get("test.mutex", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_STATS_MUTEX, st.kind);
+	TEST_ASSERT_EQUAL(3, st.count); /* main twice, holder once */
+	TEST_ASSERT_EQUAL(1, st.contended);
+	TEST_ASSERT_EQUAL(2, st.hist[0]);
+	TEST_ASSERT_GREATER_OR_EQUAL(5000, st.max_us);
+
+	uint32_t total = 0;
+
+	for (int i = 0; i < EAI_OSAL_STATS_HIST_BUCKETS; i++) {
+		total += st.hist[i];
+	}
+	TEST_ASSERT_EQUAL(st.count, total);
+
+	eai_osal_sem_destroy(&held);
+	eai_osal_mutex_destroy(&stats_mtx);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_stats_get("test.mutex", &st));
+}
+
+static void test_stats_queue_high_water(void)
+{
+	eai_osal_queue_t q;
+	uint32_t buf[4];
+	uint32_t msg = 0;
+	uint32_t batch[3] = { 0 };
+	eai_osal_stats_t st;
+
+	eai_osal_queue_create(&q, sizeof(uint32_t), 4, buf);
+	EAI_OSAL_STATS_REGISTER(&q, "test.queue");
+
+	/* A batched fill moves the high-water mark too */
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_send_many(&q, batch, 3,
+						       EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_stats_get("test.queue", &st));
+	TEST_ASSERT_EQUAL(3, st.high_water);
+	TEST_ASSERT_EQUAL(3, eai_osal_queue_recv_many(&q, batch, 3,
+						       EAI_OSAL_NO_WAIT));
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	}
+	eai_osal_queue_recv(&q, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	/* Full: a failed NO_WAIT send is not counted */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_stats_get("test.queue", &st));
+	TEST_ASSERT_EQUAL(5, st.count);
+	TEST_ASSERT_EQUAL(0, st.contended);
+	TEST_ASSERT_EQUAL(4, st.high_water);
+	eai_osal_queue_destroy(&q);
+}
+
+static eai_osal_workqueue_t stats_wq;
+EAI_OSAL_THREAD_STACK_DEFINE(stats_wq_stack, 4096);
+
+static void stats_slow_work(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(5);
+}
+
+static void test_stats_workqueue_exec_time(void)
+{
+	eai_osal_work_t work;
+	eai_osal_stats_t st;
+
+	eai_osal_workqueue_create(&stats_wq, "stats_wq", stats_wq_stack,
+				  EAI_OSAL_THREAD_STACK_SIZEOF(stats_wq_stack), 5);
+	EAI_OSAL_STATS_REGISTER(&stats_wq, "test.wq");
+	eai_osal_work_init(&work, stats_slow_work, NULL);
+
+	eai_osal_work_submit_to(&work, &stats_wq);
+	eai_osal_work_flush(&work);
+	eai_osal_work_submit_to(&work, &stats_wq);
+	eai_osal_work_flush(&work);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_stats_get("test.wq", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_STATS_WORKQUEUE, st.kind);
+	TEST_ASSERT_EQUAL(2, st.count);
+	TEST_ASSERT_GREATER_OR_EQUAL(4000, st.max_us);
+	TEST_ASSERT_EQUAL(1, st.high_water);
+}
+
+static void count_entry(const eai_osal_stats_t *stats, void *arg)
+{
+	uint32_t *named_sem = arg;
+
+	if (strcmp(stats->name, "test.sem") == 0) {
+		(*named_sem)++;
+	}
+}
+
+static void test_stats_registry(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_stats_t st;
+	uint32_t seen = 0;
+	uint32_t before = eai_osal_stats_foreach(count_entry, &seen);
+
+	eai_osal_sem_create(&sem, 1, 1);
+	EAI_OSAL_STATS_REGISTER(&sem, "sem.first");
+	EAI_OSAL_STATS_REGISTER(&sem, "test.sem"); /* rename, not a second entry */
+	eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+
+	TEST_ASSERT_EQUAL(before + 1, eai_osal_stats_foreach(count_entry, &seen));
+	TEST_ASSERT_EQUAL(1, seen);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_stats_get("sem.first", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_stats_get("test.sem", &st));
+	TEST_ASSERT_EQUAL(1, st.count);
+	TEST_ASSERT_EQUAL_STRING("sem", eai_osal_stats_kind_name(st.kind));
+
+	eai_osal_stats_reset();
+	eai_osal_stats_get("test.sem", &st);
+	TEST_ASSERT_EQUAL(0, st.count);
+	TEST_ASSERT_EQUAL(0, st.hist[0]);
+
+	eai_osal_sem_destroy(&sem);
+	TEST_ASSERT_EQUAL(before, eai_osal_stats_foreach(count_entry, &seen));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_stats_get(NULL, &st));
+}
+#endif /* EAI_OSAL_STATS */
+
+#if EAI_OSAL_TRACE
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Trace tests (4) — only in the EAI_OSAL_TRACE build (osal_tests_trace)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static struct {
+	uint8_t buf[256 * 1024];
+	size_t len;
+} trace_sink;
+
+static int trace_sink_write(const void *data, size_t len, void *ctx)
+{
+	(void)ctx;
+	if (trace_sink.len + len > sizeof(trace_sink.buf)) {
+		return -1;
+	}
+	memcpy(trace_sink.buf + trace_sink.len, data, len);
+	trace_sink.len += len;
+	return 0;
+}
+
+/* Stop recording and dump into trace_sink; returns the records */
+static const eai_osal_trace_rec_t *trace_capture(uint32_t *count)
+{
+	eai_osal_trace_hdr_t hdr;
+
+	eai_osal_trace_enable(false);
+	trace_sink.len = 0;
+	*count = eai_osal_trace_dump(trace_sink_write, NULL);
+
+	memcpy(&hdr, trace_sink.buf, sizeof(hdr));
+	TEST_ASSERT_EQUAL_HEX32(EAI_OSAL_TRACE_MAGIC, hdr.magic);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TRACE_VERSION, hdr.version);
+	TEST_ASSERT_EQUAL(sizeof(eai_osal_trace_rec_t), hdr.rec_size);
+	TEST_ASSERT_EQUAL(1000000, hdr.ticks_hz);
+	TEST_ASSERT_EQUAL(*count, hdr.count);
+	TEST_ASSERT_EQUAL(sizeof(hdr) + *count * sizeof(eai_osal_trace_rec_t),
+			  trace_sink.len);
+	return (const eai_osal_trace_rec_t *)(trace_sink.buf + sizeof(hdr));
+}
+
+/* Index of the first record of event on obj, or -1 */
+static int trace_find(const eai_osal_trace_rec_t *recs, uint32_t count,
+		      uint8_t event, const void *obj)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		if (recs[i].event == event &&
+		    recs[i].obj == (uint32_t)(uintptr_t)obj) {
+			return (int)i;
+		}
+	}
+	return -1;
+}
+
+static void test_trace_sem_and_queue(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_queue_t q;
+	uint32_t qbuf[4];
+	uint32_t msgs[3] = { 1, 2, 3 };
+	uint32_t count;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_queue_create(&q, sizeof(uint32_t), 4, qbuf);
+
+	eai_osal_trace_clear();
+	eai_osal_trace_enable(true);
+	eai_osal_sem_give(&sem);
+	eai_osal_sem_take(&sem, EAI_OSAL_WAIT_FOREVER);
+	/* Failed take: not recorded */
+	eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send_many(&q, msgs, 3, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&q, &msgs[0], EAI_OSAL_NO_WAIT);
+
+	const eai_osal_trace_rec_t *recs = trace_capture(&count);
+	int give = trace_find(recs, count, EAI_OSAL_TRACE_SEM_GIVE, &sem);
+	int take = trace_find(recs, count, EAI_OSAL_TRACE_SEM_TAKE, &sem);
+	int send = trace_find(recs, count, EAI_OSAL_TRACE_QUEUE_SEND, &q);
+	int recv = trace_find(recs, count, EAI_OSAL_TRACE_QUEUE_RECV, &q);
+
+	TEST_ASSERT_TRUE(give >= 0 && take >= 0 && send >= 0 && recv >= 0);
+	TEST_ASSERT_TRUE(recs[give].ts <= recs[take].ts);
+	TEST_ASSERT_EQUAL(recs[give].thread, recs[take].thread);
+	TEST_ASSERT_EQUAL(3, recs[send].arg);
+	TEST_ASSERT_EQUAL(1, recs[recv].arg);
+
+	uint32_t takes = 0;
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (recs[i].event == EAI_OSAL_TRACE_SEM_TAKE &&
+		    recs[i].obj == (uint32_t)(uintptr_t)&sem) {
+			takes++;
+		}
+	}
+	TEST_ASSERT_EQUAL(1, takes);
+
+	eai_osal_trace_enable(true);
+	eai_osal_queue_destroy(&q);
+	eai_osal_sem_destroy(&sem);
+}
+
+static void trace_work_cb(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(2);
+}
+
+static void trace_timer_cb(void *arg)
+{
+	eai_osal_sem_give((eai_osal_sem_t *)arg);
+}
+
+static void trace_thread_entry(void *arg)
+{
+	(void)arg;
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(trace_stack, 4096);
+
+static void test_trace_work_timer_thread(void)
+{
+	eai_osal_work_t work;
+	eai_osal_timer_t timer;
+	eai_osal_sem_t fired;
+	eai_osal_thread_t thread;
+	uint32_t count;
+
+	eai_osal_work_init(&work, trace_work_cb, NULL);
+	eai_osal_sem_create(&fired, 0, 1);
+	eai_osal_timer_create(&timer, trace_timer_cb, &fired);
+
+	eai_osal_trace_clear();
+	eai_osal_trace_enable(true);
+	eai_osal_work_submit(&work);
+	eai_osal_work_flush(&work);
+	eai_osal_timer_start(&timer, 1, 0);
+	eai_osal_sem_take(&fired, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_create(&thread, "traced", trace_thread_entry, NULL,
+			       trace_stack, EAI_OSAL_THREAD_STACK_SIZEOF(trace_stack), 5);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	const eai_osal_trace_rec_t *recs = trace_capture(&count);
+	int start = trace_find(recs, count, EAI_OSAL_TRACE_WORK_START, &work);
+	int end = trace_find(recs, count, EAI_OSAL_TRACE_WORK_END, &work);
+	int fire = trace_find(recs, count, EAI_OSAL_TRACE_TIMER_FIRE, &timer);
+	int t_start = trace_find(recs, count, EAI_OSAL_TRACE_THREAD_START,
+				 (const void *)trace_thread_entry);
+	int t_exit = trace_find(recs, count, EAI_OSAL_TRACE_THREAD_EXIT,
+				(const void *)trace_thread_entry);
+
+	TEST_ASSERT_TRUE(start >= 0 && end >= 0 && fire >= 0);
+	TEST_ASSERT_TRUE(t_start >= 0 && t_exit >= 0);
+	TEST_ASSERT_GREATER_OR_EQUAL(recs[start].ts + 1000, recs[end].ts);
+	TEST_ASSERT_EQUAL(recs[start].thread, recs[end].thread);
+	TEST_ASSERT_EQUAL(recs[t_start].thread, recs[t_exit].thread);
+
+	eai_osal_trace_enable(true);
+	eai_osal_timer_destroy(&timer);
+	eai_osal_sem_destroy(&fired);
+}
+
+static void test_trace_ring_overwrites(void)
+{
+	const uint32_t n = 20000;
+	uint32_t count;
+	uint32_t users = 0;
+	bool last_seen = false;
+
+	eai_osal_trace_clear();
+	eai_osal_trace_enable(true);
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_trace_record(EAI_OSAL_TRACE_USER, &users, (uint16_t)i);
+	}
+
+	const eai_osal_trace_rec_t *recs = trace_capture(&count);
+
+	TEST_ASSERT_TRUE(count < n);
+	for (uint32_t i = 0; i < count; i++) {
+		/* Oldest first and gap-free within each CPU's run */
+		if (i > 0 && recs[i].cpu == recs[i - 1].cpu) {
+			TEST_ASSERT_EQUAL(recs[i - 1].seq + 1, recs[i].seq);
+		}
+		if (recs[i].event == EAI_OSAL_TRACE_USER) {
+			users++;
+			last_seen |= recs[i].arg == n - 1;
+		}
+	}
+	TEST_ASSERT_TRUE(users > 0 && users < n);
+	TEST_ASSERT_TRUE(last_seen);
+
+	eai_osal_trace_enable(true);
+}
+
+static void test_trace_enable_and_clear(void)
+{
+	uint32_t count;
+
+	eai_osal_trace_enable(false);
+	eai_osal_trace_clear();
+	eai_osal_trace_record(EAI_OSAL_TRACE_USER, NULL, 1);
+	trace_capture(&count);
+	TEST_ASSERT_EQUAL(0, count);
+
+	eai_osal_trace_enable(true);
+	eai_osal_trace_record(EAI_OSAL_TRACE_USER + 1, NULL, 2);
+
+	const eai_osal_trace_rec_t *recs = trace_capture(&count);
+
+	TEST_ASSERT_TRUE(trace_find(recs, count, EAI_OSAL_TRACE_USER + 1, NULL) >= 0);
+	TEST_ASSERT_EQUAL(-1, trace_find(recs, count, EAI_OSAL_TRACE_USER, NULL));
+	TEST_ASSERT_EQUAL(0, eai_osal_trace_dump(NULL, NULL));
+
+	eai_osal_trace_enable(true);
+}
+#endif /* EAI_OSAL_TRACE */
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Test runner
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -735,39 +2702,52 @@ int main(void)
 	RUN_TEST(test_mutex_contention_timeout);
 	RUN_TEST(test_mutex_null_param);
 
-	/* Semaphore (5) */
+	/* Semaphore (6) */
 	RUN_TEST(test_sem_create_destroy);
 	RUN_TEST(test_sem_binary);
 	RUN_TEST(test_sem_counting);
 	RUN_TEST(test_sem_timeout);
 	RUN_TEST(test_sem_give_at_limit);
+	RUN_TEST(test_sem_handoff);
 
-	/* Thread (4) */
+	/* Thread (6) */
 	RUN_TEST(test_thread_create_join);
 	RUN_TEST(test_thread_sleep);
 	RUN_TEST(test_thread_yield);
 	RUN_TEST(test_thread_priority);
+	RUN_TEST(test_thread_sched_applied);
+	RUN_TEST(test_thread_set_affinity);
 
-	/* Queue (5) */
+	/* Queue (9) */
 	RUN_TEST(test_queue_create_destroy);
 	RUN_TEST(test_queue_send_recv);
 	RUN_TEST(test_queue_full);
 	RUN_TEST(test_queue_fifo_order);
 	RUN_TEST(test_queue_empty_timeout);
+	RUN_TEST(test_queue_reserve_commit);
+	RUN_TEST(test_queue_peek_release);
+	RUN_TEST(test_queue_zero_copy_in_place);
+	RUN_TEST(test_queue_send_recv_many);
 
-	/* Timer (5) */
+	/* Timer (10) */
 	RUN_TEST(test_timer_create_destroy);
 	RUN_TEST(test_timer_one_shot);
 	RUN_TEST(test_timer_periodic);
 	RUN_TEST(test_timer_stop);
 	RUN_TEST(test_timer_is_running);
+	RUN_TEST(test_timer_many_ordered);
+	RUN_TEST(test_timer_restart);
+	RUN_TEST(test_timer_dispatch_workqueue);
+	RUN_TEST(test_timer_periodic_no_drift);
+	RUN_TEST(test_timer_overruns);
 
-	/* Event (5) */
+	/* Event (6) */
 	RUN_TEST(test_event_create_destroy);
 	RUN_TEST(test_event_set_wait_any);
 	RUN_TEST(test_event_wait_all);
 	RUN_TEST(test_event_clear);
 	RUN_TEST(test_event_timeout);
+	RUN_TEST(test_event_wakes_all_waiters);
 
 	/* Critical (2) */
 	RUN_TEST(test_critical_enter_exit);
@@ -778,7 +2758,7 @@ int main(void)
 	RUN_TEST(test_time_monotonic);
 	RUN_TEST(test_time_tick_roundtrip);
 
-	/* Work (9) */
+	/* Work (17) */
 	RUN_TEST(test_work_init);
 	RUN_TEST(test_work_init_null);
 	RUN_TEST(test_work_submit);
@@ -786,8 +2766,69 @@ int main(void)
 	RUN_TEST(test_dwork_init);
 	RUN_TEST(test_dwork_submit);
 	RUN_TEST(test_dwork_cancel);
+	RUN_TEST(test_dwork_reschedule);
 	RUN_TEST(test_custom_workqueue);
 	RUN_TEST(test_dwork_submit_to_queue);
+	RUN_TEST(test_work_resubmit_coalesces);
+	RUN_TEST(test_work_flush_waits);
+	RUN_TEST(test_work_cancel_sync);
+	RUN_TEST(test_workqueue_lanes_priority);
+	RUN_TEST(test_workqueue_lanes_depth_hwm);
+	RUN_TEST(test_workqueue_pool);
+	RUN_TEST(test_workqueue_pool_steal);
+
+	/* SPSC ring (5) */
+	RUN_TEST(test_spsc_init_rejects_non_pow2);
+	RUN_TEST(test_spsc_fifo_full_empty);
+	RUN_TEST(test_spsc_bulk_wraparound);
+	RUN_TEST(test_spsc_peek_release);
+	RUN_TEST(test_spsc_threaded_blocking);
+
+	/* Poll (4) */
+	RUN_TEST(test_poll_invalid_param);
+	RUN_TEST(test_poll_ready_and_timeout);
+	RUN_TEST(test_poll_wakes_on_queue);
+	RUN_TEST(test_poll_wakes_on_event_bits);
+
+	/* Mempool (3) */
+	RUN_TEST(test_mempool_invalid_param);
+	RUN_TEST(test_mempool_exhaust_and_stats);
+	RUN_TEST(test_mempool_threaded_churn);
+
+	/* Arena (3) */
+	RUN_TEST(test_arena_alignment);
+	RUN_TEST(test_arena_mark_release);
+	RUN_TEST(test_arena_exhaustion);
+
+	/* Rwlock (3) */
+	RUN_TEST(test_rwlock_readers_share);
+	RUN_TEST(test_rwlock_writer_preference);
+	RUN_TEST(test_rwlock_unlock_errors);
+
+	/* Seqlock (2) */
+	RUN_TEST(test_seqlock_roundtrip);
+	RUN_TEST(test_seqlock_no_torn_reads);
+
+	/* Atomic / spinlock (3) */
+	RUN_TEST(test_atomic_ops);
+	RUN_TEST(test_atomic_spinlock_contended);
+	RUN_TEST(test_spinlock_independent);
+
+#if EAI_OSAL_STATS
+	/* Stats (4) */
+	RUN_TEST(test_stats_mutex_contention);
+	RUN_TEST(test_stats_queue_high_water);
+	RUN_TEST(test_stats_workqueue_exec_time);
+	RUN_TEST(test_stats_registry);
+#endif
+
+#if EAI_OSAL_TRACE
+	/* Trace (4) */
+	RUN_TEST(test_trace_sem_and_queue);
+	RUN_TEST(test_trace_work_timer_thread);
+	RUN_TEST(test_trace_ring_overwrites);
+	RUN_TEST(test_trace_enable_and_clear);
+#endif
 
 	return UNITY_END();
 }
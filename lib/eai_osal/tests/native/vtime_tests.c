@@ -0,0 +1,305 @@
+/*
+ * OSAL POSIX backend on virtual time (EAI_OSAL_POSIX_VTIME=1).
+ *
+ * 7 tests: sleeps, timeouts, timers, delayed work and thread ordering
+ * land on exact virtual instants, and minutes of virtual time pass in
+ * well under a second of real time.
+ */
+
+#include "unity.h"
+#include <eai_osal/eai_osal.h>
+#include <time.h>
+
+/* Unity requires setUp/tearDown */
+void setUp(void) {}
+void tearDown(void) {}
+
+/* Helper: real CLOCK_MONOTONIC milliseconds, to show time was skipped */
+static uint64_t real_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + (uint64_t)(ts.tv_nsec / 1000000);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(vt_stack_a, 2048);
+EAI_OSAL_THREAD_STACK_DEFINE(vt_stack_b, 2048);
+EAI_OSAL_THREAD_STACK_DEFINE(vt_stack_c, 2048);
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Virtual time tests (7)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_vt_sleep(void)
+{
+	uint64_t real = real_ms();
+	uint64_t t0 = eai_osal_time_get_ticks();
+
+	eai_osal_thread_sleep(60000);
+	TEST_ASSERT_EQUAL_UINT64(60000000, eai_osal_time_get_ticks() - t0);
+
+	eai_osal_thread_sleep(0);
+	TEST_ASSERT_EQUAL_UINT64(60000000, eai_osal_time_get_ticks() - t0);
+	TEST_ASSERT_LESS_THAN_UINT64(1000, real_ms() - real);
+}
+
+static eai_osal_mutex_t vt_mtx;
+
+static void mutex_holder_entry(void *arg)
+{
+	(void)arg;
+	eai_osal_mutex_lock(&vt_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_sleep(500);
+	eai_osal_mutex_unlock(&vt_mtx);
+}
+
+static void test_vt_timeouts(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_queue_t queue;
+	eai_osal_event_t event;
+	uint8_t qbuf[4 * sizeof(uint32_t)];
+	uint32_t msg;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_queue_create(&queue, sizeof(uint32_t), 4, qbuf);
+	eai_osal_event_create(&event);
+
+	uint32_t t0 = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&sem, 250));
+	TEST_ASSERT_EQUAL_UINT32(250, eai_osal_time_get_ms() - t0);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_queue_recv(&queue, &msg, 100));
+	TEST_ASSERT_EQUAL_UINT32(350, eai_osal_time_get_ms() - t0);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_event_wait(&event, 0x1, false, NULL, 40));
+	TEST_ASSERT_EQUAL_UINT32(390, eai_osal_time_get_ms() - t0);
+
+	/* Holder keeps the mutex for 500 ms of virtual time */
+	eai_osal_thread_t thread;
+
+	eai_osal_mutex_create(&vt_mtx);
+	eai_osal_thread_create(&thread, "holder", mutex_holder_entry, NULL,
+			       vt_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(vt_stack_a), 5);
+	eai_osal_thread_sleep(10);
+	t0 = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_mutex_lock(&vt_mtx, 50));
+	TEST_ASSERT_EQUAL_UINT32(50, eai_osal_time_get_ms() - t0);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mutex_lock(&vt_mtx, EAI_OSAL_WAIT_FOREVER));
+	TEST_ASSERT_EQUAL_UINT32(490, eai_osal_time_get_ms() - t0);
+	eai_osal_mutex_unlock(&vt_mtx);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_thread_join(&thread, 1000));
+
+	eai_osal_mutex_destroy(&vt_mtx);
+	eai_osal_event_destroy(&event);
+	eai_osal_queue_destroy(&queue);
+	eai_osal_sem_destroy(&sem);
+}
+
+static volatile uint32_t vt_ticks;
+
+static void count_timer_cb(void *arg)
+{
+	(void)arg;
+	vt_ticks++;
+}
+
+static void test_vt_timer_periodic(void)
+{
+	eai_osal_timer_t timer;
+	uint64_t real = real_ms();
+
+	vt_ticks = 0;
+	eai_osal_timer_create(&timer, count_timer_cb, NULL);
+	eai_osal_timer_start(&timer, 10, 10);
+
+	/* 10 s of 10 ms periods; wake between expiries */
+	eai_osal_thread_sleep(10005);
+	TEST_ASSERT_EQUAL_UINT32(1000, vt_ticks);
+	TEST_ASSERT_EQUAL_UINT32(0, eai_osal_timer_get_overruns(&timer));
+
+	eai_osal_timer_stop(&timer);
+	eai_osal_timer_destroy(&timer);
+	TEST_ASSERT_LESS_THAN_UINT64(5000, real_ms() - real);
+}
+
+/* First callback overruns by a full period; log every firing instant */
+static uint32_t vt_fires[8];
+static volatile uint32_t vt_nfires;
+
+static void slow_once_cb(void *arg)
+{
+	(void)arg;
+	if (vt_nfires < 8) {
+		vt_fires[vt_nfires] = eai_osal_time_get_ms();
+	}
+	if (vt_nfires++ == 0) {
+		eai_osal_thread_sleep(20);
+	}
+}
+
+static void test_vt_timer_due_now(void)
+{
+	eai_osal_timer_t timer;
+
+	vt_nfires = 0;
+	eai_osal_timer_create(&timer, slow_once_cb, NULL);
+
+	uint32_t t0 = eai_osal_time_get_ms();
+
+	eai_osal_timer_start(&timer, 10, 10);
+
+	/*
+	 * Fires at 10 and returns at 30. The 20 slot runs late at 30; the
+	 * 30 slot is due exactly then, so it fires too instead of counting
+	 * as an overrun.
+	 */
+	eai_osal_thread_sleep(45);
+	eai_osal_timer_stop(&timer);
+
+	TEST_ASSERT_EQUAL_UINT32(4, vt_nfires);
+	TEST_ASSERT_EQUAL_UINT32(10, vt_fires[0] - t0);
+	TEST_ASSERT_EQUAL_UINT32(30, vt_fires[1] - t0);
+	TEST_ASSERT_EQUAL_UINT32(30, vt_fires[2] - t0);
+	TEST_ASSERT_EQUAL_UINT32(40, vt_fires[3] - t0);
+	TEST_ASSERT_EQUAL_UINT32(0, eai_osal_timer_get_overruns(&timer));
+
+	eai_osal_timer_destroy(&timer);
+}
+
+static eai_osal_sem_t vt_done;
+static uint32_t vt_fired_at;
+
+static void dwork_cb(void *arg)
+{
+	(void)arg;
+	vt_fired_at = eai_osal_time_get_ms();
+	eai_osal_sem_give(&vt_done);
+}
+
+static void test_vt_dwork(void)
+{
+	eai_osal_dwork_t dwork;
+
+	eai_osal_sem_create(&vt_done, 0, 1);
+	eai_osal_dwork_init(&dwork, dwork_cb, NULL);
+
+	uint32_t t0 = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_submit(&dwork, 5000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_sem_take(&vt_done, EAI_OSAL_WAIT_FOREVER));
+	TEST_ASSERT_EQUAL_UINT32(5000, vt_fired_at - t0);
+	TEST_ASSERT_EQUAL_UINT32(5000, eai_osal_time_get_ms() - t0);
+
+	eai_osal_sem_destroy(&vt_done);
+}
+
+/* Each thread sleeps its own delay, then logs it */
+static eai_osal_mutex_t vt_log_lock;
+static uint32_t vt_log[3];
+static uint32_t vt_log_len;
+
+static void sleeper_entry(void *arg)
+{
+	uint32_t delay = (uint32_t)(uintptr_t)arg;
+
+	eai_osal_thread_sleep(delay);
+	eai_osal_mutex_lock(&vt_log_lock, EAI_OSAL_WAIT_FOREVER);
+	vt_log[vt_log_len++] = delay;
+	eai_osal_mutex_unlock(&vt_log_lock);
+}
+
+static void test_vt_ordering(void)
+{
+	eai_osal_mutex_create(&vt_log_lock);
+
+	for (int run = 0; run < 20; run++) {
+		eai_osal_thread_t a, b, c;
+
+		vt_log_len = 0;
+		eai_osal_thread_create(&a, "s30", sleeper_entry,
+				       (void *)(uintptr_t)30, vt_stack_a,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(vt_stack_a), 5);
+		eai_osal_thread_create(&b, "s10", sleeper_entry,
+				       (void *)(uintptr_t)10, vt_stack_b,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(vt_stack_b), 5);
+		eai_osal_thread_create(&c, "s20", sleeper_entry,
+				       (void *)(uintptr_t)20, vt_stack_c,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(vt_stack_c), 5);
+		eai_osal_thread_join(&a, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_thread_join(&b, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_thread_join(&c, EAI_OSAL_WAIT_FOREVER);
+
+		TEST_ASSERT_EQUAL_UINT32(3, vt_log_len);
+		TEST_ASSERT_EQUAL_UINT32(10, vt_log[0]);
+		TEST_ASSERT_EQUAL_UINT32(20, vt_log[1]);
+		TEST_ASSERT_EQUAL_UINT32(30, vt_log[2]);
+	}
+
+	eai_osal_mutex_destroy(&vt_log_lock);
+}
+
+/* Producer paces itself with sleeps; the consumer blocks without a deadline */
+static eai_osal_queue_t vt_queue;
+
+static void producer_entry(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 1; i <= 10; i++) {
+		eai_osal_thread_sleep(100);
+		uint32_t now = eai_osal_time_get_ms();
+
+		eai_osal_queue_send(&vt_queue, &now, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void test_vt_producer_consumer(void)
+{
+	uint8_t qbuf[2 * sizeof(uint32_t)];
+	eai_osal_thread_t thread;
+
+	eai_osal_queue_create(&vt_queue, sizeof(uint32_t), 2, qbuf);
+
+	uint32_t t0 = eai_osal_time_get_ms();
+
+	eai_osal_thread_create(&thread, "producer", producer_entry, NULL,
+			       vt_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(vt_stack_a), 5);
+
+	for (uint32_t i = 1; i <= 10; i++) {
+		uint32_t sent;
+
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_queue_recv(&vt_queue, &sent,
+						      EAI_OSAL_WAIT_FOREVER));
+		TEST_ASSERT_EQUAL_UINT32(i * 100, sent - t0);
+		TEST_ASSERT_EQUAL_UINT32(i * 100, eai_osal_time_get_ms() - t0);
+	}
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_thread_join(&thread, 1000));
+	eai_osal_queue_destroy(&vt_queue);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Test runner
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/* Virtual time (7) */
+	RUN_TEST(test_vt_sleep);
+	RUN_TEST(test_vt_timeouts);
+	RUN_TEST(test_vt_timer_periodic);
+	RUN_TEST(test_vt_timer_due_now);
+	RUN_TEST(test_vt_dwork);
+	RUN_TEST(test_vt_ordering);
+	RUN_TEST(test_vt_producer_consumer);
+
+	return UNITY_END();
+}
@@ -1,6 +1,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
 #include <eai_osal/eai_osal.h>
+#include <string.h>
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * Mutex tests
@@ -208,6 +209,19 @@ ZTEST(osal_thread, test_yield)
 	eai_osal_thread_yield();
 }
 
+ZTEST(osal_thread, test_set_affinity)
+{
+	zassert_equal(eai_osal_thread_set_affinity(NULL, 0),
+		      EAI_OSAL_INVALID_PARAM);
+#if defined(CONFIG_SCHED_CPU_MASK)
+	/* A running thread cannot change its own mask */
+	zassert_equal(eai_osal_thread_set_affinity(NULL, BIT(0)),
+		      EAI_OSAL_ERROR);
+#else
+	zassert_equal(eai_osal_thread_set_affinity(NULL, BIT(0)), EAI_OSAL_OK);
+#endif
+}
+
 static volatile int prio_order[2];
 static volatile int prio_idx;
 
@@ -331,6 +345,46 @@ ZTEST(osal_queue, test_empty_timeout)
 	eai_osal_queue_destroy(&queue);
 }
 
+ZTEST(osal_queue, test_reserve_commit_peek_release)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+	void *msg;
+
+	eai_osal_queue_create(&queue, sizeof(int), 2, queue_buf_2);
+
+	zassert_equal(eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_ERROR, "Only one reservation at a time");
+	*(int *)slot = 77;
+	zassert_equal(eai_osal_queue_commit(&queue), EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_queue_peek(&queue, &msg, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(*(int *)msg, 77);
+	zassert_equal(eai_osal_queue_release(&queue), EAI_OSAL_OK);
+	zassert_equal(eai_osal_queue_release(&queue), EAI_OSAL_ERROR);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+ZTEST(osal_queue, test_send_recv_many)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[6] = {0};
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	zassert_equal(eai_osal_queue_send_many(&queue, in, 6, EAI_OSAL_NO_WAIT), 4,
+		      "Only 4 fit");
+	zassert_equal(eai_osal_queue_recv_many(&queue, out, 6, EAI_OSAL_NO_WAIT), 4);
+	zassert_mem_equal(in, out, 4 * sizeof(int));
+	zassert_equal(eai_osal_queue_recv_many(&queue, out, 6, EAI_OSAL_NO_WAIT), 0);
+
+	eai_osal_queue_destroy(&queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Timer tests
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -431,6 +485,46 @@ ZTEST(osal_timer, test_is_running)
 	eai_osal_timer_destroy(&timer);
 }
 
+ZTEST(osal_timer, test_dispatch_workqueue)
+{
+	eai_osal_timer_t timer;
+
+	timer_count = 0;
+	k_sem_init(&timer_sem, 0, 1);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	zassert_equal(eai_osal_timer_set_dispatch(&timer,
+						  EAI_OSAL_TIMER_DISPATCH_WORKQUEUE,
+						  NULL),
+		      EAI_OSAL_OK);
+	eai_osal_timer_start(&timer, 20, 0);
+
+	zassert_equal(k_sem_take(&timer_sem, K_MSEC(200)), 0,
+		      "Deferred timer callback did not run");
+	zassert_equal(timer_count, 1);
+
+	eai_osal_timer_destroy(&timer);
+}
+
+ZTEST(osal_timer, test_overruns)
+{
+	eai_osal_timer_t timer;
+
+	timer_count = 0;
+	k_sem_init(&timer_sem, 0, 10);
+
+	eai_osal_timer_create(&timer, timer_callback, NULL);
+	zassert_equal(eai_osal_timer_get_overruns(NULL), 0);
+
+	/* Prompt inline callbacks never overrun */
+	eai_osal_timer_start(&timer, 10, 10);
+	k_msleep(55);
+	eai_osal_timer_stop(&timer);
+	zassert_equal(eai_osal_timer_get_overruns(&timer), 0);
+
+	eai_osal_timer_destroy(&timer);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Event tests
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -745,3 +839,640 @@ ZTEST(osal_work, test_dwork_submit_to_queue)
 	k_sem_take(&work_sem, K_MSEC(500));
 	zassert_equal(work_counter, 1, "Delayed work on custom queue should execute");
 }
+
+static struct k_sem gate_sem;
+
+static void gate_callback(void *arg)
+{
+	(void)arg;
+	k_sem_take(&gate_sem, K_FOREVER);
+}
+
+ZTEST(osal_work, test_work_resubmit_and_cancel_sync)
+{
+	static eai_osal_work_t gate;
+	static eai_osal_work_t work;
+
+	work_counter = 0;
+	k_sem_init(&work_sem, 0, 8);
+	k_sem_init(&gate_sem, 0, 1);
+
+	ensure_test_wq();
+
+	eai_osal_work_init(&gate, gate_callback, NULL);
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&gate, &test_wq);
+
+	for (int i = 0; i < 10; i++) {
+		zassert_equal(eai_osal_work_submit_to(&work, &test_wq), EAI_OSAL_OK);
+	}
+	zassert_true(eai_osal_work_is_pending(&work));
+	zassert_equal(eai_osal_work_cancel_sync(&work), EAI_OSAL_OK);
+	zassert_false(eai_osal_work_is_pending(&work));
+
+	zassert_equal(eai_osal_work_submit_to(&work, &test_wq), EAI_OSAL_OK);
+	k_sem_give(&gate_sem);
+	zassert_equal(eai_osal_work_flush(&work), EAI_OSAL_OK);
+	zassert_equal(work_counter, 1, "Resubmits must coalesce into one run");
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(lanes_wq_stack, 1024);
+EAI_OSAL_WQ_BUF_DEFINE(lanes_buf, 2, 4);
+static eai_osal_workqueue_t lanes_wq;
+
+ZTEST(osal_work, test_workqueue_lanes)
+{
+	static eai_osal_work_t work;
+
+	work_counter = 0;
+	k_sem_init(&work_sem, 0, 1);
+
+	zassert_equal(eai_osal_workqueue_create_lanes(&lanes_wq, "lanes_wq",
+						      lanes_wq_stack,
+						      EAI_OSAL_THREAD_STACK_SIZEOF(lanes_wq_stack),
+						      10, lanes_buf, 4, 0),
+		      EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_workqueue_create_lanes(&lanes_wq, "lanes_wq",
+						      lanes_wq_stack,
+						      EAI_OSAL_THREAD_STACK_SIZEOF(lanes_wq_stack),
+						      10, lanes_buf, 4, 2),
+		      EAI_OSAL_OK);
+
+	/* Lanes are accepted on Zephyr; k_work_q keeps a single FIFO */
+	eai_osal_work_init(&work, work_callback, NULL);
+	zassert_equal(eai_osal_work_set_lane(&work, 1), EAI_OSAL_OK);
+	zassert_equal(eai_osal_work_set_lane(&work, EAI_OSAL_WQ_MAX_LANES),
+		      EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_work_submit_to(&work, &lanes_wq), EAI_OSAL_OK);
+
+	k_sem_take(&work_sem, K_MSEC(500));
+	zassert_equal(work_counter, 1, "Work on a lanes queue should execute");
+	zassert_equal(eai_osal_workqueue_high_water(&lanes_wq, 0), 0);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC ring tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_spsc, NULL, NULL, NULL, NULL, NULL);
+
+static uint32_t spsc_buf[8];
+
+ZTEST(osal_spsc, test_init_rejects_non_pow2)
+{
+	eai_osal_spsc_ring_t ring;
+
+	zassert_equal(eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t),
+					      6, false),
+		      EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t),
+					      8, false),
+		      EAI_OSAL_OK);
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+ZTEST(osal_spsc, test_bulk_wraparound)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[5];
+	uint32_t out[8];
+	uint32_t seq = 0;
+	uint32_t expect = 0;
+
+	eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t), 8, false);
+
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 5; i++) {
+			in[i] = seq++;
+		}
+		zassert_equal(eai_osal_spsc_ring_push_n(&ring, in, 5), 5);
+		zassert_equal(eai_osal_spsc_ring_pop_n(&ring, out, 8), 5);
+		for (int i = 0; i < 5; i++) {
+			zassert_equal(out[i], expect++);
+		}
+	}
+
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+ZTEST(osal_spsc, test_peek_release)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[6] = { 10, 11, 12, 13, 14, 15 };
+	uint32_t out[5];
+	const void *p;
+
+	eai_osal_spsc_ring_init(&ring, spsc_buf, sizeof(uint32_t), 8, false);
+	zassert_equal(eai_osal_spsc_ring_peek(&ring, &p, 8), 0);
+
+	/* Indices at 5: the next 6 elements straddle the wrap */
+	zassert_equal(eai_osal_spsc_ring_push_n(&ring, in, 5), 5);
+	zassert_equal(eai_osal_spsc_ring_pop_n(&ring, out, 5), 5);
+	zassert_equal(eai_osal_spsc_ring_push_n(&ring, in, 6), 6);
+
+	zassert_equal(eai_osal_spsc_ring_peek(&ring, &p, 8), 3);
+	zassert_equal_ptr(p, &spsc_buf[5]);
+	zassert_mem_equal(p, in, 3 * sizeof(uint32_t));
+	eai_osal_spsc_ring_release(&ring, 3);
+	zassert_equal(eai_osal_spsc_ring_peek(&ring, &p, 8), 3);
+	zassert_equal_ptr(p, &spsc_buf[0]);
+	zassert_mem_equal(p, &in[3], 3 * sizeof(uint32_t));
+	eai_osal_spsc_ring_release(&ring, 3);
+	zassert_equal(eai_osal_spsc_ring_count(&ring), 0);
+
+	eai_osal_spsc_ring_destroy(&ring);
+}
+
+static eai_osal_wq_worker_t pool_workers[2];
+static eai_osal_workqueue_t test_pool;
+static atomic_t pool_counter;
+
+static void pool_item(void *arg)
+{
+	ARG_UNUSED(arg);
+	k_msleep(20);
+	atomic_inc(&pool_counter);
+	k_sem_give(&work_sem);
+}
+
+ZTEST(osal_work, test_workqueue_pool)
+{
+	eai_osal_work_t works[4];
+
+	atomic_clear(&pool_counter);
+	k_sem_init(&work_sem, 0, ARRAY_SIZE(works));
+
+	zassert_equal(eai_osal_workqueue_pool_create(&test_pool, "pool", pool_workers,
+						     ARRAY_SIZE(pool_workers), 10, NULL),
+		      EAI_OSAL_OK);
+
+	for (int i = 0; i < ARRAY_SIZE(works); i++) {
+		eai_osal_work_init(&works[i], pool_item, NULL);
+		zassert_equal(eai_osal_work_submit_to(&works[i], &test_pool), EAI_OSAL_OK);
+	}
+	for (int i = 0; i < ARRAY_SIZE(works); i++) {
+		zassert_equal(k_sem_take(&work_sem, K_MSEC(500)), 0);
+	}
+	zassert_equal(atomic_get(&pool_counter), ARRAY_SIZE(works),
+		      "Every pool item should run");
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_poll, NULL, NULL, NULL, NULL, NULL);
+
+static eai_osal_queue_t poll_queues[2];
+static uint32_t poll_bufs[2][4];
+static eai_osal_event_t poll_event;
+
+ZTEST(osal_poll, test_ready_and_timeout)
+{
+	eai_osal_sem_t sem;
+
+	eai_osal_queue_create(&poll_queues[0], sizeof(uint32_t), 4, poll_bufs[0]);
+	eai_osal_sem_create(&sem, 0, 1);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_QUEUE(&poll_queues[0]),
+		EAI_OSAL_POLL_SEM(&sem),
+	};
+
+	zassert_equal(eai_osal_poll(ev, 2, 20), EAI_OSAL_TIMEOUT);
+
+	eai_osal_sem_give(&sem);
+	zassert_equal(eai_osal_poll(ev, 2, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_false(ev[0].ready);
+	zassert_true(ev[1].ready);
+	/* Poll does not consume */
+	zassert_equal(eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+
+	eai_osal_queue_destroy(&poll_queues[0]);
+}
+
+static void poll_post_expiry(struct k_timer *t)
+{
+	static uint32_t v = 7;
+
+	ARG_UNUSED(t);
+	eai_osal_event_set(&poll_event, 0x01); /* outside the mask */
+	eai_osal_queue_send(&poll_queues[1], &v, EAI_OSAL_NO_WAIT);
+}
+
+static K_TIMER_DEFINE(poll_post_timer, poll_post_expiry, NULL);
+
+ZTEST(osal_poll, test_wakes_on_queue)
+{
+	uint32_t v = 0;
+
+	eai_osal_queue_create(&poll_queues[0], sizeof(uint32_t), 4, poll_bufs[0]);
+	eai_osal_queue_create(&poll_queues[1], sizeof(uint32_t), 4, poll_bufs[1]);
+	eai_osal_event_create(&poll_event);
+
+	eai_osal_poll_event_t ev[] = {
+		EAI_OSAL_POLL_QUEUE(&poll_queues[0]),
+		EAI_OSAL_POLL_QUEUE(&poll_queues[1]),
+		EAI_OSAL_POLL_EVENT(&poll_event, 0x30),
+	};
+
+	k_timer_start(&poll_post_timer, K_MSEC(20), K_NO_WAIT);
+
+	zassert_equal(eai_osal_poll(ev, ARRAY_SIZE(ev), 500), EAI_OSAL_OK);
+	zassert_false(ev[0].ready);
+	zassert_true(ev[1].ready);
+	zassert_false(ev[2].ready, "Bits outside the mask must not match");
+	zassert_equal(eai_osal_queue_recv(&poll_queues[1], &v, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(v, 7);
+
+	eai_osal_event_destroy(&poll_event);
+	eai_osal_queue_destroy(&poll_queues[1]);
+	eai_osal_queue_destroy(&poll_queues[0]);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_mempool, NULL, NULL, NULL, NULL, NULL);
+
+#define POOL_BLOCK  EAI_OSAL_MEMPOOL_BLOCK_SIZE(24)
+#define POOL_BLOCKS 4
+
+static uint8_t pool_buf[POOL_BLOCK * POOL_BLOCKS] __aligned(sizeof(void *));
+
+ZTEST(osal_mempool, test_exhaust_and_stats)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *blk[POOL_BLOCKS];
+	void *extra;
+
+	zassert_equal(eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK,
+					      POOL_BLOCKS),
+		      EAI_OSAL_OK);
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		zassert_equal(eai_osal_mempool_alloc(&pool, &blk[i]), EAI_OSAL_OK);
+	}
+	zassert_equal(eai_osal_mempool_alloc(&pool, &extra), EAI_OSAL_NO_MEMORY);
+
+	eai_osal_mempool_get_stats(&pool, &st);
+	zassert_equal(st.num_blocks, POOL_BLOCKS);
+	zassert_equal(st.in_use, POOL_BLOCKS);
+	zassert_equal(st.peak, POOL_BLOCKS);
+	zassert_equal(st.failed, 1);
+
+	for (int i = 0; i < POOL_BLOCKS; i++) {
+		zassert_equal(eai_osal_mempool_free(&pool, blk[i]), EAI_OSAL_OK);
+	}
+	eai_osal_mempool_get_stats(&pool, &st);
+	zassert_equal(st.in_use, 0);
+	zassert_equal(st.peak, POOL_BLOCKS);
+	eai_osal_mempool_destroy(&pool);
+}
+
+ZTEST(osal_mempool, test_rejects_foreign_pointer)
+{
+	eai_osal_mempool_t pool;
+	void *blk;
+
+	zassert_equal(eai_osal_mempool_create(&pool, pool_buf, 25, POOL_BLOCKS),
+		      EAI_OSAL_INVALID_PARAM);
+	eai_osal_mempool_create(&pool, pool_buf, POOL_BLOCK, POOL_BLOCKS);
+	eai_osal_mempool_alloc(&pool, &blk);
+	zassert_equal(eai_osal_mempool_free(&pool, (uint8_t *)blk + 4),
+		      EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_mempool_free(&pool, &pool), EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_mempool_free(&pool, blk), EAI_OSAL_OK);
+	eai_osal_mempool_destroy(&pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Arena tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_arena, NULL, NULL, NULL, NULL, NULL);
+
+static uint8_t arena_buf[128] __aligned(16);
+
+ZTEST(osal_arena, test_mark_release)
+{
+	eai_osal_arena_t arena;
+	eai_osal_arena_stats_t st;
+	void *a;
+	void *b;
+
+	zassert_equal(eai_osal_arena_init(&arena, arena_buf, sizeof(arena_buf)),
+		      EAI_OSAL_OK);
+	zassert_equal(eai_osal_arena_alloc(&arena, 10, 0, &a), EAI_OSAL_OK);
+
+	eai_osal_arena_mark_t m = eai_osal_arena_mark(&arena);
+
+	zassert_equal(eai_osal_arena_alloc(&arena, 20, 16, &b), EAI_OSAL_OK);
+	zassert_equal((uintptr_t)b % 16, 0);
+	zassert_equal(eai_osal_arena_alloc(&arena, 200, 0, &b),
+		      EAI_OSAL_NO_MEMORY);
+	zassert_equal(eai_osal_arena_release(&arena, m), EAI_OSAL_OK);
+
+	eai_osal_arena_get_stats(&arena, &st);
+	zassert_equal(st.used, 10);
+	zassert_equal(st.high_water, 36);
+	zassert_equal(st.failed, 1);
+}
+
+ZTEST(osal_arena, test_poison)
+{
+	eai_osal_arena_t arena;
+	uint8_t *p;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_EAI_OSAL_ARENA_POISON);
+
+	eai_osal_arena_init(&arena, arena_buf, sizeof(arena_buf));
+	eai_osal_arena_alloc(&arena, 16, 0, (void **)&p);
+	zassert_equal(p[0], EAI_OSAL_ARENA_POISON_ALLOC);
+	zassert_equal(p[15], EAI_OSAL_ARENA_POISON_ALLOC);
+	eai_osal_arena_reset(&arena);
+	zassert_equal(p[0], EAI_OSAL_ARENA_POISON_FREE);
+	zassert_equal(p[15], EAI_OSAL_ARENA_POISON_FREE);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Rwlock tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_rwlock, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_rwlock, test_shared_and_exclusive)
+{
+	eai_osal_rwlock_t rw;
+
+	zassert_equal(eai_osal_rwlock_create(&rw), EAI_OSAL_OK);
+
+	/* Readers share; a writer waits for the last one */
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_write_lock(&rw, 10), EAI_OSAL_TIMEOUT);
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_ERROR);
+
+	/* A writer excludes readers */
+	zassert_equal(eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, 10), EAI_OSAL_TIMEOUT);
+	zassert_equal(eai_osal_rwlock_write_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_write_unlock(&rw), EAI_OSAL_ERROR);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	eai_osal_rwlock_read_unlock(&rw);
+
+	eai_osal_rwlock_destroy(&rw);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Seqlock tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_seqlock, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_seqlock, test_roundtrip)
+{
+	eai_osal_seqlock_t sl;
+	int32_t shared[3];
+	int32_t in[3] = { 1, -2, 3 };
+	int32_t out[3];
+
+	eai_osal_seqlock_init(&sl);
+	eai_osal_seqlock_write(&sl, shared, in, sizeof(in));
+	zassert_equal(eai_osal_seqlock_read(&sl, out, shared, sizeof(out)), 0);
+	zassert_mem_equal(out, in, sizeof(in));
+
+	uint32_t seq = eai_osal_seqlock_read_begin(&sl);
+
+	eai_osal_seqlock_write_begin(&sl);
+	eai_osal_seqlock_write_end(&sl);
+	zassert_true(eai_osal_seqlock_read_retry(&sl, seq));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic / spinlock tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_atomic, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_atomic, test_ops)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+	eai_osal_atomic_val_t expected = 4;
+
+	zassert_equal(eai_osal_atomic_fetch_add(&a, 3, EAI_OSAL_ATOMIC_RELAXED), 5);
+	zassert_equal(eai_osal_atomic_fetch_sub(&a, 2, EAI_OSAL_ATOMIC_ACQ_REL), 8);
+	zassert_false(eai_osal_atomic_cas(&a, &expected, 9, EAI_OSAL_ATOMIC_SEQ_CST));
+	zassert_equal(expected, 6, "Failed CAS must report the current value");
+	zassert_true(eai_osal_atomic_cas(&a, &expected, 0x0F, EAI_OSAL_ATOMIC_SEQ_CST));
+	zassert_equal(eai_osal_atomic_fetch_and(&a, 0x3C, EAI_OSAL_ATOMIC_SEQ_CST), 0x0F);
+	zassert_equal(eai_osal_atomic_fetch_or(&a, 0x01, EAI_OSAL_ATOMIC_SEQ_CST), 0x0C);
+	eai_osal_atomic_store(&a, -1, EAI_OSAL_ATOMIC_RELEASE);
+	zassert_equal(eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE), -1);
+}
+
+static eai_osal_spinlock_t isr_spin;
+static uint32_t isr_spin_count;
+
+static void isr_spin_expiry(struct k_timer *t)
+{
+	eai_osal_spinlock_key_t key = eai_osal_spin_lock(&isr_spin);
+
+	isr_spin_count++;
+	eai_osal_spin_unlock(&isr_spin, key);
+}
+
+static K_TIMER_DEFINE(isr_spin_timer, isr_spin_expiry, NULL);
+
+ZTEST(osal_atomic, test_spinlock_shared_with_isr)
+{
+	uint32_t seen = 0;
+
+	eai_osal_spinlock_init(&isr_spin);
+	isr_spin_count = 0;
+	k_timer_start(&isr_spin_timer, K_MSEC(1), K_MSEC(1));
+
+	for (int i = 0; i < 2000 && seen < 5; i++) {
+		eai_osal_spinlock_key_t key = eai_osal_spin_lock(&isr_spin);
+
+		seen = isr_spin_count;
+		eai_osal_spin_unlock(&isr_spin, key);
+		k_busy_wait(100);
+	}
+	k_timer_stop(&isr_spin_timer);
+	zassert_true(seen >= 5, "Timer ISR never got the lock");
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Stats tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_stats, NULL, NULL, NULL, NULL, NULL);
+
+static eai_osal_mutex_t stats_mtx;
+static K_SEM_DEFINE(stats_held, 0, 1);
+
+static void stats_holder_entry(void *arg)
+{
+	ARG_UNUSED(arg);
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	k_sem_give(&stats_held);
+	k_msleep(20);
+	eai_osal_mutex_unlock(&stats_mtx);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(stats_stack, 1024);
+
+ZTEST(osal_stats, test_mutex_contention)
+{
+	eai_osal_thread_t thread;
+	eai_osal_stats_t st;
+
+	eai_osal_mutex_create(&stats_mtx);
+	EAI_OSAL_STATS_REGISTER(&stats_mtx, "ztest.mutex");
+
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&stats_mtx);
+
+	eai_osal_thread_create(&thread, "holder", stats_holder_entry, NULL,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack),
+			       20);
+	k_sem_take(&stats_held, K_FOREVER);
+	zassert_equal(eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER),
+		      EAI_OSAL_OK);
+	eai_osal_mutex_unlock(&stats_mtx);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	zassert_equal(eai_osal_stats_get("ztest.mutex", &st), EAI_OSAL_OK);
+	zassert_equal(st.count, 3);
+	zassert_equal(st.contended, 1);
+	zassert_true(st.max_us >= 5000, "max_us %u", st.max_us);
+
+	eai_osal_mutex_destroy(&stats_mtx);
+	zassert_equal(eai_osal_stats_get("ztest.mutex", &st), EAI_OSAL_ERROR);
+}
+
+ZTEST(osal_stats, test_queue_high_water)
+{
+	eai_osal_queue_t q;
+	uint32_t __aligned(4) buf[4];
+	uint32_t msg = 0;
+	eai_osal_stats_t st;
+
+	eai_osal_queue_create(&q, sizeof(uint32_t), 4, buf);
+	EAI_OSAL_STATS_REGISTER(&q, "ztest.queue");
+	for (int i = 0; i < 3; i++) {
+		eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	}
+
+	zassert_equal(eai_osal_stats_get("ztest.queue", &st), EAI_OSAL_OK);
+	zassert_equal(st.count, 3);
+	zassert_equal(st.high_water, 3);
+	eai_osal_queue_destroy(&q);
+}
+
+static void stats_slow_work(void *arg)
+{
+	ARG_UNUSED(arg);
+	k_busy_wait(2000);
+}
+
+ZTEST(osal_stats, test_sysworkq_exec_time)
+{
+	eai_osal_work_t work;
+	eai_osal_stats_t before;
+	eai_osal_stats_t after;
+
+	zassert_equal(eai_osal_stats_get("sysworkq", &before), EAI_OSAL_OK);
+	eai_osal_work_init(&work, stats_slow_work, NULL);
+	eai_osal_work_submit(&work);
+	eai_osal_work_flush(&work);
+	eai_osal_stats_get("sysworkq", &after);
+
+	zassert_equal(after.count, before.count + 1);
+	zassert_true(after.max_us >= 1500, "max_us %u", after.max_us);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Trace tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_trace, NULL, NULL, NULL, NULL, NULL);
+
+static uint8_t trace_buf[8192];
+static size_t trace_len;
+
+static int trace_buf_write(const void *data, size_t len, void *ctx)
+{
+	ARG_UNUSED(ctx);
+	if (trace_len + len > sizeof(trace_buf)) {
+		return -1;
+	}
+	memcpy(trace_buf + trace_len, data, len);
+	trace_len += len;
+	return 0;
+}
+
+/* Count records of event on obj (any obj if NULL) in trace_buf */
+static uint32_t trace_count(uint8_t event, const void *obj)
+{
+	eai_osal_trace_hdr_t hdr;
+	uint32_t n = 0;
+
+	memcpy(&hdr, trace_buf, sizeof(hdr));
+	for (uint32_t i = 0; i < hdr.count; i++) {
+		eai_osal_trace_rec_t rec;
+
+		memcpy(&rec, trace_buf + sizeof(hdr) + i * sizeof(rec), sizeof(rec));
+		if (rec.event == event &&
+		    (obj == NULL || rec.obj == (uint32_t)(uintptr_t)obj)) {
+			n++;
+		}
+	}
+	return n;
+}
+
+static void trace_noop_work(void *arg)
+{
+	ARG_UNUSED(arg);
+}
+
+ZTEST(osal_trace, test_records_and_dump)
+{
+	eai_osal_sem_t sem;
+	eai_osal_work_t work;
+	eai_osal_trace_hdr_t hdr;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_work_init(&work, trace_noop_work, NULL);
+
+	eai_osal_trace_enable(false);
+	eai_osal_trace_clear();
+	eai_osal_trace_enable(true);
+	eai_osal_sem_give(&sem);
+	eai_osal_sem_take(&sem, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_work_submit(&work);
+	eai_osal_work_flush(&work);
+	k_msleep(2);
+	eai_osal_trace_enable(false);
+
+	trace_len = 0;
+	zassert_true(eai_osal_trace_dump(trace_buf_write, NULL) > 0);
+	memcpy(&hdr, trace_buf, sizeof(hdr));
+	zassert_equal(hdr.magic, EAI_OSAL_TRACE_MAGIC);
+	zassert_equal(hdr.ticks_hz, CONFIG_SYS_CLOCK_TICKS_PER_SEC);
+
+	zassert_equal(trace_count(EAI_OSAL_TRACE_SEM_GIVE, &sem), 1);
+	zassert_equal(trace_count(EAI_OSAL_TRACE_SEM_TAKE, &sem), 1);
+	zassert_equal(trace_count(EAI_OSAL_TRACE_WORK_START, &work), 1);
+	zassert_equal(trace_count(EAI_OSAL_TRACE_WORK_END, &work), 1);
+	/* flush and sleep both switch away from this thread and back */
+	zassert_true(trace_count(EAI_OSAL_TRACE_THREAD_SWITCH, NULL) >= 2);
+
+	eai_osal_trace_enable(true);
+	eai_osal_sem_destroy(&sem);
+}
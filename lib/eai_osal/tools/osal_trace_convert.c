@@ -0,0 +1,408 @@
+/*
+ * osal_trace_convert — turn an eai_osal_trace_dump() stream into
+ * something a trace viewer opens.
+ *
+ *   osal_trace_convert [-f json|ctf] [-o OUT] DUMP
+ *
+ * json (default): Chrome trace event JSON for ui.perfetto.dev or
+ *   chrome://tracing, written to OUT or stdout. Each OSAL thread is a
+ *   track with its work items as slices and sem/queue/timer events as
+ *   instants; with context switch records each CPU also gets a track
+ *   showing which thread ran when.
+ * ctf: Common Trace Format 1.8 for babeltrace2 / Trace Compass. OUT is
+ *   a directory that receives "metadata" and "stream".
+ *
+ * The dump must come from a target with the host's byte order (all our
+ * targets are little-endian).
+ */
+
+#include <eai_osal/trace.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAX_CPUS 256
+
+static const char *event_name(uint8_t event)
+{
+	switch (event) {
+	case EAI_OSAL_TRACE_THREAD_SWITCH:
+		return "thread_switch";
+	case EAI_OSAL_TRACE_THREAD_START:
+		return "thread_start";
+	case EAI_OSAL_TRACE_THREAD_EXIT:
+		return "thread_exit";
+	case EAI_OSAL_TRACE_SEM_GIVE:
+		return "sem_give";
+	case EAI_OSAL_TRACE_SEM_TAKE:
+		return "sem_take";
+	case EAI_OSAL_TRACE_QUEUE_SEND:
+		return "queue_send";
+	case EAI_OSAL_TRACE_QUEUE_RECV:
+		return "queue_recv";
+	case EAI_OSAL_TRACE_WORK_START:
+		return "work_start";
+	case EAI_OSAL_TRACE_WORK_END:
+		return "work_end";
+	case EAI_OSAL_TRACE_TIMER_FIRE:
+		return "timer_fire";
+	}
+	return event >= EAI_OSAL_TRACE_USER ? "user" : NULL;
+}
+
+/* ── Input ─────────────────────────────────────────────────────────────── */
+
+static int cmp_rec(const void *a, const void *b)
+{
+	const eai_osal_trace_rec_t *x = a;
+	const eai_osal_trace_rec_t *y = b;
+
+	if (x->ts != y->ts) {
+		return x->ts < y->ts ? -1 : 1;
+	}
+	if (x->cpu != y->cpu) {
+		return x->cpu < y->cpu ? -1 : 1;
+	}
+	return x->seq < y->seq ? -1 : (x->seq > y->seq);
+}
+
+/* Read the dump, drop empty slots and sort by time. */
+static eai_osal_trace_rec_t *load(const char *path, eai_osal_trace_hdr_t *hdr,
+				  uint32_t *count)
+{
+	FILE *f = fopen(path, "rb");
+
+	if (f == NULL) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return NULL;
+	}
+	if (fread(hdr, sizeof(*hdr), 1, f) != 1) {
+		fprintf(stderr, "%s: short header\n", path);
+		fclose(f);
+		return NULL;
+	}
+	if (hdr->magic != EAI_OSAL_TRACE_MAGIC ||
+	    hdr->version != EAI_OSAL_TRACE_VERSION ||
+	    hdr->rec_size != sizeof(eai_osal_trace_rec_t) || hdr->ticks_hz == 0) {
+		fprintf(stderr, "%s: not an eai_osal trace dump (or wrong version/"
+			"byte order)\n", path);
+		fclose(f);
+		return NULL;
+	}
+
+	eai_osal_trace_rec_t *recs = calloc(hdr->count ? hdr->count : 1,
+					    sizeof(*recs));
+	uint32_t n = 0;
+
+	if (recs == NULL) {
+		fclose(f);
+		return NULL;
+	}
+	for (uint32_t i = 0; i < hdr->count; i++) {
+		if (fread(&recs[n], sizeof(*recs), 1, f) != 1) {
+			fprintf(stderr, "%s: truncated after %" PRIu32 " of %" PRIu32
+				" records\n", path, i, hdr->count);
+			break;
+		}
+		if (event_name(recs[n].event) != NULL) {
+			n++;
+		}
+	}
+	fclose(f);
+
+	qsort(recs, n, sizeof(*recs), cmp_rec);
+	*count = n;
+	return recs;
+}
+
+/* ── Chrome trace event JSON ───────────────────────────────────────────── */
+
+#define PID_THREADS 1
+#define PID_CPUS    2
+
+static double ts_us(const eai_osal_trace_hdr_t *hdr, uint64_t ts)
+{
+	return (double)ts * 1e6 / (double)hdr->ticks_hz;
+}
+
+static int write_json(FILE *out, const eai_osal_trace_hdr_t *hdr,
+		      const eai_osal_trace_rec_t *recs, uint32_t count)
+{
+	/* Thread running on each CPU, from switch records (0 = none yet) */
+	static uint32_t running[MAX_CPUS];
+	uint32_t max_cpu = 0;
+	const char *sep = "\n";
+
+	fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	fprintf(out, "%s{\"ph\":\"M\",\"pid\":%d,\"name\":\"process_name\","
+		"\"args\":{\"name\":\"OSAL threads\"}}", sep, PID_THREADS);
+	sep = ",\n";
+	fprintf(out, "%s{\"ph\":\"M\",\"pid\":%d,\"name\":\"process_name\","
+		"\"args\":{\"name\":\"CPUs\"}}", sep, PID_CPUS);
+
+	for (uint32_t i = 0; i < count; i++) {
+		const eai_osal_trace_rec_t *r = &recs[i];
+		double ts = ts_us(hdr, r->ts);
+
+		if (r->cpu > max_cpu) {
+			max_cpu = r->cpu;
+		}
+
+		switch (r->event) {
+		case EAI_OSAL_TRACE_THREAD_SWITCH:
+			if (running[r->cpu] != 0) {
+				fprintf(out, "%s{\"ph\":\"E\",\"pid\":%d,\"tid\":%u,"
+					"\"ts\":%.3f}", sep, PID_CPUS, r->cpu, ts);
+			}
+			fprintf(out, "%s{\"ph\":\"B\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,"
+				"\"name\":\"0x%08" PRIx32 "\"}",
+				sep, PID_CPUS, r->cpu, ts, r->thread);
+			running[r->cpu] = r->thread;
+			break;
+		case EAI_OSAL_TRACE_WORK_START:
+			fprintf(out, "%s{\"ph\":\"B\",\"pid\":%d,\"tid\":%" PRIu32
+				",\"ts\":%.3f,\"name\":\"work 0x%08" PRIx32 "\","
+				"\"args\":{\"cpu\":%u}}",
+				sep, PID_THREADS, r->thread, ts, r->obj, r->cpu);
+			break;
+		case EAI_OSAL_TRACE_WORK_END:
+			fprintf(out, "%s{\"ph\":\"E\",\"pid\":%d,\"tid\":%" PRIu32
+				",\"ts\":%.3f}", sep, PID_THREADS, r->thread, ts);
+			break;
+		default:
+			fprintf(out, "%s{\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%"
+				PRIu32 ",\"ts\":%.3f,\"name\":\"%s",
+				sep, PID_THREADS, r->thread, ts, event_name(r->event));
+			if (r->event >= EAI_OSAL_TRACE_USER) {
+				fprintf(out, " %u", r->event - EAI_OSAL_TRACE_USER);
+			}
+			fprintf(out, "\",\"args\":{\"obj\":\"0x%08" PRIx32 "\","
+				"\"arg\":%u,\"cpu\":%u}}", r->obj, r->arg, r->cpu);
+			break;
+		}
+	}
+
+	/* Close the slices still open at the end of the trace */
+	if (count > 0) {
+		double end = ts_us(hdr, recs[count - 1].ts);
+
+		for (uint32_t cpu = 0; cpu <= max_cpu; cpu++) {
+			if (running[cpu] != 0) {
+				fprintf(out, "%s{\"ph\":\"E\",\"pid\":%d,\"tid\":%u,"
+					"\"ts\":%.3f}", sep, PID_CPUS, cpu, end);
+			}
+			fprintf(out, "%s{\"ph\":\"M\",\"pid\":%d,\"tid\":%u,"
+				"\"name\":\"thread_name\",\"args\":{\"name\":"
+				"\"CPU %u\"}}", sep, PID_CPUS, cpu, cpu);
+		}
+	}
+	fprintf(out, "\n]}\n");
+	return ferror(out) ? -1 : 0;
+}
+
+/* ── CTF 1.8 ───────────────────────────────────────────────────────────── */
+
+#define CTF_MAGIC 0xc1fc1fc1u
+
+static const char ctf_types[] =
+	"typealias integer { size = 8; align = 8; signed = false; } := uint8_t;\n"
+	"typealias integer { size = 16; align = 8; signed = false; } := uint16_t;\n"
+	"typealias integer { size = 32; align = 8; signed = false; } := uint32_t;\n"
+	"typealias integer { size = 64; align = 8; signed = false; } := uint64_t;\n"
+	"\n";
+
+static int write_ctf_metadata(FILE *out, const eai_osal_trace_hdr_t *hdr)
+{
+	const uint16_t probe = 1;
+	const char *order = *(const uint8_t *)&probe ? "le" : "be";
+
+	fprintf(out, "/* CTF 1.8 */\n\n%s", ctf_types);
+	fprintf(out,
+		"trace {\n"
+		"\tmajor = 1;\n"
+		"\tminor = 8;\n"
+		"\tbyte_order = %s;\n"
+		"\tpacket.header := struct {\n"
+		"\t\tuint32_t magic;\n"
+		"\t\tuint32_t stream_id;\n"
+		"\t};\n"
+		"};\n\n", order);
+	fprintf(out,
+		"clock {\n"
+		"\tname = osal;\n"
+		"\tdescription = \"eai_osal_time_get_ticks()\";\n"
+		"\tfreq = %" PRIu32 ";\n"
+		"};\n\n"
+		"typealias integer {\n"
+		"\tsize = 64; align = 8; signed = false;\n"
+		"\tmap = clock.osal.value;\n"
+		"} := osal_clock_t;\n\n", hdr->ticks_hz);
+	fprintf(out,
+		"stream {\n"
+		"\tid = 0;\n"
+		"\tevent.header := struct {\n"
+		"\t\tuint8_t id;\n"
+		"\t\tosal_clock_t timestamp;\n"
+		"\t};\n"
+		"};\n\n");
+
+	for (uint32_t id = 1; id <= EAI_OSAL_TRACE_USER; id++) {
+		const char *name = event_name((uint8_t)id);
+
+		if (name == NULL) {
+			continue;
+		}
+		/* User events share one CTF event; user_id tells them apart */
+		fprintf(out,
+			"event {\n"
+			"\tname = \"%s\";\n"
+			"\tid = %" PRIu32 ";\n"
+			"\tstream_id = 0;\n"
+			"\tfields := struct {\n"
+			"\t\tuint32_t thread;\n"
+			"\t\tuint32_t obj;\n"
+			"\t\tuint16_t arg;\n"
+			"\t\tuint8_t cpu;\n"
+			"\t\tuint8_t user_id;\n"
+			"\t};\n"
+			"};\n\n", name, id);
+	}
+	return ferror(out) ? -1 : 0;
+}
+
+static int write_ctf_stream(FILE *out, const eai_osal_trace_rec_t *recs,
+			    uint32_t count)
+{
+	const uint32_t packet_header[2] = { CTF_MAGIC, 0 };
+
+	fwrite(packet_header, sizeof(packet_header), 1, out);
+	for (uint32_t i = 0; i < count; i++) {
+		const eai_osal_trace_rec_t *r = &recs[i];
+		uint8_t id = r->event >= EAI_OSAL_TRACE_USER ?
+			     EAI_OSAL_TRACE_USER : r->event;
+		uint8_t user_id = r->event >= EAI_OSAL_TRACE_USER ?
+				  r->event - EAI_OSAL_TRACE_USER : 0;
+
+		/* Byte-aligned fields, no padding: write them one by one */
+		fwrite(&id, 1, 1, out);
+		fwrite(&r->ts, sizeof(r->ts), 1, out);
+		fwrite(&r->thread, sizeof(r->thread), 1, out);
+		fwrite(&r->obj, sizeof(r->obj), 1, out);
+		fwrite(&r->arg, sizeof(r->arg), 1, out);
+		fwrite(&r->cpu, 1, 1, out);
+		fwrite(&user_id, 1, 1, out);
+	}
+	return ferror(out) ? -1 : 0;
+}
+
+static int write_ctf(const char *dir, const eai_osal_trace_hdr_t *hdr,
+		     const eai_osal_trace_rec_t *recs, uint32_t count)
+{
+	char path[4096];
+	FILE *f;
+	int rc;
+
+	if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+		fprintf(stderr, "%s: %s\n", dir, strerror(errno));
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "%s/metadata", dir);
+	f = fopen(path, "w");
+	if (f == NULL) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return -1;
+	}
+	rc = write_ctf_metadata(f, hdr);
+	if (fclose(f) != 0 || rc != 0) {
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "%s/stream", dir);
+	f = fopen(path, "wb");
+	if (f == NULL) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return -1;
+	}
+	rc = write_ctf_stream(f, recs, count);
+	if (fclose(f) != 0 || rc != 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/* ── main ──────────────────────────────────────────────────────────────── */
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [-f json|ctf] [-o OUT] DUMP\n"
+		"  json: Chrome/Perfetto trace JSON to OUT (default stdout)\n"
+		"  ctf:  CTF 1.8 trace into directory OUT\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+	const char *format = "json";
+	const char *out_path = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "f:o:h")) != -1) {
+		switch (opt) {
+		case 'f':
+			format = optarg;
+			break;
+		case 'o':
+			out_path = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 2;
+		}
+	}
+	if (optind + 1 != argc) {
+		usage(argv[0]);
+		return 2;
+	}
+
+	eai_osal_trace_hdr_t hdr;
+	uint32_t count = 0;
+	eai_osal_trace_rec_t *recs = load(argv[optind], &hdr, &count);
+	int rc;
+
+	if (recs == NULL) {
+		return 1;
+	}
+
+	if (strcmp(format, "json") == 0) {
+		FILE *out = out_path != NULL ? fopen(out_path, "w") : stdout;
+
+		if (out == NULL) {
+			fprintf(stderr, "%s: %s\n", out_path, strerror(errno));
+			free(recs);
+			return 1;
+		}
+		rc = write_json(out, &hdr, recs, count);
+		if (out != stdout && fclose(out) != 0) {
+			rc = -1;
+		}
+	} else if (strcmp(format, "ctf") == 0) {
+		if (out_path == NULL) {
+			fprintf(stderr, "ctf needs -o DIR\n");
+			free(recs);
+			return 2;
+		}
+		rc = write_ctf(out_path, &hdr, recs, count);
+	} else {
+		usage(argv[0]);
+		free(recs);
+		return 2;
+	}
+
+	free(recs);
+	return rc == 0 ? 0 : 1;
+}